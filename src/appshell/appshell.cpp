@@ -39,6 +39,7 @@
 #include "commandlinecontroller.h"
 
 #include "framework/global/globalmodule.h"
+#include "startuptracer.h"
 
 #include "log.h"
 
@@ -58,6 +59,8 @@ void AppShell::addModule(modularity::IModuleSetup* module)
 
 int AppShell::run(int argc, char** argv)
 {
+    StartupTracer* startupTracer = StartupTracer::instance();
+
     // ====================================================
     // Setup global Qt application variables
     // ====================================================
@@ -92,22 +95,28 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     // Setup modules: Resources, Exports, Imports, UiTypes
     // ====================================================
-    globalModule.registerResources();
-    globalModule.registerExports();
-    globalModule.registerUiTypes();
+    startupTracer->mark("application created");
+
+    auto trace = [startupTracer](mu::modularity::IModuleSetup* m, const std::string& stage, const std::function<void()>& func) {
+        startupTracer->trace(m->moduleName(), stage, func);
+    };
+
+    trace(&globalModule, "registerResources", [] { globalModule.registerResources(); });
+    trace(&globalModule, "registerExports", [] { globalModule.registerExports(); });
+    trace(&globalModule, "registerUiTypes", [] { globalModule.registerUiTypes(); });
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerResources();
+        trace(m, "registerResources", [m] { m->registerResources(); });
     }
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerExports();
+        trace(m, "registerExports", [m] { m->registerExports(); });
     }
 
-    globalModule.resolveImports();
+    trace(&globalModule, "resolveImports", [] { globalModule.resolveImports(); });
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerUiTypes();
-        m->resolveImports();
+        trace(m, "registerUiTypes", [m] { m->registerUiTypes(); });
+        trace(m, "resolveImports", [m] { m->resolveImports(); });
     }
 
     // ====================================================
@@ -121,26 +130,28 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     // Setup modules: onInit
     // ====================================================
-    globalModule.onInit(runMode);
+    trace(&globalModule, "onInit", [runMode] { globalModule.onInit(runMode); });
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onInit(runMode);
+        trace(m, "onInit", [m, runMode] { m->onInit(runMode); });
     }
 
     // ====================================================
     // Setup modules: onAllInited
     // ====================================================
-    globalModule.onAllInited(runMode);
+    trace(&globalModule, "onAllInited", [runMode] { globalModule.onAllInited(runMode); });
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onAllInited(runMode);
+        trace(m, "onAllInited", [m, runMode] { m->onAllInited(runMode); });
     }
 
+    startupTracer->mark("modules inited");
+
     // ====================================================
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
-    QMetaObject::invokeMethod(qApp, [this]() {
-        globalModule.onStartApp();
+    QMetaObject::invokeMethod(qApp, [this, trace]() {
+        trace(&globalModule, "onStartApp", [] { globalModule.onStartApp(); });
         for (mu::modularity::IModuleSetup* m : m_modules) {
-            m->onStartApp();
+            trace(m, "onStartApp", [m] { m->onStartApp(); });
         }
     }, Qt::QueuedConnection);
 
@@ -154,8 +165,11 @@ int AppShell::run(int argc, char** argv)
         // Process Converter
         // ====================================================
         auto task = commandLine.converterTask();
-        QMetaObject::invokeMethod(qApp, [this, task]() {
+        QMetaObject::invokeMethod(qApp, [this, task, startupTracer]() {
+                startupTracer->mark("converter started");
                 int code = processConverter(task);
+                startupTracer->mark("converter finished");
+                startupTracer->print();
                 qApp->exit(code);
             }, Qt::QueuedConnection);
     } break;
@@ -188,10 +202,16 @@ int AppShell::run(int argc, char** argv)
 #endif
 
         QObject::connect(engine, &QQmlApplicationEngine::objectCreated,
-                         &app, [url](QObject* obj, const QUrl& objUrl) {
+                         &app, [url, startupTracer](QObject* obj, const QUrl& objUrl) {
                 if (!obj && url == objUrl) {
                     LOGE() << "failed Qml load\n";
                     QCoreApplication::exit(-1);
+                    return;
+                }
+
+                if (url == objUrl) {
+                    startupTracer->mark("main qml loaded");
+                    startupTracer->print();
                 }
             }, Qt::QueuedConnection);
 
@@ -214,10 +234,10 @@ int AppShell::run(int argc, char** argv)
         // ====================================================
         // Setup modules: onDelayedInit
         // ====================================================
-        QTimer::singleShot(5000, [this]() {
-                globalModule.onDelayedInit();
+        QTimer::singleShot(5000, [this, trace]() {
+                trace(&globalModule, "onDelayedInit", [] { globalModule.onDelayedInit(); });
                 for (mu::modularity::IModuleSetup* m : m_modules) {
-                    m->onDelayedInit();
+                    trace(m, "onDelayedInit", [m] { m->onDelayedInit(); });
                 }
             });
     }
@@ -304,6 +324,10 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
         std::string scoreSource = task.params[CommandLineController::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, forceMode);
     } break;
+    case CommandLineController::ConvertType::Daemon: {
+        std::string serverName = task.params[CommandLineController::ParamKey::DaemonServerName].toString().toStdString();
+        ret = converter()->runDaemon(serverName);
+    } break;
     }
 
     if (!ret) {
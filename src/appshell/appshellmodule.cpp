@@ -157,14 +157,19 @@ void AppShellModule::registerUiTypes()
     qmlRegisterType<WindowDropArea>("MuseScore.Ui", 1, 0, "WindowDropArea");
 }
 
-void AppShellModule::onInit(const IApplication::RunMode&)
+void AppShellModule::onInit(const IApplication::RunMode& mode)
 {
+    s_appShellConfiguration->init();
+    s_sessionsManager->init();
+
+    if (IApplication::RunMode::Editor != mode) {
+        return;
+    }
+
     DockSetup::onInit();
 
-    s_appShellConfiguration->init();
     s_applicationActionController->init();
     s_applicationUiActions->init();
-    s_sessionsManager->init();
 }
 
 void AppShellModule::onDeinit()
@@ -53,6 +53,11 @@ void CommandLineController::parse(const QStringList& args)
 
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
+    m_parser.addOption(QCommandLineOption("export-threads",
+                                          "Use with '-o <file>.png', '-o <file>.svg' and '--score-media', "
+                                          "set the number of pages exported at the same time", "count"));
+    m_parser.addOption(QCommandLineOption("parts-layout-threads",
+                                          "Set the number of part scores laid out at the same time", "count"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
@@ -65,6 +70,9 @@ void CommandLineController::parse(const QStringList& args)
     m_parser.addOption(QCommandLineOption("score-media",
                                           "Export all media (excepting mp3) for a given score in a single JSON file and print it to stdout"));
     m_parser.addOption(QCommandLineOption("highlight-config", "Set highlight to svg, generated from a given score", "highlight-config"));
+    m_parser.addOption(QCommandLineOption("score-media-format",
+                                          "Use with '--score-media', output format: 'json' (default) or 'multipart' (binary, without base64)",
+                                          "format"));
     m_parser.addOption(QCommandLineOption("score-meta", "Export score metadata to JSON document and print it to stdout"));
     m_parser.addOption(QCommandLineOption("score-parts", "Generate parts data for the given score and save them to separate mscz files"));
     m_parser.addOption(QCommandLineOption("score-parts-pdf",
@@ -73,6 +81,9 @@ void CommandLineController::parse(const QStringList& args)
                                           "Transpose the given score and export the data to a single JSON file, print it to stdout",
                                           "options"));
     m_parser.addOption(QCommandLineOption("source-update", "Update the source in the given score"));
+    m_parser.addOption(QCommandLineOption("daemon",
+                                          "Keep running and process conversion jobs (JSON lines) from stdin, or from '--daemon-socket'"));
+    m_parser.addOption(QCommandLineOption("daemon-socket", "Use with '--daemon', listen on the given local socket", "name"));
 
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
 
@@ -171,6 +182,24 @@ void CommandLineController::apply()
         }
     }
 
+    if (m_parser.isSet("export-threads")) {
+        std::optional<int> val = intValue("export-threads");
+        if (val && val.value() > 0) {
+            converterConfiguration()->setExportThreadCount(val);
+        } else {
+            LOGE() << "Option: --export-threads not recognized count value: " << m_parser.value("export-threads");
+        }
+    }
+
+    if (m_parser.isSet("parts-layout-threads")) {
+        std::optional<int> val = intValue("parts-layout-threads");
+        if (val && val.value() > 0) {
+            engravingConfiguration()->setPartsLayoutThreadCount(val);
+        } else {
+            LOGE() << "Option: --parts-layout-threads not recognized count value: " << m_parser.value("parts-layout-threads");
+        }
+    }
+
     if (m_parser.isSet("o")) {
         application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::File;
@@ -206,6 +235,16 @@ void CommandLineController::apply()
         if (m_parser.isSet("highlight-config")) {
             m_converterTask.params[CommandLineController::ParamKey::HighlightConfigPath] = m_parser.value("highlight-config");
         }
+        if (m_parser.isSet("score-media-format")) {
+            QString format = m_parser.value("score-media-format");
+            if (format == "multipart") {
+                converterConfiguration()->setScoreMediaFormat(converter::ScoreMediaFormat::Multipart);
+            } else if (format == "json") {
+                converterConfiguration()->setScoreMediaFormat(converter::ScoreMediaFormat::Json);
+            } else {
+                LOGE() << "Option: --score-media-format not recognized format: " << format;
+            }
+        }
     }
 
     if (m_parser.isSet("score-meta")) {
@@ -247,6 +286,14 @@ void CommandLineController::apply()
         }
     }
 
+    if (m_parser.isSet("daemon")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::Daemon;
+        if (m_parser.isSet("daemon-socket")) {
+            m_converterTask.params[CommandLineController::ParamKey::DaemonServerName] = m_parser.value("daemon-socket");
+        }
+    }
+
     if (m_parser.isSet("F") || m_parser.isSet("R")) {
         configuration()->revertToFactorySettings(m_parser.isSet("R"));
     }
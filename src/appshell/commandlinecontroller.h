@@ -31,6 +31,8 @@
 #include "importexport/imagesexport/iimagesexportconfiguration.h"
 #include "importexport/midi/imidiconfiguration.h"
 #include "importexport/audioexport/iaudioexportconfiguration.h"
+#include "converter/iconverterconfiguration.h"
+#include "engraving/iengravingconfiguration.h"
 #include "iappshellconfiguration.h"
 #include "internal/istartupscenario.h"
 #include "notation/inotationconfiguration.h"
@@ -44,6 +46,8 @@ class CommandLineController
     INJECT(appshell, iex::imagesexport::IImagesExportConfiguration, imagesExportConfiguration)
     INJECT(appshell, iex::midi::IMidiImportExportConfiguration, midiImportExportConfiguration)
     INJECT(appshell, iex::audioexport::IAudioExportConfiguration, audioExportConfiguration)
+    INJECT(appshell, converter::IConverterConfiguration, converterConfiguration)
+    INJECT(appshell, engraving::IEngravingConfiguration, engravingConfiguration)
     INJECT(appshell, IAppShellConfiguration, configuration)
     INJECT(appshell, IStartupScenario, startupScenario)
     INJECT(appshell, notation::INotationConfiguration, notationConfiguration)
@@ -61,7 +65,8 @@ public:
         ExportScoreParts,
         ExportScorePartsPdf,
         ExportScoreTranspose,
-        SourceUpdate
+        SourceUpdate,
+        Daemon
     };
 
     enum class ParamKey {
@@ -69,7 +74,8 @@ public:
         StylePath,
         ScoreSource,
         ScoreTransposeOptions,
-        ForceMode
+        ForceMode,
+        DaemonServerName
     };
 
     struct ConverterTask {
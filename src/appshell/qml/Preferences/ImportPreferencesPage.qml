@@ -91,6 +91,7 @@ PreferencesPage {
         MusicXmlSection {
             importLayout: importPreferencesModel.importLayout
             importBreaks: importPreferencesModel.importBreaks
+            validateMusicXml: importPreferencesModel.validateMusicXml
             needUseDefaultFont: importPreferencesModel.needUseDefaultFont
 
             navigation.section: root.navigationSection
@@ -104,6 +105,10 @@ PreferencesPage {
                 importPreferencesModel.importBreaks = importBreaks
             }
 
+            onValidateMusicXmlChangeRequested: function(validate) {
+                importPreferencesModel.validateMusicXml = validate
+            }
+
             onUseDefaultFontChangeRequested: function(use) {
                 importPreferencesModel.needUseDefaultFont = use
             }
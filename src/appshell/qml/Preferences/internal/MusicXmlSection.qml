@@ -30,10 +30,12 @@ BaseSection {
 
     property alias importLayout: importLayoutBox.checked
     property alias importBreaks: importBreaksBox.checked
+    property alias validateMusicXml: validateMusicXmlBox.checked
     property alias needUseDefaultFont: needUseDefaultFontBox.checked
 
     signal importLayoutChangeRequested(bool importLayout)
     signal importBreaksChangeRequested(bool importBreaks)
+    signal validateMusicXmlChangeRequested(bool validate)
     signal useDefaultFontChangeRequested(bool use)
 
     CheckBox {
@@ -66,6 +68,21 @@ BaseSection {
         }
     }
 
+    CheckBox {
+        id: validateMusicXmlBox
+        width: parent.width
+
+        text: qsTrc("appshell", "Validate files against the MusicXML schema")
+
+        navigation.name: "ValidateMusicXmlBox"
+        navigation.panel: root.navigation
+        navigation.row: 2
+
+        onClicked: {
+            root.validateMusicXmlChangeRequested(!checked)
+        }
+    }
+
     CheckBox {
         id: needUseDefaultFontBox
         width: parent.width
@@ -74,7 +91,7 @@ BaseSection {
 
         navigation.name: "UseDefaultFontBox"
         navigation.panel: root.navigation
-        navigation.row: 2
+        navigation.row: 3
 
         onClicked: {
             root.useDefaultFontChangeRequested(!checked)
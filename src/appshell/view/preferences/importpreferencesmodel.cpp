@@ -109,6 +109,11 @@ bool ImportPreferencesModel::importBreaks() const
     return musicXmlConfiguration()->musicxmlImportBreaks();
 }
 
+bool ImportPreferencesModel::validateMusicXml() const
+{
+    return musicXmlConfiguration()->musicxmlImportValidation();
+}
+
 bool ImportPreferencesModel::needUseDefaultFont() const
 {
     return musicXmlConfiguration()->needUseDefaultFont();
@@ -174,6 +179,16 @@ void ImportPreferencesModel::setImportBreaks(bool import)
     emit importBreaksChanged(import);
 }
 
+void ImportPreferencesModel::setValidateMusicXml(bool validate)
+{
+    if (validate == validateMusicXml()) {
+        return;
+    }
+
+    musicXmlConfiguration()->setMusicxmlImportValidation(validate);
+    emit validateMusicXmlChanged(validate);
+}
+
 void ImportPreferencesModel::setNeedUseDefaultFont(bool value)
 {
     if (value == needUseDefaultFont()) {
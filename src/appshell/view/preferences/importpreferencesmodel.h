@@ -53,6 +53,7 @@ class ImportPreferencesModel : public QObject, public async::Asyncable
 
     Q_PROPERTY(bool importLayout READ importLayout WRITE setImportLayout NOTIFY importLayoutChanged)
     Q_PROPERTY(bool importBreaks READ importBreaks WRITE setImportBreaks NOTIFY importBreaksChanged)
+    Q_PROPERTY(bool validateMusicXml READ validateMusicXml WRITE setValidateMusicXml NOTIFY validateMusicXmlChanged)
     Q_PROPERTY(bool needUseDefaultFont READ needUseDefaultFont WRITE setNeedUseDefaultFont NOTIFY needUseDefaultFontChanged)
 
     Q_PROPERTY(int currentShortestNote READ currentShortestNote WRITE setCurrentShortestNote NOTIFY currentShortestNoteChanged)
@@ -77,6 +78,7 @@ public:
 
     bool importLayout() const;
     bool importBreaks() const;
+    bool validateMusicXml() const;
     bool needUseDefaultFont() const;
 
     int currentShortestNote() const;
@@ -90,6 +92,7 @@ public slots:
 
     void setImportLayout(bool import);
     void setImportBreaks(bool import);
+    void setValidateMusicXml(bool validate);
     void setNeedUseDefaultFont(bool value);
 
     void setCurrentShortestNote(int note);
@@ -102,6 +105,7 @@ signals:
     void currentOvertuneCharsetChanged(QString currentOvertuneCharset);
     void importLayoutChanged(bool importLayout);
     void importBreaksChanged(bool importBreaks);
+    void validateMusicXmlChanged(bool validate);
     void needUseDefaultFontChanged(bool needUseDefaultFont);
     void currentShortestNoteChanged(int currentShortestNote);
     void needAskAboutApplyingNewStyleChanged(bool needAskAboutApplyingNewStyle);
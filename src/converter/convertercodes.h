@@ -39,6 +39,10 @@ enum class Err {
 
     OutFileFailedOpen = 1330,
     OutFileFailedWrite = 1331,
+
+    DaemonFailedListen = 1340,
+    DaemonJobFailedParse = 1341,
+    DaemonJobTypeUnknown = 1342,
 };
 
 inline Ret make_ret(Err e)
@@ -23,9 +23,12 @@
 
 #include "modularity/ioc.h"
 #include "internal/convertercontroller.h"
+#include "internal/converterconfiguration.h"
 
 using namespace mu::converter;
 
+static std::shared_ptr<ConverterConfiguration> s_configuration = std::make_shared<ConverterConfiguration>();
+
 std::string ConverterModule::moduleName() const
 {
     return "converter";
@@ -34,4 +37,5 @@ std::string ConverterModule::moduleName() const
 void ConverterModule::registerExports()
 {
     modularity::ioc()->registerExport<IConverterController>(moduleName(), new ConverterController());
+    modularity::ioc()->registerExport<IConverterConfiguration>(moduleName(), s_configuration);
 }
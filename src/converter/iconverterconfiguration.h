@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_ICONVERTERCONFIGURATION_H
+#define MU_CONVERTER_ICONVERTERCONFIGURATION_H
+
+#include <optional>
+
+#include "modularity/imoduleexport.h"
+
+namespace mu::converter {
+enum class ScoreMediaFormat {
+    Json,       // the binary artifacts are base64 encoded
+    Multipart   // MIME multipart/mixed, the binary artifacts are written as is
+};
+
+class IConverterConfiguration : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IConverterConfiguration)
+
+public:
+    virtual ~IConverterConfiguration() = default;
+
+    //! NOTE Number of pages written at the same time, by default the number of CPU cores
+    virtual int exportThreadCount() const = 0;
+
+    //! NOTE Maybe set from command line
+    virtual void setExportThreadCount(std::optional<int> count) = 0;
+
+    virtual ScoreMediaFormat scoreMediaFormat() const = 0;
+    virtual void setScoreMediaFormat(ScoreMediaFormat format) = 0;
+};
+}
+
+#endif // MU_CONVERTER_ICONVERTERCONFIGURATION_H
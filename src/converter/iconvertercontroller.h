@@ -51,6 +51,10 @@ public:
                                      const io::path& stylePath = io::path(), bool forceMode = false) = 0;
 
     virtual Ret updateSource(const io::path& in, const std::string& newSource, bool forceMode = false) = 0;
+
+    //! NOTE Keeps the process running and converts the jobs received from the stdin (or the local socket),
+    //! returns after the quit job or the end of the input
+    virtual Ret runDaemon(const std::string& serverName = std::string()) = 0;
 };
 }
 
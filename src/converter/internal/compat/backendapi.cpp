@@ -30,12 +30,24 @@
 #include <QJsonArray>
 #include <QJsonValue>
 #include <QRandomGenerator>
+#include <QElapsedTimer>
+
+#if defined(Q_OS_LINUX)
+#include <QFile>
+#elif defined(Q_OS_MACOS)
+#include <sys/resource.h>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#endif
 
 #include "engraving/compat/scoreaccess.h"
 #include "engraving/infrastructure/io/mscwriter.h"
 #include "engraving/libmscore/excerpt.h"
 
+#include "../pageswriter.h"
 #include "backendjsonwriter.h"
+#include "backendmultipartwriter.h"
 #include "notationmeta.h"
 
 #include "log.h"
@@ -59,6 +71,54 @@ static const std::string META_DATA_NAME = "metadata";
 static constexpr bool ADD_SEPARATOR = true;
 static constexpr auto NO_STYLE = "";
 
+//! NOTE Resets the peak of the resident memory, where it's possible (only Linux),
+//! otherwise the peak of the whole process is reported
+static void resetPeakMemoryUsage()
+{
+#if defined(Q_OS_LINUX)
+    QFile clearRefs("/proc/self/clear_refs");
+    if (clearRefs.open(QIODevice::WriteOnly)) {
+        clearRefs.write("5");
+    }
+#endif
+}
+
+static size_t peakMemoryUsage()
+{
+#if defined(Q_OS_LINUX)
+    QFile status("/proc/self/status");
+    if (!status.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return 0;
+    }
+
+    for (const QByteArray& line : status.readAll().split('\n')) {
+        if (line.startsWith("VmHWM:")) {
+            QByteArray kb = line.mid(6).trimmed();
+            kb.chop(3); // " kB"
+            return static_cast<size_t>(kb.trimmed().toULongLong()) * 1024;
+        }
+    }
+
+    return 0;
+#elif defined(Q_OS_MACOS)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+
+    return static_cast<size_t>(usage.ru_maxrss);
+#elif defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+
+    return static_cast<size_t>(counters.PeakWorkingSetSize);
+#else
+    return 0;
+#endif
+}
+
 Ret BackendApi::exportScoreMedia(const io::path& in, const io::path& out, const io::path& highlightConfigPath, const io::path& stylePath,
                                  bool forceMode)
 {
@@ -73,19 +133,31 @@ Ret BackendApi::exportScoreMedia(const io::path& in, const io::path& out, const
 
     bool result = true;
 
+    resetPeakMemoryUsage();
+
     QFile outputFile;
     openOutputFile(outputFile, out);
 
-    BackendJsonWriter jsonWriter(&outputFile);
+    //! NOTE The artifacts are written to the output as they are created
+    {
+        std::unique_ptr<BackendMediaWriter> mediaWriter;
+        if (configuration()->scoreMediaFormat() == ScoreMediaFormat::Multipart) {
+            mediaWriter = std::make_unique<BackendMultipartWriter>(&outputFile);
+        } else {
+            mediaWriter = std::make_unique<BackendJsonWriter>(&outputFile);
+        }
+
+        result &= exportScorePngs(notation, *mediaWriter, ADD_SEPARATOR);
+        result &= exportScoreSvgs(notation, highlightConfigPath, *mediaWriter, ADD_SEPARATOR);
+        result &= exportScoreElementsPositions(SEGMENTS_POSITIONS_WRITER_NAME, notation, *mediaWriter, ADD_SEPARATOR);
+        result &= exportScoreElementsPositions(MEASURES_POSITIONS_WRITER_NAME, notation, *mediaWriter, ADD_SEPARATOR);
+        result &= exportScorePdf(notation, *mediaWriter, ADD_SEPARATOR);
+        result &= exportScoreMidi(notation, *mediaWriter, ADD_SEPARATOR);
+        result &= exportScoreMusicXML(notation, *mediaWriter, ADD_SEPARATOR);
+        result &= exportScoreMetaData(notation, *mediaWriter);
+    }
 
-    result &= exportScorePngs(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreSvgs(notation, highlightConfigPath, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreElementsPositions(SEGMENTS_POSITIONS_WRITER_NAME, notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreElementsPositions(MEASURES_POSITIONS_WRITER_NAME, notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScorePdf(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreMidi(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreMusicXML(notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScoreMetaData(notation, jsonWriter);
+    LOGI() << "score media exported, peak RSS: " << peakMemoryUsage() / (1024 * 1024) << " MB";
 
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
@@ -136,11 +208,19 @@ Ret BackendApi::exportScorePartsPdfs(const io::path& in, const io::path& out, co
 {
     TRACEFUNC
 
+    resetPeakMemoryUsage();
+
+    QElapsedTimer timer;
+    timer.start();
+
     RetVal<IMasterNotationPtr> openScoreRetVal = openScore(in, stylePath, forceMode);
     if (!openScoreRetVal.ret) {
         return openScoreRetVal.ret;
     }
 
+    LOGI() << "score opened and laid out in " << timer.elapsed() << " ms, parts: "
+           << openScoreRetVal.val->excerpts().val.size();
+
     QFile outputFile;
     openOutputFile(outputFile, out);
 
@@ -150,6 +230,9 @@ Ret BackendApi::exportScorePartsPdfs(const io::path& in, const io::path& out, co
 
     outputFile.close();
 
+    LOGI() << "score parts PDFs exported in " << timer.elapsed() << " ms, peak RSS: "
+           << peakMemoryUsage() / (1024 * 1024) << " MB";
+
     return ret;
 }
 
@@ -230,16 +313,6 @@ RetVal<notation::IMasterNotationPtr> BackendApi::openScore(const io::path& path,
     return RetVal<IMasterNotationPtr>::make_ok(prj.val->masterNotation());
 }
 
-PageList BackendApi::pages(const INotationPtr notation)
-{
-    auto elements = notation->elements();
-    if (!elements) {
-        return {};
-    }
-
-    return elements->pages();
-}
-
 QVariantMap BackendApi::readNotesColors(const io::path& filePath)
 {
     TRACEFUNC
@@ -275,7 +348,7 @@ QVariantMap BackendApi::readNotesColors(const io::path& filePath)
     return result;
 }
 
-Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
+Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator)
 {
     TRACEFUNC
 
@@ -285,38 +358,32 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
         return make_ret(Ret::Code::InternalError);
     }
 
-    jsonWriter.addKey("pngs");
-    jsonWriter.openArray();
+    mediaWriter.addKey("pngs", "image/png");
+    mediaWriter.openArray();
+
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
+    };
 
-    PageList notationPages = pages(notation);
+    const int pageCount = notation->elements()->pages().size();
 
     bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        QByteArray pngData;
-        QBuffer pngDevice(&pngData);
-        pngDevice.open(QIODevice::ReadWrite);
-
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
-        };
-
-        Ret writeRet = pngWriter->write(notation, pngDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
+    PagesWriter::write(pngWriter, notation, options, [&](int pageIndex, const PagesWriter::PageData& png) {
+        if (!png.ret) {
+            LOGW() << png.ret.toString();
             result = false;
         }
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(pngData.toBase64(), lastArrayValue);
-    }
+        bool lastArrayValue = ((pageCount - 1) == pageIndex);
+        mediaWriter.addBinaryValue(png.val, !lastArrayValue);
+    });
 
-    jsonWriter.closeArray(addSeparator);
+    mediaWriter.closeArray(addSeparator);
 
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
-Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path& highlightConfigPath, BackendJsonWriter& jsonWriter,
+Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path& highlightConfigPath, BackendMediaWriter& mediaWriter,
                                 bool addSeparator)
 {
     TRACEFUNC
@@ -327,68 +394,47 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path& hig
         return make_ret(Ret::Code::InternalError);
     }
 
-    jsonWriter.addKey("svgs");
-    jsonWriter.openArray();
+    mediaWriter.addKey("svgs", "image/svg+xml");
+    mediaWriter.openArray();
 
-    PageList notationPages = pages(notation);
     QVariantMap notesColors = readNotesColors(highlightConfigPath);
 
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
+        { INotationWriter::OptionKey::NOTES_COLORS, Val(notesColors) }
+    };
+
+    const int pageCount = notation->elements()->pages().size();
+
     bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        QByteArray svgData;
-        QBuffer svgDevice(&svgData);
-        svgDevice.open(QIODevice::ReadWrite);
-
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
-            { INotationWriter::OptionKey::NOTES_COLORS, Val(notesColors) }
-        };
-
-        Ret writeRet = svgWriter->write(notation, svgDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
+    PagesWriter::write(svgWriter, notation, options, [&](int pageIndex, const PagesWriter::PageData& svg) {
+        if (!svg.ret) {
+            LOGW() << svg.ret.toString();
             result = false;
         }
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(svgData.toBase64(), !lastArrayValue);
-    }
+        bool lastArrayValue = ((pageCount - 1) == pageIndex);
+        mediaWriter.addBinaryValue(svg.val, !lastArrayValue);
+    });
 
-    jsonWriter.closeArray(addSeparator);
+    mediaWriter.closeArray(addSeparator);
 
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
 Ret BackendApi::exportScoreElementsPositions(const std::string& elementsPositionsWriterName, const INotationPtr notation,
-                                             BackendJsonWriter& jsonWriter, bool addSeparator)
+                                             BackendMediaWriter& mediaWriter, bool addSeparator)
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(elementsPositionsWriterName, notation);
-    if (!writerRetVal.ret) {
-        return writerRetVal.ret;
-    }
-
-    jsonWriter.addKey(elementsPositionsWriterName.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator, false);
-
-    return make_ret(Ret::Code::Ok);
+    return streamWriter(elementsPositionsWriterName, notation, "application/xml", mediaWriter, addSeparator);
 }
 
-Ret BackendApi::exportScorePdf(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
+Ret BackendApi::exportScorePdf(const INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator)
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(PDF_WRITER_NAME, notation);
-    if (!writerRetVal.ret) {
-        return writerRetVal.ret;
-    }
-
-    jsonWriter.addKey(PDF_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
-
-    return make_ret(Ret::Code::Ok);
+    return streamWriter(PDF_WRITER_NAME, notation, "application/pdf", mediaWriter, addSeparator);
 }
 
 Ret BackendApi::exportScorePdf(const INotationPtr notation, Device& destinationDevice)
@@ -406,37 +452,43 @@ Ret BackendApi::exportScorePdf(const INotationPtr notation, Device& destinationD
     return ok ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
-Ret BackendApi::exportScoreMidi(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
+Ret BackendApi::exportScoreMidi(const INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator)
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(MIDI_WRITER_NAME, notation);
-    if (!writerRetVal.ret) {
-        return writerRetVal.ret;
+    //! NOTE The MIDI writer seeks back to write the track sizes, so it can't write to the stream directly
+    auto writer = writers()->writer(MIDI_WRITER_NAME);
+    if (!writer) {
+        LOGW() << "Not found writer " << MIDI_WRITER_NAME;
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    QByteArray data;
+    QBuffer device(&data);
+    device.open(QIODevice::ReadWrite);
+
+    Ret writeRet = writer->write(notation, device);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+        return writeRet;
     }
 
-    jsonWriter.addKey(MIDI_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    device.close();
+
+    mediaWriter.addKey(MIDI_WRITER_NAME.c_str(), "audio/midi");
+    mediaWriter.addBinaryValue(data, addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
 
-Ret BackendApi::exportScoreMusicXML(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
+Ret BackendApi::exportScoreMusicXML(const INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator)
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(MUSICXML_WRITER_NAME, notation);
-    if (!writerRetVal.ret) {
-        return writerRetVal.ret;
-    }
-
-    jsonWriter.addKey(MUSICXML_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
-
-    return make_ret(Ret::Code::Ok);
+    return streamWriter(MUSICXML_WRITER_NAME, notation, "application/vnd.recordare.musicxml+xml", mediaWriter, addSeparator);
 }
 
-Ret BackendApi::exportScoreMetaData(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
+Ret BackendApi::exportScoreMetaData(const INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator)
 {
     TRACEFUNC
 
@@ -446,12 +498,35 @@ Ret BackendApi::exportScoreMetaData(const INotationPtr notation, BackendJsonWrit
         return meta.ret;
     }
 
-    jsonWriter.addKey(META_DATA_NAME.c_str());
-    jsonWriter.addValue(QString::fromStdString(meta.val).toUtf8(), addSeparator, true);
+    mediaWriter.addKey(META_DATA_NAME.c_str(), "application/json");
+    mediaWriter.addValue(QString::fromStdString(meta.val).toUtf8(), addSeparator, true);
 
     return make_ret(Ret::Code::Ok);
 }
 
+Ret BackendApi::streamWriter(const std::string& writerName, const INotationPtr notation, const char* contentType,
+                             BackendMediaWriter& mediaWriter, bool addSeparator)
+{
+    auto writer = writers()->writer(writerName);
+    if (!writer) {
+        LOGW() << "Not found writer " << writerName;
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    mediaWriter.addKey(writerName.c_str(), contentType);
+
+    //! NOTE If the writer fails, the value written so far is closed, so the output stays well formed
+    Device* device = mediaWriter.openBinaryValue();
+    Ret writeRet = writer->write(notation, *device);
+    mediaWriter.closeBinaryValue(addSeparator);
+
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+    }
+
+    return writeRet;
+}
+
 mu::RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtr notation)
 {
     auto writer = writers()->writer(writerName);
@@ -549,11 +624,16 @@ Ret BackendApi::doExportScoreParts(const notation::INotationPtr notation, Device
 Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation, Device& destinationDevice,
                                        const std::string& scoreFileName)
 {
+    QElapsedTimer timer;
+    timer.start();
+
     QJsonObject jsonForPdfs;
     jsonForPdfs["score"] = QString::fromStdString(scoreFileName);
     QByteArray scoreBin = processWriter(PDF_WRITER_NAME, masterNotation->notation()).val;
     jsonForPdfs["scoreBin"] = QString::fromLatin1(scoreBin);
 
+    LOGI() << "score PDF written in " << timer.restart() << " ms";
+
     INotationPtrList notations;
 
     QJsonArray partsArray;
@@ -569,6 +649,8 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
         notations.push_back(e->notation());
     }
 
+    LOGI() << "parts PDFs written in " << timer.restart() << " ms";
+
     jsonForPdfs["parts"] = partsNamesArray;
     jsonForPdfs["partsBin"] = partsArray;
 
@@ -581,6 +663,8 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
     QByteArray fullScoreData = processWriter(PDF_WRITER_NAME, notations, options).val;
     jsonForPdfs["scoreFullBin"] = QString::fromLatin1(fullScoreData.toBase64());
 
+    LOGI() << "score and parts PDF written in " << timer.restart() << " ms";
+
     QJsonDocument jsonDoc(jsonForPdfs);
     bool ok = destinationDevice.write(QJsonDocument(jsonDoc).toJson(QJsonDocument::Compact)) != -1;
 
@@ -31,6 +31,7 @@
 #include "system/ifilesystem.h"
 #include "project/iprojectcreator.h"
 #include "project/inotationwritersregister.h"
+#include "../../iconverterconfiguration.h"
 
 namespace Ms {
 class Score;
@@ -38,11 +39,13 @@ class Score;
 
 namespace mu::converter {
 class BackendJsonWriter;
+class BackendMediaWriter;
 class BackendApi
 {
     INJECT_STATIC(converter, system::IFileSystem, fileSystem)
     INJECT_STATIC(converter, project::IProjectCreator, notationCreator)
     INJECT_STATIC(converter, project::INotationWritersRegister, writers)
+    INJECT_STATIC(converter, IConverterConfiguration, configuration)
 
 public:
     static Ret exportScoreMedia(const io::path& in, const io::path& out, const io::path& highlightConfigPath,
@@ -64,20 +67,21 @@ private:
     static RetVal<notation::IMasterNotationPtr> openScore(const io::path& path,
                                                           const io::path& stylePath = io::path(), bool forceMode = false);
 
-    static notation::PageList pages(const notation::INotationPtr notation);
-
     static QVariantMap readNotesColors(const io::path& filePath);
 
-    static Ret exportScorePngs(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
-    static Ret exportScoreSvgs(const notation::INotationPtr notation, const io::path& highlightConfigPath, BackendJsonWriter& jsonWriter,
+    static Ret exportScorePngs(const notation::INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator = false);
+    static Ret exportScoreSvgs(const notation::INotationPtr notation, const io::path& highlightConfigPath, BackendMediaWriter& mediaWriter,
                                bool addSeparator = false);
     static Ret exportScoreElementsPositions(const std::string& elementsPositionsWriterName, const notation::INotationPtr notation,
-                                            BackendJsonWriter& jsonWriter, bool addSeparator = false);
-    static Ret exportScorePdf(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
+                                            BackendMediaWriter& mediaWriter, bool addSeparator = false);
+    static Ret exportScorePdf(const notation::INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator = false);
     static Ret exportScorePdf(const notation::INotationPtr notation, mu::io::Device& destinationDevice);
-    static Ret exportScoreMidi(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
-    static Ret exportScoreMusicXML(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
-    static Ret exportScoreMetaData(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
+    static Ret exportScoreMidi(const notation::INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator = false);
+    static Ret exportScoreMusicXML(const notation::INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator = false);
+    static Ret exportScoreMetaData(const notation::INotationPtr notation, BackendMediaWriter& mediaWriter, bool addSeparator = false);
+
+    static Ret streamWriter(const std::string& writerName, const notation::INotationPtr notation, const char* contentType,
+                            BackendMediaWriter& mediaWriter, bool addSeparator = false);
 
     static mu::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtr notation);
     static mu::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtrList notations,
@@ -37,7 +37,7 @@ BackendJsonWriter::~BackendJsonWriter()
     m_destinationDevice->close();
 }
 
-void BackendJsonWriter::addKey(const char* arrayName)
+void BackendJsonWriter::addKey(const char* arrayName, const char*)
 {
     m_destinationDevice->write("\"");
     m_destinationDevice->write(arrayName);
@@ -58,6 +58,29 @@ void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool
     }
 }
 
+Device* BackendJsonWriter::openBinaryValue()
+{
+    m_destinationDevice->write("\"");
+
+    m_base64Device = std::make_unique<Base64Device>(m_destinationDevice);
+    m_base64Device->open(QIODevice::WriteOnly | QIODevice::Unbuffered);
+
+    return m_base64Device.get();
+}
+
+void BackendJsonWriter::closeBinaryValue(bool addSeparator)
+{
+    if (m_base64Device) {
+        m_base64Device->close();
+        m_base64Device = nullptr;
+    }
+
+    m_destinationDevice->write("\"");
+    if (addSeparator) {
+        m_destinationDevice->write(",\n");
+    }
+}
+
 void BackendJsonWriter::openArray()
 {
     m_destinationDevice->write(" [");
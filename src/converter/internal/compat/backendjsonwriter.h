@@ -22,24 +22,33 @@
 #ifndef MU_CONVERTER_BACKENDJSONWRITER_H
 #define MU_CONVERTER_BACKENDJSONWRITER_H
 
+#include <memory>
+
 #include "io/path.h"
 #include "io/device.h"
 
+#include "backendmediawriter.h"
+#include "base64device.h"
+
 namespace mu::converter {
-class BackendJsonWriter
+class BackendJsonWriter : public BackendMediaWriter
 {
 public:
     BackendJsonWriter(io::Device* destinationDevice);
-    ~BackendJsonWriter();
+    ~BackendJsonWriter() override;
+
+    void addKey(const char* arrayName, const char* contentType = nullptr) override;
+    void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false) override;
 
-    void addKey(const char* arrayName);
-    void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false);
+    io::Device* openBinaryValue() override;
+    void closeBinaryValue(bool addSeparator = false) override;
 
-    void openArray();
-    void closeArray(bool addSeparator = false);
+    void openArray() override;
+    void closeArray(bool addSeparator = false) override;
 
 private:
     io::Device* m_destinationDevice = nullptr;
+    std::unique_ptr<Base64Device> m_base64Device;
 };
 }
 
@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_BACKENDMEDIAWRITER_H
+#define MU_CONVERTER_BACKENDMEDIAWRITER_H
+
+#include <QByteArray>
+
+#include "io/device.h"
+
+namespace mu::converter {
+//! NOTE Output of the score media, the keys and the values are written one by one
+class BackendMediaWriter
+{
+public:
+    virtual ~BackendMediaWriter() = default;
+
+    virtual void addKey(const char* key, const char* contentType = nullptr) = 0;
+
+    //! NOTE The data is written as is (the text or the json)
+    virtual void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false) = 0;
+
+    //! NOTE The binary data is written in the format of the writer (ex. base64 for the json)
+    virtual void addBinaryValue(const QByteArray& data, bool addSeparator = false)
+    {
+        io::Device* device = openBinaryValue();
+        device->write(data);
+        closeBinaryValue(addSeparator);
+    }
+
+    //! NOTE The binary value is written to the returned device until closeBinaryValue,
+    //! the device is sequential (can't seek back)
+    virtual io::Device* openBinaryValue() = 0;
+    virtual void closeBinaryValue(bool addSeparator = false) = 0;
+
+    virtual void openArray() = 0;
+    virtual void closeArray(bool addSeparator = false) = 0;
+};
+}
+
+#endif // MU_CONVERTER_BACKENDMEDIAWRITER_H
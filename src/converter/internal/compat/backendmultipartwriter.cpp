@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "backendmultipartwriter.h"
+
+#include <QRandomGenerator>
+
+using namespace mu::converter;
+using namespace mu::io;
+
+static const QByteArray DEFAULT_CONTENT_TYPE("application/octet-stream");
+
+BackendMultipartWriter::BackendMultipartWriter(Device* destinationDevice)
+{
+    m_destinationDevice = destinationDevice;
+    m_boundary = "MuseScoreMedia-" + QByteArray::number(QRandomGenerator::global()->generate64(), 16);
+
+    m_destinationDevice->open(QIODevice::WriteOnly);
+    m_destinationDevice->write("MIME-Version: 1.0\r\n");
+    m_destinationDevice->write("Content-Type: multipart/mixed; boundary=\"" + m_boundary + "\"\r\n");
+}
+
+BackendMultipartWriter::~BackendMultipartWriter()
+{
+    m_destinationDevice->write("\r\n--" + m_boundary + "--\r\n");
+    m_destinationDevice->close();
+}
+
+void BackendMultipartWriter::addKey(const char* key, const char* contentType)
+{
+    m_key = key;
+    m_contentType = contentType ? QByteArray(contentType) : DEFAULT_CONTENT_TYPE;
+}
+
+void BackendMultipartWriter::addValue(const QByteArray& data, bool, bool isJson)
+{
+    beginPart(isJson ? QByteArray("application/json") : QByteArray("text/plain"));
+    m_destinationDevice->write(data);
+    endPart();
+}
+
+Device* BackendMultipartWriter::openBinaryValue()
+{
+    beginPart(m_contentType);
+    return m_destinationDevice;
+}
+
+void BackendMultipartWriter::closeBinaryValue(bool)
+{
+    endPart();
+}
+
+void BackendMultipartWriter::openArray()
+{
+    m_isArray = true;
+    m_index = 0;
+}
+
+void BackendMultipartWriter::closeArray(bool)
+{
+    m_isArray = false;
+}
+
+void BackendMultipartWriter::beginPart(const QByteArray& contentType)
+{
+    QByteArray header = "\r\n--" + m_boundary + "\r\n";
+    header += "Content-Disposition: attachment; name=\"" + m_key + "\"";
+    if (m_isArray) {
+        header += "; index=\"" + QByteArray::number(m_index) + "\"";
+    }
+    header += "\r\nContent-Type: " + contentType + "\r\n\r\n";
+
+    m_destinationDevice->write(header);
+}
+
+void BackendMultipartWriter::endPart()
+{
+    if (m_isArray) {
+        ++m_index;
+    }
+}
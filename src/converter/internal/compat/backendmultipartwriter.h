@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_BACKENDMULTIPARTWRITER_H
+#define MU_CONVERTER_BACKENDMULTIPARTWRITER_H
+
+#include <QByteArray>
+
+#include "io/device.h"
+
+#include "backendmediawriter.h"
+
+namespace mu::converter {
+//! NOTE Writes the score media as MIME multipart/mixed, the binary values are written as is (without base64).
+//! Every value is a part, with the key and (for the arrays) the index in Content-Disposition:
+//!
+//!     --boundary
+//!     Content-Disposition: attachment; name="pngs"; index="0"
+//!     Content-Type: image/png
+//!
+//!     <data>
+class BackendMultipartWriter : public BackendMediaWriter
+{
+public:
+    BackendMultipartWriter(io::Device* destinationDevice);
+    ~BackendMultipartWriter() override;
+
+    void addKey(const char* key, const char* contentType = nullptr) override;
+    void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false) override;
+
+    io::Device* openBinaryValue() override;
+    void closeBinaryValue(bool addSeparator = false) override;
+
+    void openArray() override;
+    void closeArray(bool addSeparator = false) override;
+
+private:
+    void beginPart(const QByteArray& contentType);
+    void endPart();
+
+    io::Device* m_destinationDevice = nullptr;
+    QByteArray m_boundary;
+
+    QByteArray m_key;
+    QByteArray m_contentType;
+    bool m_isArray = false;
+    int m_index = 0;
+};
+}
+
+#endif // MU_CONVERTER_BACKENDMULTIPARTWRITER_H
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "base64device.h"
+
+#include <algorithm>
+
+using namespace mu::converter;
+
+//! NOTE Must be a multiple of 3, so the chunks are encoded without padding
+static constexpr qint64 CHUNK_SIZE = 3 * 16 * 1024;
+
+Base64Device::Base64Device(io::Device* destinationDevice)
+    : m_destinationDevice(destinationDevice)
+{
+}
+
+Base64Device::~Base64Device()
+{
+    close();
+}
+
+bool Base64Device::isSequential() const
+{
+    return true;
+}
+
+void Base64Device::close()
+{
+    if (!isOpen()) {
+        return;
+    }
+
+    if (!m_tail.isEmpty()) {
+        m_destinationDevice->write(m_tail.toBase64());
+        m_tail.clear();
+    }
+
+    QIODevice::close();
+}
+
+qint64 Base64Device::readData(char*, qint64)
+{
+    return -1;
+}
+
+qint64 Base64Device::writeData(const char* data, qint64 size)
+{
+    const char* begin = data;
+    const char* end = data + size;
+
+    //! NOTE Complete the group left from the previous write
+    if (!m_tail.isEmpty()) {
+        qint64 count = std::min<qint64>(3 - m_tail.size(), end - begin);
+        m_tail.append(begin, count);
+        begin += count;
+
+        if (m_tail.size() < 3) {
+            return size;
+        }
+
+        if (!writeEncoded(m_tail.constData(), m_tail.size())) {
+            return -1;
+        }
+
+        m_tail.clear();
+    }
+
+    while (end - begin >= 3) {
+        qint64 count = std::min<qint64>(CHUNK_SIZE, (end - begin) / 3 * 3);
+        if (!writeEncoded(begin, count)) {
+            return -1;
+        }
+
+        begin += count;
+    }
+
+    m_tail.append(begin, end - begin);
+
+    return size;
+}
+
+bool Base64Device::writeEncoded(const char* data, qint64 size)
+{
+    QByteArray encoded = QByteArray::fromRawData(data, static_cast<int>(size)).toBase64();
+    return m_destinationDevice->write(encoded) == encoded.size();
+}
@@ -0,0 +1,54 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_BASE64DEVICE_H
+#define MU_CONVERTER_BASE64DEVICE_H
+
+#include <QIODevice>
+
+#include "io/device.h"
+
+namespace mu::converter {
+//! NOTE Write only device, which encodes the written data to base64 on the fly
+//! and writes it to the destination device, so the data is never kept whole in memory.
+//! The last incomplete group (with the padding) is written on close.
+class Base64Device : public QIODevice
+{
+public:
+    explicit Base64Device(io::Device* destinationDevice);
+    ~Base64Device() override;
+
+    bool isSequential() const override;
+    void close() override;
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 size) override;
+
+private:
+    bool writeEncoded(const char* data, qint64 size);
+
+    io::Device* m_destinationDevice = nullptr;
+    QByteArray m_tail;
+};
+}
+
+#endif // MU_CONVERTER_BASE64DEVICE_H
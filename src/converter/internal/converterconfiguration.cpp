@@ -0,0 +1,52 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "converterconfiguration.h"
+
+#include <algorithm>
+
+#include <QThread>
+
+using namespace mu::converter;
+
+int ConverterConfiguration::exportThreadCount() const
+{
+    if (m_exportThreadCount) {
+        return std::max(m_exportThreadCount.value(), 1);
+    }
+
+    return std::max(QThread::idealThreadCount(), 1);
+}
+
+void ConverterConfiguration::setExportThreadCount(std::optional<int> count)
+{
+    m_exportThreadCount = count;
+}
+
+ScoreMediaFormat ConverterConfiguration::scoreMediaFormat() const
+{
+    return m_scoreMediaFormat;
+}
+
+void ConverterConfiguration::setScoreMediaFormat(ScoreMediaFormat format)
+{
+    m_scoreMediaFormat = format;
+}
@@ -31,6 +31,8 @@
 #include "convertercodes.h"
 #include "stringutils.h"
 #include "compat/backendapi.h"
+#include "converterdaemon.h"
+#include "pageswriter.h"
 
 using namespace mu::converter;
 using namespace mu::project;
@@ -38,6 +40,7 @@ using namespace mu::notation;
 
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
+static const std::string SVG_SUFFIX = "svg";
 
 mu::Ret ConverterController::batchConvert(const io::path& batchJobFile, const io::path& stylePath, bool forceMode)
 {
@@ -49,12 +52,13 @@ mu::Ret ConverterController::batchConvert(const io::path& batchJobFile, const io
         return batchJob.ret;
     }
 
+    //! NOTE A failed job doesn't stop the batch, the error of the last failed job is returned
     Ret ret = make_ret(Ret::Code::Ok);
     for (const Job& job : batchJob.val) {
-        ret = fileConvert(job.in, job.out, stylePath, forceMode);
-        if (!ret) {
-            LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
-            break;
+        Ret jobRet = fileConvert(job.in, job.out, stylePath, forceMode);
+        if (!jobRet) {
+            LOGE() << "failed convert, err: " << jobRet.toString() << ", in: " << job.in << ", out: " << job.out;
+            ret = jobRet;
         }
     }
 
@@ -89,7 +93,7 @@ mu::Ret ConverterController::fileConvert(const io::path& in, const io::path& out
         ret = convertFullNotation(writer, notationProject->masterNotation()->notation(), out);
     }
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 mu::Ret ConverterController::convertScoreParts(const mu::io::path& in, const mu::io::path& out, const mu::io::path& stylePath,
@@ -122,7 +126,7 @@ mu::Ret ConverterController::convertScoreParts(const mu::io::path& in, const mu:
         ret = make_ret(Ret::Code::NotSupported);
     }
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const io::path& batchJobFile) const
@@ -165,7 +169,8 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
 bool ConverterController::isConvertPageByPage(const std::string& suffix) const
 {
     QList<std::string> types {
-        PNG_SUFFIX
+        PNG_SUFFIX,
+        SVG_SUFFIX
     };
 
     return types.contains(suffix);
@@ -175,30 +180,39 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
-        const QString filePath = io::path(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
+    Ret ret = make_ret(Ret::Code::Ok);
 
-        QFile file(filePath);
-        if (!file.open(QFile::WriteOnly)) {
-            return make_ret(Err::OutFileFailedOpen);
+    //! NOTE Each page is written to its file as soon as it is ready, so only a few pages are kept in memory
+    PagesWriter::write(writer, notation, INotationWriter::Options(), [&](int pageIndex, const PagesWriter::PageData& page) {
+        if (!ret) {
+            return;
         }
 
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-        };
+        if (!page.ret) {
+            LOGE() << "failed write, err: " << page.ret.toString() << ", path: " << out;
+            ret = make_ret(Err::OutFileFailedWrite);
+            return;
+        }
 
-        file.setProperty("path", out.toQString());
+        const QString filePath = io::path(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(
+            pageIndex + 1);
 
-        Ret ret = writer->write(notation, file, options);
-        if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
-            return make_ret(Err::OutFileFailedWrite);
+        QFile file(filePath);
+        if (!file.open(QFile::WriteOnly)) {
+            ret = make_ret(Err::OutFileFailedOpen);
+            return;
+        }
+
+        if (file.write(page.val) != page.val.size()) {
+            LOGE() << "failed write, path: " << filePath;
+            ret = make_ret(Err::OutFileFailedWrite);
+            return;
         }
 
         file.close();
-    }
+    });
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 mu::Ret ConverterController::convertFullNotation(INotationWriterPtr writer, INotationPtr notation, const mu::io::path& out) const
@@ -322,3 +336,11 @@ mu::Ret ConverterController::updateSource(const io::path& in, const std::string&
 
     return BackendApi::updateSource(in, newSource, forceMode);
 }
+
+mu::Ret ConverterController::runDaemon(const std::string& serverName)
+{
+    TRACEFUNC;
+
+    ConverterDaemon daemon(this);
+    return daemon.run(serverName);
+}
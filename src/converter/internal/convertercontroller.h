@@ -57,6 +57,8 @@ public:
 
     Ret updateSource(const io::path& in, const std::string& newSource, bool forceMode = false) override;
 
+    Ret runDaemon(const std::string& serverName = std::string()) override;
+
 private:
 
     struct Job {
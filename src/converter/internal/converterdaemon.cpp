@@ -0,0 +1,368 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "converterdaemon.h"
+
+#include <iostream>
+#include <thread>
+
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QPointer>
+
+#ifdef Q_OS_UNIX
+#include <QDir>
+#include <QFile>
+#endif
+
+#include "async/async.h"
+
+#include "convertercodes.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::converter;
+
+static const QString JOB_CONVERT("convert");
+static const QString JOB_CONVERT_PARTS("parts");
+static const QString JOB_EXPORT_MEDIA("media");
+static const QString JOB_EXPORT_META("meta");
+static const QString JOB_EXPORT_PARTS("partsJson");
+static const QString JOB_EXPORT_PARTS_PDFS("partsPdfs");
+static const QString JOB_EXPORT_TRANSPOSE("transpose");
+static const QString JOB_UPDATE_SOURCE("sourceUpdate");
+static const QString JOB_STATS("stats");
+static const QString JOB_QUIT("quit");
+
+template<typename Duration>
+static qint64 toMsec(const Duration& d)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+}
+
+ConverterDaemon::ConverterDaemon(IConverterController* controller)
+    : m_controller(controller)
+{
+}
+
+ConverterDaemon::~ConverterDaemon()
+{
+    delete m_server;
+}
+
+Ret ConverterDaemon::run(const std::string& serverName)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(m_controller) {
+        return make_ret(Err::UnknownError);
+    }
+
+    m_stats = Stats();
+    m_stats.startTime = Clock::now();
+
+    if (serverName.empty()) {
+        startReadStdin();
+    } else {
+        Ret ret = listen(serverName);
+        if (!ret) {
+            return ret;
+        }
+    }
+
+    LOGI() << "converter daemon started, " << (serverName.empty() ? std::string("stdin") : serverName);
+
+    m_loop.exec();
+
+    LOGI() << "converter daemon finished, stats: " << QJsonDocument(statsJson()).toJson(QJsonDocument::Compact).constData();
+
+    return make_ret(Ret::Code::Ok);
+}
+
+Ret ConverterDaemon::listen(const std::string& serverName)
+{
+    const QString name = QString::fromStdString(serverName);
+
+    m_server = new QLocalServer();
+    bool ok = m_server->listen(name);
+
+#ifdef Q_OS_UNIX
+    //! NOTE The socket file of a crashed daemon can remain
+    if (!ok && m_server->serverError() == QAbstractSocket::AddressInUseError) {
+        QFile::remove(QDir::cleanPath(QDir::tempPath()) + QLatin1Char('/') + name);
+        ok = m_server->listen(name);
+    }
+#endif
+
+    if (!ok) {
+        LOGE() << "failed listen: " << m_server->errorString();
+        return make_ret(Err::DaemonFailedListen, m_server->errorString().toStdString());
+    }
+
+    QObject::connect(m_server, &QLocalServer::newConnection, [this]() {
+        while (QLocalSocket* socket = m_server->nextPendingConnection()) {
+            QObject::connect(socket, &QLocalSocket::readyRead, [this, socket]() {
+                onSocketReadyRead(socket);
+            });
+
+            QObject::connect(socket, &QLocalSocket::disconnected, socket, &QLocalSocket::deleteLater);
+        }
+    });
+
+    return make_ret(Ret::Code::Ok);
+}
+
+void ConverterDaemon::startReadStdin()
+{
+    m_stdinLineReceived.onReceive(this, [this](const std::string& line) {
+        onLineReceived(QByteArray::fromStdString(line), [](const QByteArray& data) {
+            std::cout << data.constData() << std::endl;
+        });
+    }, Asyncable::AsyncMode::AsyncSetRepeat);
+
+    m_stdinFinished.onNotify(this, [this]() {
+        m_isInputFinished = true;
+        scheduleJobs();
+    }, Asyncable::AsyncMode::AsyncSetRepeat);
+
+    async::Channel<std::string> lineReceived = m_stdinLineReceived;
+    async::Notification finished = m_stdinFinished;
+
+    //! NOTE Reading of the stdin blocks and can't be interrupted,
+    //! so it's done on a detached thread, lines are delivered to the main thread
+    std::thread([lineReceived, finished]() mutable {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            lineReceived.send(line);
+        }
+
+        finished.notify();
+    }).detach();
+}
+
+void ConverterDaemon::onSocketReadyRead(QLocalSocket* socket)
+{
+    QPointer<QLocalSocket> socketPtr(socket);
+    Reply reply = [socketPtr](const QByteArray& data) {
+        if (socketPtr && socketPtr->state() == QLocalSocket::ConnectedState) {
+            socketPtr->write(data);
+            socketPtr->write("\n");
+            socketPtr->flush();
+        }
+    };
+
+    while (socket->canReadLine()) {
+        onLineReceived(socket->readLine(), reply);
+    }
+}
+
+void ConverterDaemon::onLineReceived(const QByteArray& line, const Reply& reply)
+{
+    const QByteArray data = line.trimmed();
+    if (data.isEmpty()) {
+        return;
+    }
+
+    QJsonParseError err;
+    QJsonDocument doc = QJsonDocument::fromJson(data, &err);
+    if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+        LOGE() << "failed parse job: " << err.errorString() << ", data: " << data;
+
+        Ret ret = make_ret(Err::DaemonJobFailedParse, err.errorString().toStdString());
+
+        QJsonObject answer;
+        answer["ok"] = false;
+        answer["code"] = ret.code();
+        answer["error"] = QString::fromStdString(ret.text());
+        reply(QJsonDocument(answer).toJson(QJsonDocument::Compact));
+        return;
+    }
+
+    QJsonObject request = doc.object();
+    const QString type = request["type"].toString(JOB_CONVERT);
+
+    //! NOTE The service requests are answered at once, not after the queued jobs
+    if (type == JOB_STATS) {
+        QJsonObject answer;
+        answer["id"] = request["id"];
+        answer["ok"] = true;
+        answer["stats"] = statsJson();
+        reply(QJsonDocument(answer).toJson(QJsonDocument::Compact));
+        return;
+    }
+
+    if (type == JOB_QUIT) {
+        m_isQuitRequested = true;
+        scheduleJobs();
+        return;
+    }
+
+    m_stats.received++;
+
+    Job job;
+    job.request = request;
+    job.reply = reply;
+    job.receivedTime = Clock::now();
+    m_jobs.push_back(std::move(job));
+
+    scheduleJobs();
+}
+
+void ConverterDaemon::scheduleJobs()
+{
+    if (m_isProcessScheduled) {
+        return;
+    }
+
+    //! NOTE Return to the event loop before processing, so that the lines already received are queued first
+    m_isProcessScheduled = true;
+    async::Async::call(this, [this]() {
+        m_isProcessScheduled = false;
+        processJobs();
+    });
+}
+
+void ConverterDaemon::processJobs()
+{
+    //! NOTE The engraving core has process wide state (fonts, styles, MScore globals),
+    //! so jobs are processed one by one on the main thread, the pages of a job are written in parallel
+    while (!m_jobs.empty()) {
+        Job job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+
+        const Clock::time_point startTime = Clock::now();
+        Ret ret = processJob(job.request);
+        const Clock::time_point finishTime = Clock::now();
+
+        if (ret) {
+            m_stats.succeeded++;
+        } else {
+            m_stats.failed++;
+            LOGE() << "failed job: " << job.request["id"].toString() << ", err: " << ret.toString();
+        }
+
+        const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(finishTime - job.receivedTime);
+        const auto processTime = std::chrono::duration_cast<std::chrono::microseconds>(finishTime - startTime);
+        m_stats.totalLatency += latency;
+        m_stats.totalProcessTime += processTime;
+        m_stats.maxLatency = std::max(m_stats.maxLatency, latency);
+
+        QJsonObject answer;
+        answer["id"] = job.request["id"];
+        answer["ok"] = ret.success();
+        answer["code"] = ret.code();
+        answer["error"] = QString::fromStdString(ret.text());
+        answer["queueMs"] = toMsec(startTime - job.receivedTime);
+        answer["processMs"] = toMsec(processTime);
+        job.reply(QJsonDocument(answer).toJson(QJsonDocument::Compact));
+
+        //! NOTE Let the new lines and the socket replies be handled between the jobs
+        if (!m_jobs.empty()) {
+            scheduleJobs();
+            return;
+        }
+    }
+
+    if (m_isQuitRequested || m_isInputFinished) {
+        quit();
+    }
+}
+
+Ret ConverterDaemon::processJob(const QJsonObject& request)
+{
+    TRACEFUNC;
+
+    const QString type = request["type"].toString(JOB_CONVERT);
+    const io::path in = request["in"].toString();
+    const io::path out = request["out"].toString();
+    const io::path stylePath = request["style"].toString();
+    const bool forceMode = request["force"].toBool(false);
+
+    if (type == JOB_CONVERT) {
+        return m_controller->fileConvert(in, out, stylePath, forceMode);
+    }
+
+    if (type == JOB_CONVERT_PARTS) {
+        return m_controller->convertScoreParts(in, out, stylePath, forceMode);
+    }
+
+    if (type == JOB_EXPORT_MEDIA) {
+        const io::path highlightConfigPath = request["highlightConfig"].toString();
+        return m_controller->exportScoreMedia(in, out, highlightConfigPath, stylePath, forceMode);
+    }
+
+    if (type == JOB_EXPORT_META) {
+        return m_controller->exportScoreMeta(in, out, stylePath, forceMode);
+    }
+
+    if (type == JOB_EXPORT_PARTS) {
+        return m_controller->exportScoreParts(in, out, stylePath, forceMode);
+    }
+
+    if (type == JOB_EXPORT_PARTS_PDFS) {
+        return m_controller->exportScorePartsPdfs(in, out, stylePath, forceMode);
+    }
+
+    if (type == JOB_EXPORT_TRANSPOSE) {
+        const QJsonValue optionsValue = request["options"];
+        const std::string options = optionsValue.isObject()
+                                    ? QJsonDocument(optionsValue.toObject()).toJson(QJsonDocument::Compact).toStdString()
+                                    : optionsValue.toString().toStdString();
+        return m_controller->exportScoreTranspose(in, out, options, stylePath, forceMode);
+    }
+
+    if (type == JOB_UPDATE_SOURCE) {
+        return m_controller->updateSource(in, request["source"].toString().toStdString(), forceMode);
+    }
+
+    return make_ret(Err::DaemonJobTypeUnknown, type.toStdString());
+}
+
+QJsonObject ConverterDaemon::statsJson() const
+{
+    const size_t processed = m_stats.succeeded + m_stats.failed;
+    const double uptimeSec = std::chrono::duration<double>(Clock::now() - m_stats.startTime).count();
+
+    QJsonObject stats;
+    stats["received"] = static_cast<qint64>(m_stats.received);
+    stats["queued"] = static_cast<qint64>(m_jobs.size());
+    stats["succeeded"] = static_cast<qint64>(m_stats.succeeded);
+    stats["failed"] = static_cast<qint64>(m_stats.failed);
+    stats["uptimeSec"] = uptimeSec;
+    stats["jobsPerSec"] = uptimeSec > 0.0 ? processed / uptimeSec : 0.0;
+    stats["avgLatencyMs"] = processed > 0 ? toMsec(m_stats.totalLatency / processed) : 0;
+    stats["maxLatencyMs"] = toMsec(m_stats.maxLatency);
+    stats["avgProcessMs"] = processed > 0 ? toMsec(m_stats.totalProcessTime / processed) : 0;
+
+    return stats;
+}
+
+void ConverterDaemon::quit()
+{
+    if (m_server) {
+        m_server->close();
+    }
+
+    m_loop.quit();
+}
@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_CONVERTERDAEMON_H
+#define MU_CONVERTER_CONVERTERDAEMON_H
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <string>
+
+#include <QByteArray>
+#include <QEventLoop>
+#include <QJsonObject>
+
+#include "async/asyncable.h"
+#include "async/channel.h"
+#include "async/notification.h"
+#include "ret.h"
+
+#include "../iconvertercontroller.h"
+
+class QLocalServer;
+class QLocalSocket;
+
+namespace mu::converter {
+//! NOTE Long running converter, the process stays warm (fonts, styles, templates are loaded once)
+//! and takes jobs as JSON lines, from the stdin or from a local socket.
+//! Every job is converted in its own project, a failed job doesn't stop the daemon.
+//!
+//! Job: { "id": "1", "type": "convert", "in": "a.mscz", "out": "a.pdf", "style": "", "force": false }
+//! Types: convert, parts, media, meta, partsJson, partsPdfs, transpose, sourceUpdate, stats, quit
+//! Reply: { "id": "1", "ok": true, "code": 0, "error": "", "queueMs": 0, "processMs": 0 }
+class ConverterDaemon : public async::Asyncable
+{
+public:
+    explicit ConverterDaemon(IConverterController* controller);
+    ~ConverterDaemon();
+
+    //! NOTE Blocks until the quit job or the end of the input.
+    //! If the server name is empty, jobs are read from the stdin and replies are written to the stdout
+    Ret run(const std::string& serverName = std::string());
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using Reply = std::function<void (const QByteArray&)>;
+
+    struct Job {
+        QJsonObject request;
+        Reply reply;
+        Clock::time_point receivedTime;
+    };
+
+    struct Stats {
+        Clock::time_point startTime;
+        size_t received = 0;
+        size_t succeeded = 0;
+        size_t failed = 0;
+        std::chrono::microseconds totalLatency { 0 };
+        std::chrono::microseconds maxLatency { 0 };
+        std::chrono::microseconds totalProcessTime { 0 };
+    };
+
+    Ret listen(const std::string& serverName);
+    void startReadStdin();
+    void onSocketReadyRead(QLocalSocket* socket);
+
+    void onLineReceived(const QByteArray& line, const Reply& reply);
+    void scheduleJobs();
+    void processJobs();
+    Ret processJob(const QJsonObject& request);
+
+    QJsonObject statsJson() const;
+    void quit();
+
+    IConverterController* m_controller = nullptr;
+
+    QEventLoop m_loop;
+    QLocalServer* m_server = nullptr;
+
+    async::Channel<std::string> m_stdinLineReceived;
+    async::Notification m_stdinFinished;
+    bool m_isInputFinished = false;
+
+    std::deque<Job> m_jobs;
+    bool m_isProcessScheduled = false;
+    bool m_isQuitRequested = false;
+
+    Stats m_stats;
+};
+}
+
+#endif // MU_CONVERTER_CONVERTERDAEMON_H
@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pageswriter.h"
+
+#include <algorithm>
+#include <deque>
+
+#include <QBuffer>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/page.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::converter;
+using namespace mu::project;
+using namespace mu::notation;
+
+//! NOTE Number of pages queued per thread, ahead of the page being handled
+static constexpr int PAGES_AHEAD_PER_THREAD = 2;
+
+void PagesWriter::write(INotationWriterPtr writer, INotationPtr notation, const INotationWriter::Options& options,
+                        const PageHandler& onPageWritten)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(writer && notation && onPageWritten) {
+        return;
+    }
+
+    const QList<Ms::Page*>& pages = notation->elements()->msScore()->pages();
+    const int pageCount = pages.size();
+
+    auto writePage = [writer, notation](int pageIndex, const INotationWriter::Options& unitOptions) {
+        INotationWriter::Options pageOptions = unitOptions;
+        pageOptions[INotationWriter::OptionKey::PAGE_NUMBER] = Val(pageIndex);
+
+        PageData pageData;
+        QBuffer device(&pageData.val);
+        device.open(QIODevice::WriteOnly);
+
+        pageData.ret = writer->write(notation, device, pageOptions);
+
+        device.close();
+
+        return pageData;
+    };
+
+    const int threadCount = std::min(configuration()->exportThreadCount(), pageCount);
+    if (threadCount <= 1) {
+        for (int i = 0; i < pageCount; ++i) {
+            onPageWritten(i, writePage(i, options));
+        }
+
+        return;
+    }
+
+    //! NOTE The element trees of the pages are built on demand,
+    //! so build them here, before the pages are painted from several threads
+    for (Ms::Page* page : pages) {
+        page->items(page->bbox());
+    }
+
+    //! NOTE The shared state (ex. the paint state of the score) is set here,
+    //! the pages don't change it
+    writer->prepareUnits(notation, options);
+
+    INotationWriter::Options pageOptions = options;
+    pageOptions[INotationWriter::OptionKey::UNITS_PREPARED] = Val(true);
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount);
+
+    const int maxQueuedPages = threadCount * PAGES_AHEAD_PER_THREAD;
+
+    std::deque<QFuture<PageData> > queuedPages;
+    int nextPageIndex = 0;
+
+    for (int i = 0; i < pageCount; ++i) {
+        while (nextPageIndex < pageCount && static_cast<int>(queuedPages.size()) < maxQueuedPages) {
+            queuedPages.push_back(QtConcurrent::run(&threadPool, writePage, nextPageIndex, pageOptions));
+            ++nextPageIndex;
+        }
+
+        QFuture<PageData> page = queuedPages.front();
+        queuedPages.pop_front();
+
+        onPageWritten(i, page.result());
+    }
+
+    threadPool.waitForDone();
+
+    writer->finishUnits(notation);
+}
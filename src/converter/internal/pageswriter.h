@@ -0,0 +1,54 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_PAGESWRITER_H
+#define MU_CONVERTER_PAGESWRITER_H
+
+#include <functional>
+
+#include <QByteArray>
+
+#include "retval.h"
+
+#include "modularity/ioc.h"
+#include "project/inotationwriter.h"
+#include "../iconverterconfiguration.h"
+
+namespace mu::converter {
+//! NOTE Writes every page of the notation to its own buffer.
+//! The pages are written at the same time on a thread pool,
+//! each writer call has its own paint device, so only the score is shared (read only).
+class PagesWriter
+{
+    INJECT_STATIC(converter, IConverterConfiguration, configuration)
+
+public:
+    using PageData = RetVal<QByteArray>;
+    using PageHandler = std::function<void (int pageIndex, const PageData& page)>;
+
+    //! NOTE The handler is called on the calling thread in the page order, the page data is released after it,
+    //! only a few pages per thread are kept in memory at once
+    static void write(project::INotationWriterPtr writer, notation::INotationPtr notation,
+                      const project::INotationWriter::Options& options, const PageHandler& onPageWritten);
+};
+}
+
+#endif // MU_CONVERTER_PAGESWRITER_H
@@ -33,6 +33,7 @@ using namespace mu::diagnostics;
 
 void EngravingElementsProvider::clearStatistic()
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_statistics.clear();
 }
 
@@ -49,6 +50,8 @@ void EngravingElementsProvider::printStatistic(const std::string& title)
 
     int regCountTotal = 0;
     int unregCountTotal = 0;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
     for (auto it = m_statistics.begin(); it != m_statistics.end(); ++it) {
         const ObjectStatistic& s = it->second;
         stream << FORMAT(it->first, 20)
@@ -69,6 +72,7 @@ void EngravingElementsProvider::printStatistic(const std::string& title)
 void EngravingElementsProvider::reg(const Ms::EngravingObject* e)
 {
     TRACEFUNC;
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_elements.insert(e);
     m_statistics[e->name()].regCount++;
 }
@@ -76,6 +80,7 @@ void EngravingElementsProvider::reg(const Ms::EngravingObject* e)
 void EngravingElementsProvider::unreg(const Ms::EngravingObject* e)
 {
     TRACEFUNC;
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_elements.erase(e);
     m_statistics[e->name()].unregCount++;
 }
@@ -24,6 +24,7 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 
 #include "../iengravingelementsprovider.h"
 
@@ -66,6 +67,8 @@ private:
         int unregCount = 0;
     };
 
+    //! NOTE The elements are created and deleted from several threads, when the parts are laid out in parallel
+    std::mutex m_mutex;
     std::map<std::string, ObjectStatistic> m_statistics;
 
     EngravingObjectList m_elements;
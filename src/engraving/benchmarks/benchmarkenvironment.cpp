@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "testing/environment.h"
+
+#include "engraving/engravingmodule.h"
+#include "framework/fonts/fontsmodule.h"
+#include "framework/mpe/mpemodule.h"
+
+#include "libmscore/masterscore.h"
+#include "libmscore/musescoreCore.h"
+
+//! NOTE Shared by the benchmarks and the vtest runner, set up by Environment::setup() in main
+static mu::testing::SuiteEnvironment engraving_be(
+{
+    new mu::fonts::FontsModule(),
+    new mu::mpe::MpeModule(),
+    new mu::engraving::EngravingModule()
+},
+    []() {
+    Ms::MScore::testMode = true;
+    Ms::MScore::noGui = true;
+
+    new Ms::MuseScoreCore;
+    Ms::MScore* mscore = new Ms::MScore();
+    mscore->init();
+
+    Ms::loadInstrumentTemplates(":/data/instruments.xml");
+}
+    );
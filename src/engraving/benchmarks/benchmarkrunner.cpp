@@ -0,0 +1,192 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "benchmarkrunner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+
+#include "benchmarkutils.h"
+
+#include "log.h"
+
+using namespace mu::engraving::benchmarks;
+
+BenchmarkState::BenchmarkState(int iterations)
+    : m_iterations(iterations)
+{
+    m_times.reserve(iterations);
+}
+
+int BenchmarkState::iterations() const
+{
+    return m_iterations;
+}
+
+void BenchmarkState::skip(const QString& reason)
+{
+    m_skipReason = reason;
+}
+
+bool BenchmarkState::skipped() const
+{
+    return !m_skipReason.isEmpty();
+}
+
+const QString& BenchmarkState::skipReason() const
+{
+    return m_skipReason;
+}
+
+const std::vector<double>& BenchmarkState::times() const
+{
+    return m_times;
+}
+
+void BenchmarkRunner::addBenchmark(const QString& name, const Benchmark& benchmark)
+{
+    m_benchmarks.push_back({ name, benchmark });
+}
+
+BenchmarkRunner::Result BenchmarkRunner::makeResult(const QString& benchmark, const QString& scorePath, const BenchmarkState& state)
+{
+    Result result;
+    result.benchmark = benchmark;
+    result.score = QFileInfo(scorePath).fileName();
+    result.name = benchmark + "/" + result.score;
+    result.skipReason = state.skipReason();
+
+    std::vector<double> times = state.times();
+    result.iterations = static_cast<int>(times.size());
+    if (times.empty()) {
+        return result;
+    }
+
+    std::sort(times.begin(), times.end());
+    const double n = static_cast<double>(times.size());
+
+    result.min = times.front();
+    result.max = times.back();
+    result.mean = std::accumulate(times.begin(), times.end(), 0.0) / n;
+    result.median = times.size() % 2
+                    ? times[times.size() / 2]
+                    : (times[times.size() / 2 - 1] + times[times.size() / 2]) / 2.0;
+
+    double variance = 0.0;
+    for (double t : times) {
+        variance += (t - result.mean) * (t - result.mean);
+    }
+    result.stddev = std::sqrt(variance / n);
+
+    return result;
+}
+
+int BenchmarkRunner::run(const Options& options)
+{
+    const QStringList files = scoreFiles(options.corpus);
+    if (files.isEmpty()) {
+        LOGE() << "no scores to run the benchmarks on";
+        return 1;
+    }
+
+    std::vector<Result> results;
+    for (const auto& benchmark : m_benchmarks) {
+        for (const QString& file : files) {
+            const QString name = benchmark.first + "/" + QFileInfo(file).fileName();
+            if (!options.filter.isEmpty() && !name.contains(options.filter)) {
+                continue;
+            }
+
+            BenchmarkState state(options.iterations);
+            benchmark.second(file, state);
+
+            Result result = makeResult(benchmark.first, file, state);
+            if (state.skipped()) {
+                LOGI() << name << ": skipped, " << result.skipReason;
+            } else {
+                LOGI() << name << ": " << result.mean << " ms (min " << result.min << ", max " << result.max << ")";
+            }
+            results.push_back(std::move(result));
+        }
+    }
+
+    return writeJson(results, options) ? 0 : 1;
+}
+
+bool BenchmarkRunner::writeJson(const std::vector<Result>& results, const Options& options)
+{
+    QJsonObject context;
+    context["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    context["executable"] = QCoreApplication::applicationFilePath();
+    context["host_name"] = QSysInfo::machineHostName();
+    context["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+    context["iterations"] = options.iterations;
+#ifdef NDEBUG
+    context["build_type"] = "release";
+#else
+    context["build_type"] = "debug";
+#endif
+
+    QJsonArray benchmarks;
+    for (const Result& r : results) {
+        QJsonObject obj;
+        obj["name"] = r.name;
+        obj["benchmark"] = r.benchmark;
+        obj["score"] = r.score;
+        obj["iterations"] = r.iterations;
+        obj["time_unit"] = "ms";
+        obj["mean"] = r.mean;
+        obj["median"] = r.median;
+        obj["min"] = r.min;
+        obj["max"] = r.max;
+        obj["stddev"] = r.stddev;
+        if (!r.skipReason.isEmpty()) {
+            obj["skipped"] = r.skipReason;
+        }
+        benchmarks.append(obj);
+    }
+
+    QJsonObject root;
+    root["context"] = context;
+    root["benchmarks"] = benchmarks;
+
+    const QByteArray json = QJsonDocument(root).toJson();
+
+    QFile file(options.outputPath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open file: " << options.outputPath;
+        return false;
+    }
+    file.write(json);
+
+    LOGI() << "results: " << options.outputPath;
+    return true;
+}
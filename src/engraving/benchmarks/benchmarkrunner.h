@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_BENCHMARKRUNNER_H
+#define MU_ENGRAVING_BENCHMARKRUNNER_H
+
+#include <functional>
+#include <vector>
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QStringList>
+
+namespace mu::engraving::benchmarks {
+//! NOTE Collects the times of the measured parts of a benchmark,
+//! the preparation between the measures is not counted
+class BenchmarkState
+{
+public:
+    explicit BenchmarkState(int iterations);
+
+    int iterations() const;
+
+    template<typename Func>
+    void measure(Func&& func)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        func();
+        m_times.push_back(static_cast<double>(timer.nsecsElapsed()) / 1000000.0);
+    }
+
+    void skip(const QString& reason);
+    bool skipped() const;
+    const QString& skipReason() const;
+
+    const std::vector<double>& times() const;
+
+private:
+    int m_iterations = 0;
+    std::vector<double> m_times;
+    QString m_skipReason;
+};
+
+//! NOTE Runs every benchmark over every score of the corpus
+//! and writes the results as JSON (similar to the Google Benchmark output)
+class BenchmarkRunner
+{
+public:
+    using Benchmark = std::function<void (const QString& scorePath, BenchmarkState& state)>;
+
+    struct Options {
+        int iterations = 5;
+        QString filter;
+        QString outputPath = "engraving_benchmarks.json";
+        QStringList corpus;
+    };
+
+    void addBenchmark(const QString& name, const Benchmark& benchmark);
+
+    int run(const Options& options);
+
+private:
+    struct Result {
+        QString name;
+        QString benchmark;
+        QString score;
+        int iterations = 0;
+        double mean = 0.0;
+        double median = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        double stddev = 0.0;
+        QString skipReason;
+    };
+
+    static Result makeResult(const QString& benchmark, const QString& scorePath, const BenchmarkState& state);
+    static bool writeJson(const std::vector<Result>& results, const Options& options);
+
+    std::vector<std::pair<QString, Benchmark> > m_benchmarks;
+};
+}
+
+#endif // MU_ENGRAVING_BENCHMARKRUNNER_H
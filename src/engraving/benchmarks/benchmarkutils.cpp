@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "benchmarkutils.h"
+
+#include <QBuffer>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#include "engraving/compat/mscxcompat.h"
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/infrastructure/io/mscreader.h"
+#include "engraving/rw/scorereader.h"
+
+#include "engraving/libmscore/masterscore.h"
+
+#include "log.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+QStringList mu::engraving::benchmarks::scoreFiles(const QStringList& corpus)
+{
+    static const QStringList SCORE_FILTERS = { "*.mscz", "*.mscx" };
+
+    QStringList files;
+    for (const QString& path : corpus) {
+        QFileInfo fi(path);
+        if (fi.isDir()) {
+            QStringList dirFiles;
+            QDirIterator it(path, SCORE_FILTERS, QDir::Files, QDirIterator::Subdirectories);
+            while (it.hasNext()) {
+                dirFiles << it.next();
+            }
+            dirFiles.sort();
+            files << dirFiles;
+        } else if (fi.exists()) {
+            files << fi.absoluteFilePath();
+        } else {
+            LOGW() << "not found: " << path;
+        }
+    }
+    return files;
+}
+
+bool mu::engraving::benchmarks::readMsczData(const QString& path, QByteArray* data)
+{
+    if (path.endsWith(".mscx", Qt::CaseInsensitive)) {
+        return compat::mscxToMscz(path, data) == Score::FileError::FILE_NO_ERROR;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    *data = file.readAll();
+    return true;
+}
+
+MasterScore* mu::engraving::benchmarks::loadScore(const QString& path, const QByteArray& msczData)
+{
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+    score->setName(QFileInfo(path).completeBaseName());
+
+    QByteArray data = msczData;
+    QBuffer buf(&data);
+    MscReader::Params params;
+    params.device = &buf;
+    params.filePath = path;
+    params.mode = MscIoMode::Zip;
+
+    MscReader reader(params);
+    reader.open();
+
+    if (ScoreReader().loadMscz(score, reader, true) != Err::NoError) {
+        delete score;
+        return nullptr;
+    }
+
+    return score;
+}
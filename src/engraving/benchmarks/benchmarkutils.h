@@ -0,0 +1,42 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_BENCHMARKUTILS_H
+#define MU_ENGRAVING_BENCHMARKUTILS_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+namespace Ms {
+class MasterScore;
+}
+
+namespace mu::engraving::benchmarks {
+//! NOTE The score files of the corpus, the directories are searched recursively
+QStringList scoreFiles(const QStringList& corpus);
+
+//! NOTE Reads the file as mscz data (mscx is packed), so the loading can be repeated without the file access
+bool readMsczData(const QString& path, QByteArray* data);
+Ms::MasterScore* loadScore(const QString& path, const QByteArray& msczData);
+}
+
+#endif // MU_ENGRAVING_BENCHMARKUTILS_H
@@ -0,0 +1,347 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "engravingbenchmarks.h"
+
+#include <memory>
+
+#include <QBuffer>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+
+#include "async/channel.h"
+
+#include "engraving/compat/midi/event.h"
+#include "engraving/compat/mscxcompat.h"
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/infrastructure/io/mscreader.h"
+#include "engraving/infrastructure/io/mscwriter.h"
+#include "engraving/rw/scorereader.h"
+
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/note.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/scorediff.h"
+#include "engraving/libmscore/structuralscorediff.h"
+
+#include "engraving/paint/paint.h"
+#include "engraving/utests/utils/scoregenerator.h"
+#include "engraving/utests/utils/scoreutils.h"
+#include "engraving/playback/playbackmodel.h"
+
+#include "benchmarkutils.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmarks;
+using namespace Ms;
+
+//! NOTE The pages are painted downscaled, the painting cost doesn't depend much on the image size
+static constexpr qreal PAINT_SCALE = 0.5;
+
+static std::unique_ptr<MasterScore> loadScore(const QString& path, BenchmarkState& state)
+{
+    QByteArray msczData;
+    if (!readMsczData(path, &msczData)) {
+        state.skip("can't read the file");
+        return nullptr;
+    }
+
+    std::unique_ptr<MasterScore> score(loadScore(path, msczData));
+    if (!score) {
+        state.skip("can't load the score");
+        return nullptr;
+    }
+
+    score->doLayout();
+    return score;
+}
+
+static void loadBenchmark(const QString& path, BenchmarkState& state)
+{
+    QByteArray msczData;
+    if (!readMsczData(path, &msczData)) {
+        state.skip("can't read the file");
+        return;
+    }
+
+    for (int i = 0; i < state.iterations(); ++i) {
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        score->setName(QFileInfo(path).completeBaseName());
+
+        QBuffer buf(&msczData);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = path;
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        Err err = Err::NoError;
+        state.measure([&]() {
+            err = ScoreReader().loadMscz(score, reader, true);
+        });
+
+        delete score;
+
+        if (err != Err::NoError) {
+            state.skip("can't load the score");
+            return;
+        }
+    }
+}
+
+static void layoutBenchmark(const QString& path, BenchmarkState& state)
+{
+    std::unique_ptr<MasterScore> score = loadScore(path, state);
+    if (!score) {
+        return;
+    }
+
+    for (int i = 0; i < state.iterations(); ++i) {
+        state.measure([&]() {
+            score->doLayoutRange(Fraction(0, 1), Fraction(-1, 1));
+        });
+    }
+}
+
+static void editRelayoutBenchmark(const QString& path, BenchmarkState& state)
+{
+    std::unique_ptr<MasterScore> score = loadScore(path, state);
+    if (!score) {
+        return;
+    }
+
+    Note* note = ScoreUtils::firstNote(score.get());
+    if (!note) {
+        state.skip("no notes");
+        return;
+    }
+
+    const int pitch = note->pitch();
+    for (int i = 0; i < state.iterations(); ++i) {
+        state.measure([&]() {
+            score->startCmd();
+            note->undoChangeProperty(Pid::PITCH, pitch < 127 ? pitch + 1 : pitch - 1);
+            score->endCmd();
+        });
+
+        score->undoRedo(true, nullptr);
+    }
+}
+
+static void midiRenderBenchmark(const QString& path, BenchmarkState& state)
+{
+    std::unique_ptr<MasterScore> score = loadScore(path, state);
+    if (!score) {
+        return;
+    }
+
+    for (int i = 0; i < state.iterations(); ++i) {
+        EventMap events;
+        state.measure([&]() {
+            score->renderMidi(&events, score->synthesizerState());
+        });
+    }
+}
+
+static void playbackModelBenchmark(const QString& path, BenchmarkState& state)
+{
+    std::unique_ptr<MasterScore> score = loadScore(path, state);
+    if (!score) {
+        return;
+    }
+
+    async::Channel<int, int, int, int> notationChangesRangeChannel;
+    for (int i = 0; i < state.iterations(); ++i) {
+        PlaybackModel model;
+        state.measure([&]() {
+            model.load(score.get(), notationChangesRangeChannel);
+        });
+    }
+}
+
+static void paintBenchmark(const QString& path, BenchmarkState& state)
+{
+    std::unique_ptr<MasterScore> score = loadScore(path, state);
+    if (!score) {
+        return;
+    }
+
+    const QList<Page*>& pages = score->pages();
+    std::vector<QImage> images;
+    for (const Page* page : pages) {
+        const RectF rect = page->bbox();
+        QImage image(static_cast<int>(rect.width() * PAINT_SCALE), static_cast<int>(rect.height() * PAINT_SCALE),
+                     QImage::Format_ARGB32_Premultiplied);
+        images.push_back(std::move(image));
+    }
+
+    for (int i = 0; i < state.iterations(); ++i) {
+        for (QImage& image : images) {
+            image.fill(Qt::white);
+        }
+
+        state.measure([&]() {
+            for (int p = 0; p < pages.size(); ++p) {
+                draw::Painter painter(&images[p], "benchmark");
+                painter.setAntialiasing(true);
+                painter.scale(PAINT_SCALE, PAINT_SCALE);
+
+                QList<EngravingItem*> elements = pages.at(p)->elements();
+                Paint::paintElements(painter, elements);
+                painter.endDraw();
+            }
+        });
+    }
+}
+
+static void saveBenchmark(const QString& path, BenchmarkState& state)
+{
+    std::unique_ptr<MasterScore> score = loadScore(path, state);
+    if (!score) {
+        return;
+    }
+
+    for (int i = 0; i < state.iterations(); ++i) {
+        QByteArray data;
+        bool ok = false;
+        state.measure([&]() {
+            QBuffer buf(&data);
+            MscWriter::Params params;
+            params.device = &buf;
+            params.filePath = score->name() + ".mscz";
+            params.mode = MscIoMode::Zip;
+
+            MscWriter writer(params);
+            writer.open();
+            ok = score->writeMscz(writer, false, false);
+            writer.close();
+        });
+
+        if (!ok) {
+            state.skip("can't save the score");
+            return;
+        }
+    }
+}
+
+template<typename Diff>
+static void scoreDiffBenchmark(const QString& path, BenchmarkState& state)
+{
+    std::unique_ptr<MasterScore> score1 = loadScore(path, state);
+    std::unique_ptr<MasterScore> score2 = loadScore(path, state);
+    if (!score1 || !score2) {
+        return;
+    }
+
+    Note* note = ScoreUtils::firstNote(score2.get());
+    if (!note) {
+        state.skip("no notes");
+        return;
+    }
+
+    score2->startCmd();
+    note->undoChangeProperty(Pid::PITCH, note->pitch() < 127 ? note->pitch() + 1 : note->pitch() - 1);
+    score2->endCmd();
+
+    for (int i = 0; i < state.iterations(); ++i) {
+        state.measure([&]() {
+            Diff diff(score1.get(), score2.get());
+        });
+    }
+}
+
+void mu::engraving::benchmarks::registerEngravingBenchmarks(BenchmarkRunner& runner)
+{
+    runner.addBenchmark("load", loadBenchmark);
+    runner.addBenchmark("layout", layoutBenchmark);
+    runner.addBenchmark("edit_relayout", editRelayoutBenchmark);
+    runner.addBenchmark("midi_render", midiRenderBenchmark);
+    runner.addBenchmark("playback_model", playbackModelBenchmark);
+    runner.addBenchmark("paint", paintBenchmark);
+    runner.addBenchmark("save", saveBenchmark);
+    runner.addBenchmark("text_score_diff", scoreDiffBenchmark<ScoreDiff>);
+    runner.addBenchmark("structural_score_diff", scoreDiffBenchmark<StructuralScoreDiff>);
+}
+
+bool mu::engraving::benchmarks::generateScalingScores(const QString& dirPath)
+{
+    ScoreGenerator::Params base;
+    base.staves = 8;
+    base.measures = 100;
+    base.notesPerMeasure = 4;
+
+    std::vector<ScoreGenerator::Params> series { base };
+    auto addSeries = [&](int ScoreGenerator::Params::* param, std::initializer_list<int> values) {
+        for (int value : values) {
+            ScoreGenerator::Params params = base;
+            params.*param = value;
+            series.push_back(params);
+        }
+    };
+
+    addSeries(&ScoreGenerator::Params::staves, { 1, 4, 16, 60 });
+    addSeries(&ScoreGenerator::Params::measures, { 50, 200, 800, 2000 });
+    addSeries(&ScoreGenerator::Params::notesPerMeasure, { 1, 2, 8, 16 });
+    addSeries(&ScoreGenerator::Params::tupletsEvery, { 4, 1 });
+    addSeries(&ScoreGenerator::Params::spannersEvery, { 4, 1 });
+
+    for (bool ScoreGenerator::Params::* feature : { &ScoreGenerator::Params::lyrics, &ScoreGenerator::Params::chordSymbols,
+                                                     &ScoreGenerator::Params::parts, &ScoreGenerator::Params::linkedStaves }) {
+        ScoreGenerator::Params params = base;
+        params.*feature = true;
+        series.push_back(params);
+    }
+
+    //! NOTE The size of the scores we see the scaling problems with
+    ScoreGenerator::Params large = base;
+    large.staves = 60;
+    large.measures = 2000;
+    series.push_back(large);
+
+    QDir dir(dirPath);
+    if (!dir.mkpath(".")) {
+        LOGE() << "can't create the dir: " << dirPath;
+        return false;
+    }
+
+    bool ok = true;
+    for (const ScoreGenerator::Params& params : series) {
+        const QString path = dir.filePath(params.name() + ".mscz");
+
+        std::unique_ptr<MasterScore> score(ScoreGenerator::generate(params));
+        if (!ScoreGenerator::writeMscz(score.get(), path)) {
+            LOGE() << "can't write: " << path;
+            ok = false;
+            continue;
+        }
+
+        LOGI() << "generated: " << path;
+    }
+
+    return ok;
+}
@@ -0,0 +1,35 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_ENGRAVINGBENCHMARKS_H
+#define MU_ENGRAVING_ENGRAVINGBENCHMARKS_H
+
+#include "benchmarkrunner.h"
+
+namespace mu::engraving::benchmarks {
+void registerEngravingBenchmarks(BenchmarkRunner& runner);
+
+//! NOTE Writes the synthetic scores, each one grows in one dimension from the same base score,
+//! so the benchmark results of a dimension can be charted
+bool generateScalingScores(const QString& dirPath);
+}
+
+#endif // MU_ENGRAVING_ENGRAVINGBENCHMARKS_H
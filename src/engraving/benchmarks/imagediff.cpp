@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "imagediff.h"
+
+#include <algorithm>
+
+using namespace mu::engraving::benchmarks;
+
+//! NOTE The max possible value of colorDelta (black against white)
+static constexpr double MAX_YIQ_DELTA = 35215.0;
+
+static const QRgb DIFF_COLOR = qRgb(255, 0, 0);
+
+bool ImageDiff::Result::isEqual() const
+{
+    return !sizeMismatch && differentPixels == 0;
+}
+
+ImageDiff::Result ImageDiff::compare(const QImage& reference, const QImage& current, const Options& options)
+{
+    const QImage ref = reference.convertToFormat(QImage::Format_ARGB32);
+    const QImage cur = current.convertToFormat(QImage::Format_ARGB32);
+
+    const int width = std::max(ref.width(), cur.width());
+    const int height = std::max(ref.height(), cur.height());
+
+    Result result;
+    result.sizeMismatch = ref.size() != cur.size();
+    result.totalPixels = width * height;
+    result.diffImage = QImage(width, height, QImage::Format_ARGB32);
+    result.diffImage.fill(DIFF_COLOR);
+
+    const double maxDelta = MAX_YIQ_DELTA * options.threshold * options.threshold;
+    const int commonWidth = std::min(ref.width(), cur.width());
+    const int commonHeight = std::min(ref.height(), cur.height());
+
+    for (int y = 0; y < commonHeight; ++y) {
+        const QRgb* refLine = reinterpret_cast<const QRgb*>(ref.constScanLine(y));
+        const QRgb* curLine = reinterpret_cast<const QRgb*>(cur.constScanLine(y));
+        QRgb* diffLine = reinterpret_cast<QRgb*>(result.diffImage.scanLine(y));
+
+        for (int x = 0; x < commonWidth; ++x) {
+            const QRgb refColor = refLine[x];
+            const QRgb curColor = curLine[x];
+
+            bool isDifferent = refColor != curColor && colorDelta(refColor, curColor) > maxDelta;
+            if (isDifferent && options.ignoreAntialiasing) {
+                isDifferent = !hasSimilarNeighbour(ref, x, y, curColor, maxDelta)
+                              || !hasSimilarNeighbour(cur, x, y, refColor, maxDelta);
+            }
+
+            if (isDifferent) {
+                ++result.differentPixels;
+            } else {
+                diffLine[x] = fadedColor(refColor);
+            }
+        }
+    }
+
+    //! NOTE The pixels outside of the common area are all different
+    result.differentPixels += result.totalPixels - commonWidth * commonHeight;
+
+    return result;
+}
+
+double ImageDiff::colorDelta(QRgb c1, QRgb c2)
+{
+    //! NOTE Blend with white, the transparent background is the same as the white one
+    auto blend = [](int c, int a) {
+        return 255.0 + (c - 255.0) * a / 255.0;
+    };
+
+    const int a1 = qAlpha(c1);
+    const int a2 = qAlpha(c2);
+    const double r1 = blend(qRed(c1), a1), g1 = blend(qGreen(c1), a1), b1 = blend(qBlue(c1), a1);
+    const double r2 = blend(qRed(c2), a2), g2 = blend(qGreen(c2), a2), b2 = blend(qBlue(c2), a2);
+
+    const double y = (r1 - r2) * 0.29889531 + (g1 - g2) * 0.58662247 + (b1 - b2) * 0.11448223;
+    const double i = (r1 - r2) * 0.59597799 - (g1 - g2) * 0.27417610 - (b1 - b2) * 0.32180189;
+    const double q = (r1 - r2) * 0.21147017 - (g1 - g2) * 0.52261711 + (b1 - b2) * 0.31114694;
+
+    return 0.5053 * y * y + 0.299 * i * i + 0.1957 * q * q;
+}
+
+bool ImageDiff::hasSimilarNeighbour(const QImage& image, int x, int y, QRgb color, double maxDelta)
+{
+    const int x0 = std::max(x - 1, 0);
+    const int x1 = std::min(x + 1, image.width() - 1);
+    const int y0 = std::max(y - 1, 0);
+    const int y1 = std::min(y + 1, image.height() - 1);
+
+    for (int ny = y0; ny <= y1; ++ny) {
+        const QRgb* line = reinterpret_cast<const QRgb*>(image.constScanLine(ny));
+        for (int nx = x0; nx <= x1; ++nx) {
+            if (line[nx] == color || colorDelta(line[nx], color) <= maxDelta) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+QRgb ImageDiff::fadedColor(QRgb color)
+{
+    //! NOTE The equal pixels are drawn as a light gray, so the differences stand out
+    const int gray = qGray(color) * qAlpha(color) / 255 + (255 - qAlpha(color));
+    const int faded = 255 - (255 - gray) / 4;
+    return qRgb(faded, faded, faded);
+}
@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_IMAGEDIFF_H
+#define MU_ENGRAVING_IMAGEDIFF_H
+
+#include <QImage>
+
+namespace mu::engraving::benchmarks {
+//! NOTE Pixel comparison of the rendered pages with the reference images.
+//! The color difference is measured in the YIQ space (the luminance weighs most),
+//! so the threshold behaves close to the perceived difference.
+//! With the anti-aliasing tolerance a pixel which matches a neighbour pixel
+//! of the other image isn't counted, this ignores subpixel shifts of the edges.
+class ImageDiff
+{
+public:
+    struct Options {
+        //! NOTE 0 - exact match, 1 - any colors are equal
+        double threshold = 0.0;
+        bool ignoreAntialiasing = false;
+    };
+
+    struct Result {
+        bool sizeMismatch = false;
+        int differentPixels = 0;
+        int totalPixels = 0;
+        QImage diffImage;
+
+        bool isEqual() const;
+    };
+
+    static Result compare(const QImage& reference, const QImage& current, const Options& options);
+
+private:
+    static double colorDelta(QRgb c1, QRgb c2);
+    static bool hasSimilarNeighbour(const QImage& image, int x, int y, QRgb color, double maxDelta);
+    static QRgb fadedColor(QRgb color);
+};
+}
+
+#endif // MU_ENGRAVING_IMAGEDIFF_H
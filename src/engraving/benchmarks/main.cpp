@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <QCommandLineParser>
+#include <QGuiApplication>
+
+#include "framework/global/runtime.h"
+#include "testing/environment.h"
+
+#include "benchmarkrunner.h"
+#include "engravingbenchmarks.h"
+
+#include "log.h"
+
+using namespace mu::engraving::benchmarks;
+
+int main(int argc, char** argv)
+{
+    QGuiApplication app(argc, argv);
+
+    mu::runtime::mainThreadId(); //! NOTE Needs only call
+    mu::runtime::setThreadName("main");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Engraving benchmarks: load, layout, edit, midi, playback, paint and save of the scores");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption({ "i", "iterations" }, "Number of the measured iterations", "count", "5"));
+    parser.addOption(QCommandLineOption({ "f", "filter" }, "Run only the benchmarks whose name contains the text", "text"));
+    parser.addOption(QCommandLineOption({ "o", "output" }, "Path of the JSON results", "path", "engraving_benchmarks.json"));
+    parser.addOption(QCommandLineOption({ "g", "generate" }, "Write the synthetic scaling scores to the dir and exit", "dir"));
+    parser.addPositionalArgument("scores", "Score files or directories (by default the built-in corpus)", "[scores...]");
+    parser.process(app);
+
+    mu::testing::Environment::setup();
+
+    if (parser.isSet("generate")) {
+        return generateScalingScores(parser.value("generate")) ? 0 : 1;
+    }
+
+    BenchmarkRunner::Options options;
+    options.iterations = std::max(1, parser.value("iterations").toInt());
+    options.filter = parser.value("filter");
+    options.outputPath = parser.value("output");
+    options.corpus = parser.positionalArguments();
+    if (options.corpus.isEmpty()) {
+        options.corpus = QString(ENGRAVING_BENCHMARKS_CORPUS).split('|', Qt::SkipEmptyParts);
+    }
+
+    BenchmarkRunner runner;
+    registerEngravingBenchmarks(runner);
+
+    return runner.run(options);
+}
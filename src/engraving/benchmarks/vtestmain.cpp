@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+
+#include <QCommandLineParser>
+#include <QGuiApplication>
+
+#include "framework/global/runtime.h"
+#include "testing/environment.h"
+
+#include "vtestrunner.h"
+
+#include "log.h"
+
+using namespace mu::engraving::benchmarks;
+
+int main(int argc, char** argv)
+{
+    QGuiApplication app(argc, argv);
+
+    mu::runtime::mainThreadId(); //! NOTE Needs only call
+    mu::runtime::setThreadName("main");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Engraving visual tests: render the pages of the scores and compare them with the reference images");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption({ "r", "reference-dir" }, "Dir of the reference images", "dir", "vtest.artifacts/ref"));
+    parser.addOption(QCommandLineOption({ "o", "output-dir" }, "Dir of the report and the different images", "dir",
+                                        "vtest.artifacts/compare"));
+    parser.addOption(QCommandLineOption({ "g", "generate" }, "Write the rendered pages to the reference dir instead of comparing"));
+    parser.addOption(QCommandLineOption({ "d", "dpi" }, "Resolution of the images", "dpi", "130"));
+    parser.addOption(QCommandLineOption({ "j", "threads" }, "Number of the render threads (by default the ideal count)", "count", "0"));
+    parser.addOption(QCommandLineOption({ "t", "threshold" }, "Color difference threshold, from 0 (exact) to 1", "value", "0"));
+    parser.addOption(QCommandLineOption({ "a", "ignore-antialiasing" }, "Don't count the pixels matching a neighbour pixel"));
+    parser.addPositionalArgument("scores", "Score files or directories (by default the vtest scores)", "[scores...]");
+    parser.process(app);
+
+    mu::testing::Environment::setup();
+
+    VTestRunner::Options options;
+    options.referenceDir = parser.value("reference-dir");
+    options.outputDir = parser.value("output-dir");
+    options.generateReferences = parser.isSet("generate");
+    options.dpi = std::max(1, parser.value("dpi").toInt());
+    options.threads = std::max(0, parser.value("threads").toInt());
+    options.diff.threshold = std::clamp(parser.value("threshold").toDouble(), 0.0, 1.0);
+    options.diff.ignoreAntialiasing = parser.isSet("ignore-antialiasing");
+    options.scores = parser.positionalArguments();
+    if (options.scores.isEmpty()) {
+        options.scores = QStringList { QString(VTEST_DIR) + "/scores" };
+    }
+
+    VTestRunner runner;
+    return runner.run(options);
+}
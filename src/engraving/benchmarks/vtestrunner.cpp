@@ -0,0 +1,429 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "vtestrunner.h"
+
+#include <cmath>
+#include <memory>
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/mscore.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/paint/pagedisplaylist.h"
+#include "infrastructure/draw/painter.h"
+
+#include "benchmarkutils.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmarks;
+using namespace Ms;
+
+static const QString REPORT_FILE_NAME = "vtest_report.html";
+
+static double elapsedMs(const QElapsedTimer& timer)
+{
+    return static_cast<double>(timer.nsecsElapsed()) / 1000000.0;
+}
+
+static QString formatMs(double ms)
+{
+    return QString::number(ms, 'f', 1);
+}
+
+//---------------------------------------------------------
+//   ScoreResult
+//---------------------------------------------------------
+
+double VTestRunner::ScoreResult::renderTime() const
+{
+    double time = 0.0;
+    for (const PageResult& page : pages) {
+        time += page.renderTime;
+    }
+    return time;
+}
+
+double VTestRunner::ScoreResult::compareTime() const
+{
+    double time = 0.0;
+    for (const PageResult& page : pages) {
+        time += page.compareTime;
+    }
+    return time;
+}
+
+bool VTestRunner::ScoreResult::isFailed() const
+{
+    if (!error.isEmpty()) {
+        return true;
+    }
+
+    for (const PageResult& page : pages) {
+        if (page.status == PageStatus::Different || page.status == PageStatus::Removed || page.status == PageStatus::SaveError) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//   run
+//---------------------------------------------------------
+
+int VTestRunner::run(const Options& options)
+{
+    m_options = options;
+
+    const QStringList files = scoreFiles(options.scores);
+    if (files.isEmpty()) {
+        LOGE() << "no scores to test";
+        return 1;
+    }
+
+    const QString imagesDir = options.generateReferences ? options.referenceDir : options.outputDir;
+    if (!QDir().mkpath(imagesDir)) {
+        LOGE() << "can't create the dir: " << imagesDir;
+        return 1;
+    }
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(options.threads > 0 ? options.threads : QThread::idealThreadCount());
+
+    //! NOTE The text is recorded to the display lists depending on the pixel ratio
+    MScore::pixelRatio = DPI / options.dpi;
+    MScore::pdfPrinting = true;
+
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
+    //! NOTE The page results are filled from the pool threads, so the vectors must not be reallocated after the start
+    std::vector<ScoreResult> results(files.size());
+    for (int i = 0; i < files.size(); ++i) {
+        ScoreResult& result = results[i];
+        std::vector<PageJob> jobs = runScore(files.at(i), result);
+
+        for (size_t p = 0; p < jobs.size(); ++p) {
+            PageResult* pageResult = &result.pages[p];
+            QtConcurrent::run(&pool, [this, job = std::move(jobs[p]), pageResult]() {
+                runPage(job, *pageResult);
+            });
+        }
+    }
+
+    pool.waitForDone();
+
+    const double totalTime = elapsedMs(totalTimer);
+
+    int failedCount = 0;
+    for (const ScoreResult& result : results) {
+        if (result.isFailed()) {
+            ++failedCount;
+        }
+
+        QString status = result.error;
+        if (status.isEmpty()) {
+            status = result.isFailed() ? "different" : "ok";
+        }
+
+        LOGI() << result.name << ": " << status
+               << ", load " << formatMs(result.loadTime) << " ms"
+               << ", layout " << formatMs(result.layoutTime) << " ms"
+               << ", render " << formatMs(result.renderTime()) << " ms";
+    }
+
+    LOGI() << "scores: " << results.size() << ", failed: " << failedCount << ", total time: " << formatMs(totalTime) << " ms";
+
+    if (!options.generateReferences && !writeReport(results, totalTime)) {
+        return 1;
+    }
+
+    return failedCount > 0 ? 1 : 0;
+}
+
+std::vector<VTestRunner::PageJob> VTestRunner::runScore(const QString& path, ScoreResult& result) const
+{
+    TRACEFUNC;
+
+    result.name = QFileInfo(path).completeBaseName();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QByteArray msczData;
+    if (!readMsczData(path, &msczData)) {
+        result.error = "can't read the file";
+        return {};
+    }
+
+    std::unique_ptr<MasterScore> score(loadScore(path, msczData));
+    if (!score) {
+        result.error = "can't load the score";
+        return {};
+    }
+    result.loadTime = elapsedMs(timer);
+
+    timer.restart();
+    score->doLayout();
+    result.layoutTime = elapsedMs(timer);
+
+    score->setPrinting(true);
+
+    const QList<Page*>& pages = score->pages();
+    std::vector<PageJob> jobs;
+    jobs.reserve(pages.size());
+    result.pages.resize(pages.size());
+
+    timer.restart();
+    for (int p = 0; p < pages.size(); ++p) {
+        Page* page = pages.at(p);
+        PageResult& pageResult = result.pages[p];
+        pageResult.name = QString("%1-%2").arg(result.name).arg(p + 1);
+
+        auto displayList = std::make_shared<PageDisplayList>();
+        displayList->record(page);
+
+        PageJob job;
+        job.pageRect = page->bbox();
+
+        if (displayList->hasLiveElements()) {
+            QElapsedTimer renderTimer;
+            renderTimer.start();
+            job.image = renderPage(*displayList, job.pageRect);
+            pageResult.renderTime = elapsedMs(renderTimer);
+        } else {
+            job.displayList = displayList;
+        }
+
+        jobs.push_back(std::move(job));
+    }
+    result.recordTime = elapsedMs(timer);
+
+    //! NOTE The score has less pages than the reference
+    if (!m_options.generateReferences) {
+        const QString nextPageName = QString("%1-%2").arg(result.name).arg(pages.size() + 1);
+        if (QFileInfo::exists(QDir(m_options.referenceDir).filePath(nextPageName + ".png"))) {
+            PageResult removed;
+            removed.name = nextPageName;
+            removed.status = PageStatus::Removed;
+            result.pages.push_back(removed);
+        }
+    }
+
+    return jobs;
+}
+
+void VTestRunner::runPage(const PageJob& job, PageResult& result) const
+{
+    if (!job.displayList) {
+        checkPage(job.image, result);
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const QImage image = renderPage(*job.displayList, job.pageRect);
+    result.renderTime = elapsedMs(timer);
+
+    checkPage(image, result);
+}
+
+QImage VTestRunner::renderPage(const PageDisplayList& displayList, const RectF& pageRect) const
+{
+    //! NOTE The same setup as of the png export (see NotationPainting::paintPng)
+    const qreal width = pageRect.width() / DPI * m_options.dpi;
+    const qreal height = pageRect.height() / DPI * m_options.dpi;
+
+    QImage image(std::lrint(width), std::lrint(height), QImage::Format_ARGB32_Premultiplied);
+    image.setDotsPerMeterX(std::lrint((m_options.dpi * 1000) / INCH));
+    image.setDotsPerMeterY(std::lrint((m_options.dpi * 1000) / INCH));
+    image.fill(Qt::white);
+
+    draw::Painter painter(&image, "vtest");
+    painter.setAntialiasing(true);
+    painter.setViewport(RectF(0.0, 0.0, width, height));
+    painter.setWindow(RectF(0.0, 0.0, pageRect.width(), pageRect.height()));
+
+    painter.setClipping(true);
+    painter.setClipRect(pageRect);
+    displayList.paint(painter, pageRect);
+    painter.setClipping(false);
+    painter.endDraw();
+
+    return image;
+}
+
+void VTestRunner::checkPage(const QImage& image, PageResult& result) const
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const QDir referenceDir(m_options.referenceDir);
+    const QDir outputDir(m_options.outputDir);
+    const QString fileName = result.name + ".png";
+
+    if (m_options.generateReferences) {
+        result.status = image.save(referenceDir.filePath(fileName), "png") ? PageStatus::Generated : PageStatus::SaveError;
+        result.compareTime = elapsedMs(timer);
+        return;
+    }
+
+    const QString referencePath = referenceDir.filePath(fileName);
+    QImage reference;
+    if (!reference.load(referencePath)) {
+        result.status = PageStatus::NoReference;
+        image.save(outputDir.filePath(fileName), "png");
+        result.compareTime = elapsedMs(timer);
+        return;
+    }
+
+    const ImageDiff::Result diff = ImageDiff::compare(reference, image, m_options.diff);
+    result.differentPixels = diff.differentPixels;
+
+    if (diff.isEqual()) {
+        result.status = PageStatus::Equal;
+    } else {
+        //! NOTE The same files as of the vtest-compare-pngs.sh script
+        const QString refCopyPath = outputDir.filePath(result.name + ".ref.png");
+        QFile::remove(refCopyPath);
+
+        bool ok = QFile::copy(referencePath, refCopyPath);
+        ok = image.save(outputDir.filePath(fileName), "png") && ok;
+        ok = diff.diffImage.save(outputDir.filePath(result.name + ".diff.png"), "png") && ok;
+
+        result.status = ok ? PageStatus::Different : PageStatus::SaveError;
+    }
+
+    result.compareTime = elapsedMs(timer);
+}
+
+//---------------------------------------------------------
+//   writeReport
+//---------------------------------------------------------
+
+QString VTestRunner::pageStatusText(PageStatus status)
+{
+    switch (status) {
+    case PageStatus::Equal: return "equal";
+    case PageStatus::Different: return "different";
+    case PageStatus::NoReference: return "no reference";
+    case PageStatus::Removed: return "removed";
+    case PageStatus::Generated: return "generated";
+    case PageStatus::SaveError: return "save error";
+    }
+    return QString();
+}
+
+bool VTestRunner::writeReport(const std::vector<ScoreResult>& results, double totalTime) const
+{
+    const QDir outputDir(m_options.outputDir);
+
+    const QString stylePath = outputDir.filePath("style.css");
+    QFile::remove(stylePath);
+    QFile::copy(QString(VTEST_DIR) + "/style.css", stylePath);
+
+    QFile file(outputDir.filePath(REPORT_FILE_NAME));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        LOGE() << "can't write the report: " << file.fileName();
+        return false;
+    }
+
+    int failedCount = 0;
+    for (const ScoreResult& result : results) {
+        failedCount += result.isFailed() ? 1 : 0;
+    }
+
+    QTextStream html(&file);
+    html << "<html>\n";
+    html << "  <head>\n";
+    html << "    <link rel=\"stylesheet\" type=\"text/css\" href=\"style.css\">\n";
+    html << "  </head>\n";
+    html << "  <body>\n";
+    html << "    <div id=\"topbar\">\n";
+    html << "      <span>Reference</span>\n";
+    html << "      <span>Current</span>\n";
+    html << "      <span>Diff</span>\n";
+    html << "    </div>\n";
+    html << "    <div id=\"topmargin\"></div>\n";
+
+    html << "    <p>Scores: " << results.size() << ", failed: " << failedCount
+         << ", total time: " << formatMs(totalTime) << " ms, threads: "
+         << (m_options.threads > 0 ? m_options.threads : QThread::idealThreadCount()) << "</p>\n";
+
+    html << "    <table>\n";
+    html << "      <tr><th>Score</th><th>Status</th><th>Pages</th><th>Load, ms</th><th>Layout, ms</th>"
+         << "<th>Record, ms</th><th>Render, ms</th><th>Compare, ms</th></tr>\n";
+
+    for (const ScoreResult& result : results) {
+        QString status = result.error;
+        if (status.isEmpty()) {
+            status = result.isFailed() ? QString("<a href=\"#%1\">different</a>").arg(result.name) : QString("ok");
+        }
+
+        html << "      <tr><td>" << result.name.toHtmlEscaped() << "</td><td>" << status << "</td><td>" << result.pages.size()
+             << "</td><td>" << formatMs(result.loadTime) << "</td><td>" << formatMs(result.layoutTime)
+             << "</td><td>" << formatMs(result.recordTime) << "</td><td>" << formatMs(result.renderTime())
+             << "</td><td>" << formatMs(result.compareTime()) << "</td></tr>\n";
+    }
+    html << "    </table>\n";
+
+    for (const ScoreResult& result : results) {
+        if (!result.isFailed() || !result.error.isEmpty()) {
+            continue;
+        }
+
+        html << "    <h2 id=\"" << result.name << "\">" << result.name.toHtmlEscaped()
+             << " <a class=\"toc-anchor\" href=\"#" << result.name << "\">#</a></h2>\n";
+
+        for (const PageResult& page : result.pages) {
+            if (page.status != PageStatus::Different) {
+                if (page.status != PageStatus::Equal) {
+                    html << "    <p>" << page.name.toHtmlEscaped() << ": " << pageStatusText(page.status) << "</p>\n";
+                }
+                continue;
+            }
+
+            html << "    <p>" << page.name.toHtmlEscaped() << ": " << page.differentPixels << " different pixels</p>\n";
+            html << "    <div>\n";
+            html << "      <img src=\"" << page.name << ".ref.png\">\n";
+            html << "      <img src=\"" << page.name << ".png\">\n";
+            html << "      <img src=\"" << page.name << ".diff.png\">\n";
+            html << "    </div>\n";
+        }
+    }
+
+    html << "  </body>\n";
+    html << "</html>\n";
+
+    LOGI() << "report: " << file.fileName();
+
+    return true;
+}
@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_VTESTRUNNER_H
+#define MU_ENGRAVING_VTESTRUNNER_H
+
+#include <memory>
+#include <vector>
+
+#include <QImage>
+#include <QString>
+#include <QStringList>
+
+#include "infrastructure/draw/geometry.h"
+
+#include "imagediff.h"
+
+namespace mu::engraving {
+class PageDisplayList;
+}
+
+namespace mu::engraving::benchmarks {
+//! NOTE In-process visual regression test, the replacement of the vtest scripts.
+//! Every score is loaded and laid out once on the main thread and its pages are recorded to display lists,
+//! then the pages are rendered, compared with the reference images and saved on a thread pool,
+//! while the main thread goes on with the next score.
+//! The images are named as by the converter (<score>-<page>.png), so the references
+//! made by the vtest-generate-pngs.sh script can be used too.
+class VTestRunner
+{
+public:
+    struct Options {
+        QStringList scores;
+        QString referenceDir = "vtest.artifacts/ref";
+        QString outputDir = "vtest.artifacts/compare";
+        //! NOTE Write the rendered pages to the reference dir instead of comparing
+        bool generateReferences = false;
+        int dpi = 130;
+        int threads = 0; // 0 - the ideal thread count
+        ImageDiff::Options diff;
+    };
+
+    //! NOTE Returns 0 if all pages are equal to the references
+    int run(const Options& options);
+
+private:
+    enum class PageStatus {
+        Equal,
+        Different,
+        NoReference,
+        Removed,
+        Generated,
+        SaveError
+    };
+
+    struct PageResult {
+        QString name;
+        PageStatus status = PageStatus::Equal;
+        int differentPixels = 0;
+        double renderTime = 0.0;
+        double compareTime = 0.0;
+    };
+
+    struct ScoreResult {
+        QString name;
+        QString error;
+        double loadTime = 0.0;
+        double layoutTime = 0.0;
+        double recordTime = 0.0;
+        std::vector<PageResult> pages;
+
+        double renderTime() const;
+        double compareTime() const;
+        bool isFailed() const;
+    };
+
+    struct PageJob {
+        std::shared_ptr<const PageDisplayList> displayList;
+        RectF pageRect;
+        //! NOTE The page with live elements is rendered on the main thread, before the score is deleted
+        QImage image;
+    };
+
+    std::vector<PageJob> runScore(const QString& path, ScoreResult& result) const;
+    void runPage(const PageJob& job, PageResult& result) const;
+
+    QImage renderPage(const PageDisplayList& displayList, const RectF& pageRect) const;
+    void checkPage(const QImage& image, PageResult& result) const;
+
+    static QString pageStatusText(PageStatus status);
+    bool writeReport(const std::vector<ScoreResult>& results, double totalTime) const;
+
+    Options m_options;
+};
+}
+
+#endif // MU_ENGRAVING_VTESTRUNNER_H
@@ -34,15 +34,21 @@
 #include "engraving/libmscore/mscore.h"
 #include "engraving/libmscore/masterscore.h"
 #include "engraving/libmscore/scorefont.h"
+#include "engraving/libmscore/undo.h"
 
 #include "engraving/accessibility/accessibleitem.h"
 
 #include "compat/scoreaccess.h"
 
+#include "log.h"
+
 using namespace mu::engraving;
 using namespace mu::modularity;
 
 static std::shared_ptr<EngravingConfiguration> s_configuration = std::make_shared<EngravingConfiguration>();
+#ifndef NO_ENGRAVING_INTERNAL
+static std::shared_ptr<draw::QFontProvider> s_fontProvider = std::make_shared<draw::QFontProvider>();
+#endif
 
 static void engraving_init_qrc()
 {
@@ -57,7 +63,7 @@ std::string EngravingModule::moduleName() const
 void EngravingModule::registerExports()
 {
 #ifndef NO_ENGRAVING_INTERNAL
-    ioc()->registerExport<draw::IFontProvider>(moduleName(), new draw::QFontProvider());
+    ioc()->registerExport<draw::IFontProvider>(moduleName(), s_fontProvider);
     ioc()->registerExport<draw::IImageProvider>(moduleName(), new draw::QImageProvider());
     ioc()->registerExport<IEngravingConfiguration>(moduleName(), s_configuration);
 #endif
@@ -77,7 +83,7 @@ void EngravingModule::registerUiTypes()
     Ms::MScore::registerUiTypes();
 }
 
-void EngravingModule::onInit(const framework::IApplication::RunMode&)
+void EngravingModule::onInit(const framework::IApplication::RunMode& mode)
 {
     s_configuration->init();
 
@@ -92,7 +98,9 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
 
     AccessibleItem::enabled = false;
     Ms::gpaletteScore = compat::ScoreAccess::createMasterScore();
-    AccessibleItem::enabled = true;
+
+    //! NOTE The accessible items are not needed without UI (converter)
+    AccessibleItem::enabled = mode == framework::IApplication::RunMode::Editor;
     if (Ms::EngravingObject::elementsProvider()) {
         Ms::EngravingObject::elementsProvider()->unreg(Ms::gpaletteScore);
     }
@@ -109,6 +117,17 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
 
 void EngravingModule::onDestroy()
 {
+#ifndef NO_ENGRAVING_INTERNAL
+    draw::FontMetricsCache::Stats stats = s_fontProvider->metricsCacheStats();
+    LOGI() << "font metrics cache: hits: " << stats.hits << ", misses: " << stats.misses
+           << ", hit rate: " << stats.hitRate() << ", fonts: " << stats.fonts << ", texts: " << stats.texts;
+#endif
+
+    Ms::ChangeLinkedProperty::Stats linkedStats = Ms::ChangeLinkedProperty::stats();
+    LOGI() << "linked property changes: commands: " << linkedStats.commands << ", members: " << linkedStats.members
+           << ", members per command: " << linkedStats.membersPerCommand() << ", max members: " << linkedStats.maxMembers
+           << ", scores: " << linkedStats.scores;
+
     delete Ms::gpaletteScore;
     Ms::gpaletteScore = nullptr;
 }
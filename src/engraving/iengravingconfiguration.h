@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_IENGRAVINGCONFIGURATION_H
 #define MU_ENGRAVING_IENGRAVINGCONFIGURATION_H
 
+#include <optional>
+
 #include <QString>
 
 #include "modularity/imoduleexport.h"
@@ -69,6 +71,10 @@ public:
     virtual async::Notification scoreInversionChanged() const = 0;
 
     virtual draw::Color highlightSelectionColor(int voiceIndex = 0) const = 0;
+
+    //! NOTE The number of threads to lay out the part scores of a score, 1 means one after another
+    virtual int partsLayoutThreadCount() const = 0;
+    virtual void setPartsLayoutThreadCount(std::optional<int> count) = 0;
 };
 }
 
@@ -68,8 +68,15 @@ bool BufferedPaintProvider::isActive() const
 
 void BufferedPaintProvider::beginObject(const std::string& name, const PointF& pagePos)
 {
+    //! NOTE The new object inherits the current state,
+    //! as the real painter does, so that replaying it gives the same result
+    DrawData::Object obj(name, pagePos);
+    if (!m_currentObjects.empty()) {
+        obj.datas.back().state = currentState();
+    }
+
     // add new object
-    m_currentObjects.push(DrawData::Object(name, pagePos));
+    m_currentObjects.push(std::move(obj));
 
 #ifdef TRACE_DRAW_OBJ_ENABLED
     m_drawObjectsLogger.beginObject(name, pagePos);
@@ -174,10 +181,17 @@ const Brush& BufferedPaintProvider::brush() const
 
 void BufferedPaintProvider::save()
 {
+    m_savedStates.push(currentState());
 }
 
 void BufferedPaintProvider::restore()
 {
+    IF_ASSERT_FAILED(!m_savedStates.empty()) {
+        return;
+    }
+
+    editableState() = m_savedStates.top();
+    m_savedStates.pop();
 }
 
 void BufferedPaintProvider::setTransform(const Transform& transform)
@@ -275,4 +289,6 @@ void BufferedPaintProvider::clear()
     m_buf = DrawData();
     std::stack<DrawData::Object> empty;
     m_currentObjects.swap(empty);
+    std::stack<DrawData::State> emptyStates;
+    m_savedStates.swap(emptyStates);
 }
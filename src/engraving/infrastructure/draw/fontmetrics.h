@@ -31,7 +31,7 @@
 namespace mu::draw {
 class FontMetrics
 {
-    INJECT(draw, IFontProvider, fontProvider)
+    INJECT_PINNED(draw, IFontProvider, fontProvider)
 public:
     FontMetrics(const Font& font);
 
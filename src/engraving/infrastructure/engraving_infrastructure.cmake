@@ -65,6 +65,8 @@ else()
         ${CMAKE_CURRENT_LIST_DIR}/internal/qimageprovider.cpp
         ${CMAKE_CURRENT_LIST_DIR}/internal/qfontprovider.cpp
         ${CMAKE_CURRENT_LIST_DIR}/internal/qfontprovider.h
+        ${CMAKE_CURRENT_LIST_DIR}/internal/fontmetricscache.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/internal/fontmetricscache.h
         ${CMAKE_CURRENT_LIST_DIR}/internal/fontengineft.cpp
         ${CMAKE_CURRENT_LIST_DIR}/internal/fontengineft.h
         ${CMAKE_CURRENT_LIST_DIR}/internal/qimagepainterprovider.cpp
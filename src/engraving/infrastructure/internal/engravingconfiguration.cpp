@@ -21,6 +21,8 @@
  */
 #include "engravingconfiguration.h"
 
+#include <algorithm>
+
 #include "global/settings.h"
 #include "draw/color.h"
 #include "libmscore/mscore.h"
@@ -178,3 +180,17 @@ async::Notification EngravingConfiguration::scoreInversionChanged() const
 {
     return m_scoreInversionChanged;
 }
+
+int EngravingConfiguration::partsLayoutThreadCount() const
+{
+    if (m_partsLayoutThreadCount) {
+        return std::max(m_partsLayoutThreadCount.value(), 1);
+    }
+
+    return 1;
+}
+
+void EngravingConfiguration::setPartsLayoutThreadCount(std::optional<int> count)
+{
+    m_partsLayoutThreadCount = count;
+}
@@ -67,9 +67,14 @@ public:
 
     async::Notification scoreInversionChanged() const override;
 
+    int partsLayoutThreadCount() const override;
+    void setPartsLayoutThreadCount(std::optional<int> count) override;
+
 private:
     async::Channel<int, draw::Color> m_voiceColorChanged;
     async::Notification m_scoreInversionChanged;
+
+    std::optional<int> m_partsLayoutThreadCount;
 };
 }
 
@@ -0,0 +1,152 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "fontmetricscache.h"
+
+#include <QHash>
+
+using namespace mu;
+using namespace mu::draw;
+
+static size_t combineHash(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+double FontMetricsCache::Stats::hitRate() const
+{
+    uint64_t total = hits + misses;
+    return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+bool FontMetricsCache::FontKey::operator==(const FontKey& other) const
+{
+    //! NOTE The point size is compared exactly, like it is hashed,
+    //! the equal keys must have the equal hashes
+    return family == other.family
+           && pointSize == other.pointSize
+           && weight == other.weight
+           && style == other.style
+           && noFontMerging == other.noFontMerging
+           && hinting == other.hinting;
+}
+
+size_t FontMetricsCache::FontKeyHash::operator()(const FontKey& key) const
+{
+    size_t h = qHash(key.family);
+    h = combineHash(h, qHash(key.pointSize));
+    h = combineHash(h, static_cast<size_t>(key.weight));
+    h = combineHash(h, static_cast<size_t>(key.style));
+    h = combineHash(h, static_cast<size_t>(key.noFontMerging));
+    h = combineHash(h, static_cast<size_t>(key.hinting));
+    return h;
+}
+
+bool FontMetricsCache::TextKey::operator==(const TextKey& other) const
+{
+    return kind == other.kind && text == other.text && font == other.font;
+}
+
+size_t FontMetricsCache::TextKeyHash::operator()(const TextKey& key) const
+{
+    size_t h = FontKeyHash()(key.font);
+    h = combineHash(h, qHash(key.text));
+    h = combineHash(h, static_cast<size_t>(key.kind));
+    return h;
+}
+
+FontMetricsCache::FontKey FontMetricsCache::fontKey(const Font& f)
+{
+    FontKey key;
+    key.family = f.family();
+    key.pointSize = f.pointSizeF();
+    key.weight = static_cast<int>(f.weight());
+    key.style = (f.bold() ? 1 << 0 : 0)
+                | (f.italic() ? 1 << 1 : 0)
+                | (f.underline() ? 1 << 2 : 0)
+                | (f.strike() ? 1 << 3 : 0);
+    key.noFontMerging = f.noFontMerging();
+    key.hinting = static_cast<int>(f.hinting());
+    return key;
+}
+
+FontMetricsCache::LineMetrics FontMetricsCache::lineMetrics(const Font& f, const LineMetricsFunc& compute)
+{
+    FontKey key = fontKey(f);
+
+    {
+        std::shared_lock lock(m_fontsMutex);
+        auto it = m_fonts.find(key);
+        if (it != m_fonts.end()) {
+            ++m_hits;
+            return it->second;
+        }
+    }
+
+    ++m_misses;
+
+    //! NOTE Computed without the lock, several threads may compute the same font at the same time,
+    //! it is cheaper than to block all the readers
+    LineMetrics metrics = compute();
+
+    std::unique_lock lock(m_fontsMutex);
+    m_fonts.emplace(std::move(key), metrics);
+
+    return metrics;
+}
+
+void FontMetricsCache::clear()
+{
+    {
+        std::unique_lock lock(m_fontsMutex);
+        m_fonts.clear();
+    }
+
+    {
+        std::unique_lock lock(m_textsMutex);
+        m_texts.clear();
+    }
+}
+
+FontMetricsCache::Stats FontMetricsCache::stats() const
+{
+    Stats stats;
+    stats.hits = m_hits.load();
+    stats.misses = m_misses.load();
+
+    {
+        std::shared_lock lock(m_fontsMutex);
+        stats.fonts = m_fonts.size();
+    }
+
+    {
+        std::shared_lock lock(m_textsMutex);
+        stats.texts = m_texts.size();
+    }
+
+    return stats;
+}
+
+void FontMetricsCache::resetStats()
+{
+    m_hits = 0;
+    m_misses = 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_FONTMETRICSCACHE_H
+#define MU_DRAW_FONTMETRICSCACHE_H
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <QString>
+
+#include "infrastructure/draw/font.h"
+#include "infrastructure/draw/geometry.h"
+
+namespace mu::draw {
+//! NOTE Thread-safe cache of the text metrics.
+//! The layout asks many times for the metrics of the same strings with the same fonts,
+//! and it can do it from several threads (for example, when exporting pages in parallel),
+//! so the values are computed once and shared between threads.
+class FontMetricsCache
+{
+public:
+    FontMetricsCache() = default;
+
+    struct LineMetrics {
+        qreal lineSpacing = 0.0;
+        qreal xHeight = 0.0;
+        qreal height = 0.0;
+        qreal ascent = 0.0;
+        qreal descent = 0.0;
+    };
+
+    enum class TextKind {
+        String,
+        Char,
+        Ucs4
+    };
+
+    struct TextMetrics {
+        std::optional<qreal> horizontalAdvance;
+        std::optional<RectF> boundingRect;
+        std::optional<RectF> tightBoundingRect;
+        std::optional<bool> inFont;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t fonts = 0;
+        size_t texts = 0;
+
+        double hitRate() const;
+    };
+
+    using LineMetricsFunc = std::function<LineMetrics()>;
+
+    LineMetrics lineMetrics(const Font& f, const LineMetricsFunc& compute);
+
+    //! NOTE The member is the field of TextMetrics which is asked for,
+    //! if it is not cached yet, it is computed by `compute`
+    template<typename T, typename Func>
+    T textMetric(const Font& f, const QString& text, TextKind kind, std::optional<T> TextMetrics::* member, const Func& compute)
+    {
+        TextKey key { fontKey(f), text, kind };
+
+        {
+            std::shared_lock lock(m_textsMutex);
+            auto it = m_texts.find(key);
+            if (it != m_texts.end() && (it->second.*member).has_value()) {
+                ++m_hits;
+                return (it->second.*member).value();
+            }
+        }
+
+        ++m_misses;
+
+        T value = compute();
+
+        std::unique_lock lock(m_textsMutex);
+        if (m_texts.size() >= MAX_TEXTS) {
+            m_texts.clear();
+        }
+        m_texts[key].*member = value;
+
+        return value;
+    }
+
+    void clear();
+
+    Stats stats() const;
+    void resetStats();
+
+private:
+    static constexpr size_t MAX_TEXTS = 100000;
+
+    struct FontKey {
+        QString family;
+        qreal pointSize = 0.0;
+        int weight = 0;
+        int style = 0;
+        bool noFontMerging = false;
+        int hinting = 0;
+
+        bool operator==(const FontKey& other) const;
+    };
+
+    struct FontKeyHash {
+        size_t operator()(const FontKey& key) const;
+    };
+
+    struct TextKey {
+        FontKey font;
+        QString text;
+        TextKind kind = TextKind::String;
+
+        bool operator==(const TextKey& other) const;
+    };
+
+    struct TextKeyHash {
+        size_t operator()(const TextKey& key) const;
+    };
+
+    static FontKey fontKey(const Font& f);
+
+    mutable std::shared_mutex m_fontsMutex;
+    std::unordered_map<FontKey, LineMetrics, FontKeyHash> m_fonts;
+
+    mutable std::shared_mutex m_textsMutex;
+    std::unordered_map<TextKey, TextMetrics, TextKeyHash> m_texts;
+
+    std::atomic<uint64_t> m_hits = 0;
+    std::atomic<uint64_t> m_misses = 0;
+};
+}
+
+#endif // MU_DRAW_FONTMETRICSCACHE_H
@@ -54,83 +54,137 @@ static FontPaintDevice device;
 
 int QFontProvider::addApplicationFont(const QString& family, const QString& path)
 {
-    m_paths[family] = path;
-    return QFontDatabase::addApplicationFont(path);
+    {
+        std::lock_guard lock(m_symMutex);
+        m_paths[family] = path;
+    }
+
+    int id = QFontDatabase::addApplicationFont(path);
+
+    //! NOTE A new font may change the resolved fonts, so the metrics too
+    m_metricsCache.clear();
+
+    return id;
 }
 
 void QFontProvider::insertSubstitution(const QString& familyName, const QString& substituteName)
 {
     QFont::insertSubstitution(familyName, substituteName);
+    m_metricsCache.clear();
+}
+
+FontMetricsCache::Stats QFontProvider::metricsCacheStats() const
+{
+    return m_metricsCache.stats();
+}
+
+FontMetricsCache::LineMetrics QFontProvider::lineMetrics(const Font& f) const
+{
+    return m_metricsCache.lineMetrics(f, [&f]() {
+        QFontMetricsF fm(f.toQFont(), &device);
+
+        FontMetricsCache::LineMetrics metrics;
+        metrics.lineSpacing = fm.lineSpacing();
+        metrics.xHeight = fm.xHeight();
+        metrics.height = fm.height();
+        metrics.ascent = fm.ascent();
+        metrics.descent = fm.descent();
+        return metrics;
+    });
 }
 
 qreal QFontProvider::lineSpacing(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).lineSpacing();
+    return lineMetrics(f).lineSpacing;
 }
 
 qreal QFontProvider::xHeight(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).xHeight();
+    return lineMetrics(f).xHeight;
 }
 
 qreal QFontProvider::height(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).height();
+    return lineMetrics(f).height;
 }
 
 qreal QFontProvider::ascent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).ascent();
+    return lineMetrics(f).ascent;
 }
 
 qreal QFontProvider::descent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).descent();
+    return lineMetrics(f).descent;
 }
 
 bool QFontProvider::inFont(const Font& f, QChar ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).inFont(ch);
+    return m_metricsCache.textMetric(f, QString(ch), FontMetricsCache::TextKind::Char,
+                                     &FontMetricsCache::TextMetrics::inFont, [&]() {
+        return QFontMetricsF(f.toQFont(), &device).inFont(ch);
+    });
 }
 
 bool QFontProvider::inFontUcs4(const Font& f, uint ucs4) const
 {
-    return QFontMetricsF(f.toQFont(), &device).inFontUcs4(ucs4);
+    return m_metricsCache.textMetric(f, QString::number(ucs4), FontMetricsCache::TextKind::Ucs4,
+                                     &FontMetricsCache::TextMetrics::inFont, [&]() {
+        return QFontMetricsF(f.toQFont(), &device).inFontUcs4(ucs4);
+    });
 }
 
 qreal QFontProvider::horizontalAdvance(const Font& f, const QString& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    return m_metricsCache.textMetric(f, string, FontMetricsCache::TextKind::String,
+                                     &FontMetricsCache::TextMetrics::horizontalAdvance, [&]() {
+        return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    });
 }
 
 qreal QFontProvider::horizontalAdvance(const Font& f, const QChar& ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(ch);
+    return m_metricsCache.textMetric(f, QString(ch), FontMetricsCache::TextKind::Char,
+                                     &FontMetricsCache::TextMetrics::horizontalAdvance, [&]() {
+        return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(ch);
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const QString& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    return m_metricsCache.textMetric(f, string, FontMetricsCache::TextKind::String,
+                                     &FontMetricsCache::TextMetrics::boundingRect, [&]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const QChar& ch) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(ch));
+    return m_metricsCache.textMetric(f, QString(ch), FontMetricsCache::TextKind::Char,
+                                     &FontMetricsCache::TextMetrics::boundingRect, [&]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(ch));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, const QString& string) const
 {
+    //! NOTE Depends on the rect and the flags, it is rarely used, so not cached
     return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(r.toQRectF(), flags, string));
 }
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const QString& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    return m_metricsCache.textMetric(f, string, FontMetricsCache::TextKind::String,
+                                     &FontMetricsCache::TextMetrics::tightBoundingRect, [&]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    });
 }
 
 // Score symbols
 RectF QFontProvider::symBBox(const Font& f, uint ucs4, qreal dpi_f) const
 {
+    std::lock_guard lock(m_symMutex);
+
     FontEngineFT* engine = symEngine(f);
     if (!engine) {
         return RectF();
@@ -140,6 +194,8 @@ RectF QFontProvider::symBBox(const Font& f, uint ucs4, qreal dpi_f) const
 
 qreal QFontProvider::symAdvance(const Font& f, uint ucs4, qreal dpi_f) const
 {
+    std::lock_guard lock(m_symMutex);
+
     FontEngineFT* engine = symEngine(f);
     if (!engine) {
         return 0.0;
@@ -147,6 +203,7 @@ qreal QFontProvider::symAdvance(const Font& f, uint ucs4, qreal dpi_f) const
     return engine->advance(ucs4, dpi_f);
 }
 
+//! NOTE Must be called under the m_symMutex lock
 FontEngineFT* QFontProvider::symEngine(const Font& f) const
 {
     QString path = m_paths.value(f.family());
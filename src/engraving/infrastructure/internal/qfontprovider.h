@@ -22,8 +22,11 @@
 #ifndef MU_DRAW_QFONTPROVIDER_H
 #define MU_DRAW_QFONTPROVIDER_H
 
+#include <mutex>
+
 #include <QHash>
 #include "infrastructure/draw/ifontprovider.h"
+#include "fontmetricscache.h"
 
 namespace mu::draw {
 class FontEngineFT;
@@ -57,10 +60,18 @@ public:
     RectF symBBox(const Font& f, uint ucs4, qreal DPI_F) const override;
     qreal symAdvance(const Font& f, uint ucs4, qreal DPI_F) const override;
 
+    FontMetricsCache::Stats metricsCacheStats() const;
+
 private:
 
+    FontMetricsCache::LineMetrics lineMetrics(const Font& f) const;
+
     FontEngineFT* symEngine(const Font& f) const;
 
+    mutable FontMetricsCache m_metricsCache;
+
+    //! NOTE FreeType faces are not thread-safe, so the symbol engines are used under the lock
+    mutable std::mutex m_symMutex;
     QHash<QString /*family*/, QString /*path*/> m_paths;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
 };
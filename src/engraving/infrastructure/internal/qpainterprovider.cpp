@@ -29,6 +29,8 @@
 #include <QPixmapCache>
 #include <QStaticText>
 #include <QPainterPath>
+#include <QThread>
+#include <QCoreApplication>
 
 #include "draw/utils/drawlogger.h"
 #include "draw/transform.h"
@@ -286,7 +288,7 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
 
 void QPainterProvider::drawSymbol(const PointF& point, uint ucs4Code)
 {
-    static QHash<uint, QString> cache;
+    thread_local QHash<uint, QString> cache;
     if (!cache.contains(ucs4Code)) {
         cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
     }
@@ -294,27 +296,34 @@ void QPainterProvider::drawSymbol(const PointF& point, uint ucs4Code)
     m_painter->drawText(QPointF(point.x(), point.y()), cache[ucs4Code]);
 }
 
-void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
+static QPixmap toQPixmap(const Pixmap& pm)
 {
-    QString key = QString::number(pm.key());
     QPixmap pixmap;
-    if (!QPixmapCache::find(key, &pixmap)) {
+
+    //! NOTE QPixmapCache can only be used from the GUI thread,
+    //! pages may be painted from worker threads (ex. parallel export of pages)
+    if (QThread::currentThread() != QCoreApplication::instance()->thread()) {
         pixmap.loadFromData(pm.data());
-        QPixmapCache::insert(key, pixmap);
+        return pixmap;
     }
 
-    m_painter->drawPixmap(QPointF(point.x(), point.y()), pixmap);
-}
-
-void QPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
-{
     QString key = QString::number(pm.key());
-    QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
         pixmap.loadFromData(pm.data());
         QPixmapCache::insert(key, pixmap);
     }
 
+    return pixmap;
+}
+
+void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
+{
+    m_painter->drawPixmap(QPointF(point.x(), point.y()), toQPixmap(pm));
+}
+
+void QPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
+{
+    QPixmap pixmap = toQPixmap(pm);
     m_painter->drawTiledPixmap(rect.toQRectF(), pixmap, QPointF(offset.x(), offset.y()));
 }
 
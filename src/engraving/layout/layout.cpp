@@ -217,6 +217,14 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
     doLayout(options, ctx);
 }
 
+void Layout::prepareParallelLayout(const LayoutOptions& options)
+{
+    CmdStateLocker cmdStateLocker(m_score);
+    LayoutMeasure::createMultiMeasureRests(options, m_score);
+    LayoutMeasure::updateDrumsetNoteHeads(m_score);
+    LayoutPage::removeDisabledDividers(m_score);
+}
+
 void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
 {
     MeasureBase* lmb;
@@ -38,6 +38,7 @@ public:
     Layout(Ms::Score* score);
 
     void doLayoutRange(const LayoutOptions& options, const Ms::Fraction&, const Ms::Fraction&);
+    void prepareParallelLayout(const LayoutOptions& options);
 
 private:
 
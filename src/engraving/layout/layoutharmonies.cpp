@@ -167,14 +167,14 @@ void LayoutHarmonies::alignHarmonies(const System* system, const std::vector<Seg
             for (EngravingItem* e : qAsConst(modified)) {
                 const Segment* s = toSegment(e->explicitParent());
                 const MeasureBase* m = toMeasureBase(s->explicitParent());
-                system->staff(e->staffIdx())->skyline().add(e->shape().translated(e->pos() + s->pos() + m->pos()));
+                system->staff(e->staffIdx())->skyline().add(e->shape(), e->pos() + s->pos() + m->pos());
                 if (e->isFretDiagram()) {
                     FretDiagram* fd = toFretDiagram(e);
                     Harmony* h = fd->harmony();
                     if (h) {
-                        system->staff(e->staffIdx())->skyline().add(h->shape().translated(h->pos() + fd->pos() + s->pos() + m->pos()));
+                        system->staff(e->staffIdx())->skyline().add(h->shape(), h->pos() + fd->pos() + s->pos() + m->pos());
                     } else {
-                        system->staff(e->staffIdx())->skyline().add(fd->shape().translated(fd->pos() + s->pos() + m->pos()));
+                        system->staff(e->staffIdx())->skyline().add(fd->shape(), fd->pos() + s->pos() + m->pos());
                     }
                 }
             }
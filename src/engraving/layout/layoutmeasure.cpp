@@ -390,7 +390,7 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
 //    multi measure rest
 //---------------------------------------------------------
 
-static bool validMMRestMeasure(const LayoutContext& ctx, Measure* m)
+static bool validMMRestMeasure(Score* score, Measure* m)
 {
     if (m->irregular()) {
         return false;
@@ -406,9 +406,9 @@ static bool validMMRestMeasure(const LayoutContext& ctx, Measure* m)
         }
         if (s->isChordRestType()) {
             bool restFound = false;
-            int tracks = ctx.score()->ntracks();
+            int tracks = score->ntracks();
             for (int track = 0; track < tracks; ++track) {
-                if ((track % VOICES) == 0 && !ctx.score()->staff(track / VOICES)->show()) {
+                if ((track % VOICES) == 0 && !score->staff(track / VOICES)->show()) {
                     track += VOICES - 1;
                     continue;
                 }
@@ -442,7 +442,7 @@ static bool validMMRestMeasure(const LayoutContext& ctx, Measure* m)
 //    multi measure rest
 //---------------------------------------------------------
 
-static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
+static bool breakMultiMeasureRest(Score* score, Measure* m)
 {
     if (m->breakMultiMeasureRest()) {
         return true;
@@ -456,7 +456,7 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
         return true;
     }
 
-    auto sl = ctx.score()->spannerMap().findOverlapping(m->tick().ticks(), m->endTick().ticks());
+    auto sl = score->spannerMap().findOverlapping(m->tick().ticks(), m->endTick().ticks());
     for (auto i : sl) {
         Spanner* s = i.value;
         // break for first measure of volta or textline and first measure *after* volta
@@ -491,7 +491,7 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
     }
 
     // break for MeasureRepeat group
-    for (int staffIdx = 0; staffIdx < ctx.score()->nstaves(); ++staffIdx) {
+    for (int staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
         if (m->isMeasureRepeatGroup(staffIdx)
             || (m->prevMeasure() && m->prevMeasure()->isMeasureRepeatGroup(staffIdx))) {
             return true;
@@ -506,12 +506,12 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
             if (e->isRehearsalMark()
                 || e->isTempoText()
                 || ((e->isHarmony() || e->isStaffText() || e->isSystemText() || e->isPlayTechAnnotation() || e->isInstrumentChange())
-                    && (e->systemFlag() || ctx.score()->staff(e->staffIdx())->show()))) {
+                    && (e->systemFlag() || score->staff(e->staffIdx())->show()))) {
                 return true;
             }
         }
-        for (int staffIdx = 0; staffIdx < ctx.score()->nstaves(); ++staffIdx) {
-            if (!ctx.score()->staff(staffIdx)->show()) {
+        for (int staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+            if (!score->staff(staffIdx)->show()) {
                 continue;
             }
             EngravingItem* e = s->element(staffIdx * VOICES);
@@ -534,7 +534,7 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
     if (pm) {
         Segment* s = pm->findSegmentR(SegmentType::EndBarLine, pm->ticks());
         if (s) {
-            for (int staffIdx = 0; staffIdx < ctx.score()->nstaves(); ++staffIdx) {
+            for (int staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
                 BarLine* bl = toBarLine(s->element(staffIdx * VOICES));
                 if (bl) {
                     BarLineType t = bl->barLineType();
@@ -553,6 +553,117 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
     return false;
 }
 
+//---------------------------------------------------------
+//   collectMMRestMeasures
+//    find the measures from firstMeasure on which can be
+//    shown as one multi measure rest, return their number
+//---------------------------------------------------------
+
+static int collectMMRestMeasures(const LayoutOptions& options, Score* score, Measure* firstMeasure,
+                                 Measure*& lastMeasure, Fraction& len)
+{
+    Measure* m = firstMeasure;
+    lastMeasure = firstMeasure;
+    len = Fraction(0, 1);
+    int n = 0;
+
+    while (validMMRestMeasure(score, m)) {
+        MeasureBase* mb = options.showVBox ? m->next() : m->nextMeasure();
+        if (breakMultiMeasureRest(score, m) && n) {
+            break;
+        }
+        ++n;
+        len += m->ticks();
+        lastMeasure = m;
+        if (!(mb && mb->isMeasure())) {
+            break;
+        }
+        m = toMeasure(mb);
+    }
+
+    return n;
+}
+
+//---------------------------------------------------------
+//   createMultiMeasureRests
+//    create, update or remove the multi measure rests of
+//    the whole score the same way getNextMeasure() does it,
+//    without laying out the measures
+//---------------------------------------------------------
+
+void LayoutMeasure::createMultiMeasureRests(const LayoutOptions& options, Score* score)
+{
+    if (!score->styleB(Sid::createMultiMeasureRests)) {
+        return;
+    }
+
+    Measure* m = score->firstMeasure();
+    while (m) {
+        Measure* lm = m;
+        Fraction len;
+
+        const int n = collectMMRestMeasures(options, score, m, lm, len);
+        if (n >= score->styleI(Sid::minEmptyMeasures)) {
+            createMMRest(options, score, m, lm, len);
+        } else {
+            if (m->mmRest()) {
+                score->undo(new ChangeMMRest(m, 0));
+            }
+            m->setMMRestCount(0);
+            lm = m;
+        }
+
+        m = lm->nextMeasure();
+    }
+}
+
+//---------------------------------------------------------
+//   updateDrumsetNoteHeads
+//    set the note heads of the drumset notes of the whole
+//    score the same way layoutDrumsetChord() does it,
+//    the head group is a linked property
+//---------------------------------------------------------
+
+static void updateDrumsetChordNoteHeads(Chord* c, const Drumset* drumset)
+{
+    for (Note* note : c->notes()) {
+        if (drumset->isValid(note->pitch()) && !note->fixed()) {
+            note->undoChangeProperty(Pid::HEAD_GROUP, int(drumset->noteHead(note->pitch())));
+        }
+    }
+}
+
+void LayoutMeasure::updateDrumsetNoteHeads(Score* score)
+{
+    for (Measure* measure = score->firstMeasure(); measure; measure = measure->nextMeasure()) {
+        for (int staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+            const Instrument* instrument = score->Score::staff(staffIdx)->part()->instrument(measure->tick());
+            if (!instrument->useDrumset()) {
+                continue;
+            }
+
+            const Drumset* drumset = instrument->drumset();
+            int track = staffIdx * VOICES;
+            int endTrack = track + VOICES;
+
+            for (Segment* segment = measure->first(SegmentType::ChordRest); segment; segment = segment->next(SegmentType::ChordRest)) {
+                for (int t = track; t < endTrack; ++t) {
+                    EngravingItem* e = segment->element(t);
+                    if (!e || !e->isChord()) {
+                        continue;
+                    }
+
+                    Chord* chord = toChord(e);
+                    for (Chord* c : chord->graceNotes()) {
+                        updateDrumsetChordNoteHeads(c, drumset);
+                    }
+                    updateDrumsetChordNoteHeads(chord, drumset);
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------
 //   layoutDrumsetChord
 //---------------------------------------------------------
@@ -594,26 +705,13 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
     if (ctx.curMeasure->isMeasure()) {
         if (ctx.score()->styleB(Sid::createMultiMeasureRests)) {
             Measure* m = toMeasure(ctx.curMeasure);
-            Measure* nm = m;
-            Measure* lm = nm;
-            int n       = 0;
+            Measure* lm = m;
             Fraction len;
 
-            while (validMMRestMeasure(ctx, nm)) {
-                MeasureBase* mb = options.showVBox ? nm->next() : nm->nextMeasure();
-                if (breakMultiMeasureRest(ctx, nm) && n) {
-                    break;
-                }
-                if (nm != m) {
-                    adjustMeasureNo(ctx, nm);
-                }
-                ++n;
-                len += nm->ticks();
-                lm = nm;
-                if (!(mb && mb->isMeasure())) {
-                    break;
-                }
-                nm = toMeasure(mb);
+            const int n = collectMMRestMeasures(options, score, m, lm, len);
+            for (Measure* nm = m; nm != lm;) {
+                nm = nm->nextMeasure();
+                adjustMeasureNo(ctx, nm);
             }
             if (n >= score->styleI(Sid::minEmptyMeasures)) {
                 createMMRest(options, score, m, lm, len);
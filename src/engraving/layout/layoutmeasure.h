@@ -39,6 +39,8 @@ public:
     LayoutMeasure() = default;
 
     static void getNextMeasure(const LayoutOptions& options, LayoutContext& lc);
+    static void createMultiMeasureRests(const LayoutOptions& options, Ms::Score* score);
+    static void updateDrumsetNoteHeads(Ms::Score* score);
 
 private:
 
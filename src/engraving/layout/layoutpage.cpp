@@ -477,6 +477,28 @@ void LayoutPage::checkDivider(const LayoutContext& ctx, bool left, System* s, qr
     }
 }
 
+//---------------------------------------------------------
+//   removeDisabledDividers
+//    remove the dividers which are not generated, if they
+//    are switched off in the style, like checkDivider() does
+//---------------------------------------------------------
+
+void LayoutPage::removeDisabledDividers(Score* score)
+{
+    for (bool left : { true, false }) {
+        if (score->styleB(left ? Sid::dividerLeft : Sid::dividerRight)) {
+            continue;
+        }
+
+        for (System* s : score->systems()) {
+            SystemDivider* divider = left ? s->systemDividerLeft() : s->systemDividerRight();
+            if (divider && !divider->generated()) {
+                score->undoRemoveElement(divider);
+            }
+        }
+    }
+}
+
 void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, qreal footerPadding)
 {
     Score* score = ctx.score();
@@ -37,6 +37,7 @@ public:
 
     static void getNextPage(const LayoutOptions& options, LayoutContext& lc);
     static void collectPage(const LayoutOptions& options, LayoutContext& lc);
+    static void removeDisabledDividers(Ms::Score* score);
 
 private:
     static void layoutPage(const LayoutContext& ctx, Ms::Page* page, qreal restHeight, qreal footerPadding);
@@ -723,7 +723,7 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
 
                         // add element to skyline
                         if (e->addToSkyline()) {
-                            skyline.add(e->shape().translated(e->pos() + p));
+                            skyline.add(e->shape(), e->pos() + p);
                         }
 
                         // add tremolo to skyline
@@ -733,7 +733,7 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
                             Chord* c2 = t->chord2();
                             if (!t->twoNotes() || (c1 && !c1->staffMove() && c2 && !c2->staffMove())) {
                                 if (t->chord() == e && t->addToSkyline()) {
-                                    skyline.add(t->shape().translated(t->pos() + e->pos() + p));
+                                    skyline.add(t->shape(), t->pos() + e->pos() + p);
                                 }
                             }
                         }
@@ -946,7 +946,7 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
         int si = d->staffIdx();
         Segment* s = d->segment();
         Measure* m = s->measure();
-        system->staff(si)->skyline().add(d->shape().translated(d->pos() + s->pos() + m->pos()));
+        system->staff(si)->skyline().add(d->shape(), d->pos() + s->pos() + m->pos());
     }
 
     //-------------------------------------------------------------
@@ -1121,7 +1121,7 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
                     ss->rypos() = y;
                 }
                 if (ss->addToSkyline()) {
-                    system->staff(staffIdx)->skyline().add(ss->shape().translated(ss->pos()));
+                    system->staff(staffIdx)->skyline().add(ss->shape(), ss->pos());
                 }
             }
 
@@ -1217,7 +1217,7 @@ void LayoutSystem::processLines(System* system, std::vector<Spanner*> lines, boo
     //
     for (SpannerSegment* ss : segments) {
         if (ss->addToSkyline()) {
-            system->staff(ss->staffIdx())->skyline().add(ss->shape().translated(ss->pos()));
+            system->staff(ss->staffIdx())->skyline().add(ss->shape(), ss->pos());
         }
     }
 }
@@ -1233,7 +1233,7 @@ void LayoutSystem::layoutTies(Chord* ch, System* system, const Fraction& stick)
         if (t) {
             TieSegment* ts = t->layoutFor(system);
             if (ts && ts->addToSkyline()) {
-                staff->skyline().add(ts->shape().translated(ts->pos()));
+                staff->skyline().add(ts->shape(), ts->pos());
             }
         }
         t = note->tieBack();
@@ -1241,7 +1241,7 @@ void LayoutSystem::layoutTies(Chord* ch, System* system, const Fraction& stick)
             if (t->startNote()->tick() < stick) {
                 TieSegment* ts = t->layoutBack(system);
                 if (ts && ts->addToSkyline()) {
-                    staff->skyline().add(ts->shape().translated(ts->pos()));
+                    staff->skyline().add(ts->shape(), ts->pos());
                 }
             }
         }
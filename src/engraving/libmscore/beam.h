@@ -26,6 +26,7 @@
 #include "engravingitem.h"
 #include "durationtype.h"
 #include "property.h"
+#include "objectpool.h"
 
 namespace mu::engraving {
 class Factory;
@@ -49,6 +50,8 @@ struct BeamFragment;
 
 class Beam final : public EngravingItem
 {
+    DECLARE_POOLED_ALLOCATION(Beam)
+
     QVector<ChordRest*> _elements;          // must be sorted by tick
     QVector<mu::LineF*> _beamSegments;
     DirectionV _direction    { DirectionV::AUTO };
@@ -35,6 +35,7 @@
 #include "infrastructure/draw/color.h"
 #include "chordrest.h"
 #include "articulation.h"
+#include "objectpool.h"
 
 namespace Ms {
 class Note;
@@ -70,6 +71,8 @@ enum class TremoloChordType : char {
 
 class Chord final : public ChordRest
 {
+    DECLARE_POOLED_ALLOCATION(Chord)
+
     std::vector<Note*> _notes;           // sorted to decreasing line step
     LedgerLine* _ledgerLines = nullptr;  // single linked list
 
@@ -114,7 +114,7 @@ void CmdState::reset()
     _oneElement = true;
     _mb = nullptr;
     _oneMeasureBase = true;
-    _locked = false;
+    _lockCount = 0;
 }
 
 //---------------------------------------------------------
@@ -123,7 +123,7 @@ void CmdState::reset()
 
 void CmdState::setTick(const Fraction& t)
 {
-    if (_locked) {
+    if (locked()) {
         return;
     }
 
@@ -143,7 +143,7 @@ void CmdState::setTick(const Fraction& t)
 void CmdState::setStaff(int st)
 {
     Q_ASSERT(st > -2);
-    if (_locked || st == -1) {
+    if (locked() || st == -1) {
         return;
     }
 
@@ -161,7 +161,7 @@ void CmdState::setStaff(int st)
 
 void CmdState::setMeasureBase(const MeasureBase* mb)
 {
-    if (!mb || _mb == mb || _locked) {
+    if (!mb || _mb == mb || locked()) {
         return;
     }
 
@@ -175,7 +175,7 @@ void CmdState::setMeasureBase(const MeasureBase* mb)
 
 void CmdState::setElement(const EngravingItem* e)
 {
-    if (!e || _el == e || _locked) {
+    if (!e || _el == e || locked()) {
         return;
     }
 
@@ -227,11 +227,22 @@ void CmdState::_setUpdateMode(UpdateMode m)
 
 void CmdState::setUpdateMode(UpdateMode m)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     if (int(m) > int(_updateMode)) {
         _setUpdateMode(m);
     }
 }
 
+//---------------------------------------------------------
+//   addLayoutFlags
+//---------------------------------------------------------
+
+void CmdState::addLayoutFlags(LayoutFlags f)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    layoutFlags |= f;
+}
+
 //---------------------------------------------------------
 //   startCmd
 ///   Start a GUI command by clearing the redraw area
@@ -341,9 +352,10 @@ void Score::update(bool resetCmdState)
         CmdState& cs = ms->cmdState();
         ms->deletePostponed();
         if (cs.layoutRange()) {
-            for (Score* s : ms->scoreList()) {
-                s->doLayoutRange(cs.startTick(), cs.endTick());
-            }
+            // the master score is the first in the list
+            ms->doLayoutRange(cs.startTick(), cs.endTick());
+            ms->doLayoutPartScores(ms->scoreList().mid(1), cs.startTick(), cs.endTick());
+
             updateAll = true;
         }
     }
@@ -353,6 +365,12 @@ void Score::update(bool resetCmdState)
         CmdState& cs = ms->cmdState();
         if (updateAll || cs.updateAll()) {
             for (Score* s : scoreList()) {
+                // the laid out pages are already marked as changed by the layout
+                if (!updateAll) {
+                    for (Page* page : s->pages()) {
+                        page->setContentChanged();
+                    }
+                }
                 for (MuseScoreView* v : qAsConst(s->viewer)) {
                     v->updateAll();
                 }
@@ -361,6 +379,11 @@ void Score::update(bool resetCmdState)
             // updateRange updates only current score
             qreal d = spatium() * .5;
             _updateState.refresh.adjust(-d, -d, 2 * d, 2 * d);
+            for (Page* page : pages()) {
+                if (page->canvasBoundingRect().intersects(_updateState.refresh)) {
+                    page->setContentChanged();
+                }
+            }
             for (MuseScoreView* v : qAsConst(viewer)) {
                 v->dataChanged(_updateState.refresh);
             }
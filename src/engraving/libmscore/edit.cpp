@@ -77,6 +77,8 @@
 #include "undo.h"
 #include "utils.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 
@@ -5810,6 +5812,10 @@ void Score::undoRemoveElement(EngravingItem* element)
     QList<Segment*> segments;
     for (EngravingObject* ee : element->linkList()) {
         EngravingItem* e = static_cast<EngravingItem*>(ee);
+        //! NOTE The other scores are laid out by other threads, see MasterScore::doLayoutPartScores
+        IF_ASSERT_FAILED(!LinkedObjects::frozen() || e->score() == this) {
+            continue;
+        }
         undo(new RemoveElement(e));
         if (e->explicitParent() && (e->explicitParent()->isSegment())) {
             Segment* s = toSegment(e->explicitParent());
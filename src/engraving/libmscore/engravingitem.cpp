@@ -183,16 +183,11 @@ EngravingItem::~EngravingItem()
 
 void EngravingItem::setupAccessible()
 {
-    static std::list<ElementType> accessibleDisabled = {
-        ElementType::LEDGER_LINE
-    };
-
-    if (score() && !score()->isPaletteScore()) {
-        if (std::find(accessibleDisabled.begin(), accessibleDisabled.end(), type()) == accessibleDisabled.end()) {
-            m_accessible = createAccessible();
-            m_accessible->setup();
-        }
+    if (type() == ElementType::LEDGER_LINE) {
+        return;
     }
+
+    m_accessibleEnabled = true;
 }
 
 EngravingItem* EngravingItem::parentItem() const
@@ -1952,9 +1947,25 @@ EngravingItem* EngravingItem::prevSegmentElement()
 
 mu::engraving::AccessibleItem* EngravingItem::accessible() const
 {
+    if (m_accessible || !m_accessibleEnabled || !AccessibleItem::enabled) {
+        return m_accessible;
+    }
+
+    if (!score() || score()->isPaletteScore()) {
+        return nullptr;
+    }
+
+    m_accessible = const_cast<EngravingItem*>(this)->createAccessible();
+    m_accessible->setup();
+
     return m_accessible;
 }
 
+bool EngravingItem::accessibleEnabled() const
+{
+    return m_accessibleEnabled;
+}
+
 //---------------------------------------------------------
 //   accessibleInfo
 //---------------------------------------------------------
@@ -2650,20 +2661,22 @@ void EngravingItem::setSelected(bool f)
     setFlag(ElementFlag::SELECTED, f);
 
     if (f) {
-        if (m_accessible) {
-            AccessibleRoot* accRoot = score()->rootItem()->accessible()->accessibleRoot();
+        if (AccessibleItem* accessibleItem = accessible()) {
+            AccessibleItem* rootAccessible = score()->rootItem()->accessible();
+            AccessibleRoot* accRoot = rootAccessible ? rootAccessible->accessibleRoot() : nullptr;
             if (accRoot && accRoot->registered()) {
                 accRoot->setFocusedElement(nullptr);
             }
 
-            AccessibleRoot* dummyAccRoot = score()->dummy()->rootItem()->accessible()->accessibleRoot();
+            AccessibleItem* dummyRootAccessible = score()->dummy()->rootItem()->accessible();
+            AccessibleRoot* dummyAccRoot = dummyRootAccessible ? dummyRootAccessible->accessibleRoot() : nullptr;
             if (dummyAccRoot && dummyAccRoot->registered()) {
                 dummyAccRoot->setFocusedElement(nullptr);
             }
 
-            AccessibleRoot* currAccRoot = m_accessible->accessibleRoot();
+            AccessibleRoot* currAccRoot = accessibleItem->accessibleRoot();
             if (currAccRoot && currAccRoot->registered()) {
-                currAccRoot->setFocusedElement(m_accessible);
+                currAccRoot->setFocusedElement(accessibleItem);
             }
         }
     }
@@ -194,7 +194,7 @@ public:
 
 class EngravingItem : public EngravingObject
 {
-    INJECT_STATIC(engraving, mu::engraving::IEngravingConfiguration, engravingConfiguration)
+    INJECT_PINNED(engraving, mu::engraving::IEngravingConfiguration, engravingConfiguration)
 
     mutable mu::RectF _bbox;  ///< Bounding box relative to _pos + _offset
     qreal _mag;                     ///< standard magnification (derived value)
@@ -208,7 +208,9 @@ class EngravingItem : public EngravingObject
     ///< valid after call to layout()
     uint _tag;                    ///< tag bitmask
 
-    mu::engraving::AccessibleItem* m_accessible = nullptr;
+    //! NOTE The accessible item is created on the first request (by an accessibility client or on focus)
+    mutable mu::engraving::AccessibleItem* m_accessible = nullptr;
+    bool m_accessibleEnabled = false;
 
 protected:
     mutable int _z;
@@ -568,6 +570,9 @@ public:
     virtual EngravingItem* prevSegmentElement();    //< next-element and prev-element command
 
     mu::engraving::AccessibleItem* accessible() const;
+    //! NOTE Unlike accessible(), doesn't create the item, for the notifications nobody listens to without it
+    mu::engraving::AccessibleItem* accessibleIfCreated() const { return m_accessible; }
+    bool accessibleEnabled() const;
     virtual QString accessibleInfo() const;           //< used to populate the status bar
     virtual QString screenReaderInfo() const          //< by default returns accessibleInfo, but can be overridden
     {
@@ -22,6 +22,7 @@
 
 #include "engravingobject.h"
 
+#include <algorithm>
 #include <iterator>
 #include <unordered_set>
 
@@ -51,7 +52,15 @@ ElementStyle const EngravingObject::emptyStyle;
 
 EngravingObject* EngravingObjectList::at(size_t i) const
 {
-    return *std::next(begin(), i);
+    return std::vector<EngravingObject*>::at(i);
+}
+
+void EngravingObjectList::remove(EngravingObject* o)
+{
+    auto it = std::find(rbegin(), rend(), o);
+    if (it != rend()) {
+        erase(std::next(it).base());
+    }
 }
 
 EngravingObject::EngravingObject(const ElementType& type, EngravingObject* parent)
@@ -120,6 +129,10 @@ EngravingObject::~EngravingObject()
     }
 
     if (_links) {
+        //! NOTE Can't be skipped, a deleted element must not stay in the list
+        IF_ASSERT_FAILED(!LinkedObjects::frozen()) {
+            LOGE() << "linked " << typeName() << " deleted during the parallel layout";
+        }
         _links->removeOne(this);
         if (_links->empty()) {
             delete _links;
@@ -409,12 +422,30 @@ static void changeProperty(EngravingObject* e, Pid t, const PropertyValue& st, P
 
 static void changeProperties(EngravingObject* e, Pid t, const PropertyValue& st, PropertyFlags ps)
 {
-    if (propertyLink(t)) {
-        for (EngravingObject* ee : e->linkList()) {
+    if (!propertyLink(t)) {
+        changeProperty(e, t, st, ps);
+        return;
+    }
+
+    //! NOTE The linked elements are changed with one command,
+    //! with many parts and linked staves there are a lot of them
+    std::vector<ChangeLinkedProperty::Member> members;
+    for (EngravingObject* ee : e->linkList()) {
+        if (ee->isBracketItem()) {
             changeProperty(ee, t, st, ps);
+        } else if (ee->getProperty(t) != st || ee->propertyFlags(t) != ps) {
+            //! NOTE The other scores are laid out by other threads, see MasterScore::doLayoutPartScores
+            IF_ASSERT_FAILED(!LinkedObjects::frozen() || ee->score() == e->score()) {
+                continue;
+            }
+            members.push_back({ ee, st, ps });
         }
-    } else {
-        changeProperty(e, t, st, ps);
+    }
+
+    if (members.size() == 1) {
+        changeProperty(members.front().element, t, st, ps);
+    } else if (!members.empty()) {
+        e->score()->undo(new ChangeLinkedProperty(t, std::move(members)));
     }
 }
 
@@ -648,6 +679,10 @@ void EngravingObject::linkTo(EngravingObject* element)
     Q_ASSERT(element != this);
     Q_ASSERT(!_links);
 
+    IF_ASSERT_FAILED(!LinkedObjects::frozen()) {
+        return;
+    }
+
     if (element->links()) {
         _links = element->_links;
         Q_ASSERT(_links->contains(element));
@@ -674,6 +709,10 @@ void EngravingObject::unlink()
         return;
     }
 
+    IF_ASSERT_FAILED(!LinkedObjects::frozen()) {
+        return;
+    }
+
     Q_ASSERT(_links->contains(this));
     _links->removeOne(this);
 
@@ -23,6 +23,8 @@
 #ifndef MU_ENGRAVING_OBJECT_H
 #define MU_ENGRAVING_OBJECT_H
 
+#include <vector>
+
 #include "types.h"
 #include "infrastructure/draw/geometry.h"
 #include "style/styledef.h"
@@ -167,16 +169,20 @@ enum class PropertyFlags : char;
 class LinkedObjects;
 class EngravingObject;
 
-class EngravingObjectList : public std::list<EngravingObject*>
+//! NOTE The children are iterated much more often than removed,
+//! so they are kept contiguous, the removal searches from the back
+//! because usually the last added child is removed first
+class EngravingObjectList : public std::vector<EngravingObject*>
 {
 public:
 
     EngravingObject* at(size_t i) const;
+    void remove(EngravingObject* o);
 };
 
 class EngravingObject
 {
-    INJECT_STATIC(engraving, mu::diagnostics::IEngravingElementsProvider, elementsProvider)
+    INJECT_PINNED(engraving, mu::diagnostics::IEngravingElementsProvider, elementsProvider)
 
     ElementType m_type = ElementType::INVALID;
     EngravingObject* m_parent = nullptr;
@@ -289,6 +289,32 @@ void Excerpt::createExcerpt(Excerpt* excerpt)
     MasterScore* oscore = excerpt->oscore();
     Score* score        = excerpt->partScore();
 
+    clonePartScore(excerpt);
+
+    // initial layout of score
+    score->addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
+    score->doLayout();
+
+    transposePartScore(excerpt);
+
+    // second layout of score
+    score->setPlaylistDirty();
+    oscore->rebuildMidiMapping();
+    oscore->updateChannel();
+
+    score->setLayoutAll();
+    score->doLayout();
+}
+
+//---------------------------------------------------------
+//   clonePartScore
+//---------------------------------------------------------
+
+void Excerpt::clonePartScore(Excerpt* excerpt)
+{
+    MasterScore* oscore = excerpt->oscore();
+    Score* score        = excerpt->partScore();
+
     QList<Part*>& parts = excerpt->parts();
     QList<int> srcStaves;
 
@@ -356,10 +382,16 @@ void Excerpt::createExcerpt(Excerpt* excerpt)
         measure->add(txt);
         score->setMetaTag("partName", partLabel);
     }
+}
 
-    // initial layout of score
-    score->addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
-    score->doLayout();
+//---------------------------------------------------------
+//   transposePartScore
+//---------------------------------------------------------
+
+void Excerpt::transposePartScore(Excerpt* excerpt)
+{
+    MasterScore* oscore = excerpt->oscore();
+    Score* score        = excerpt->partScore();
 
     // handle transposing instruments
     if (oscore->styleB(Sid::concertPitch) != score->styleB(Sid::concertPitch)) {
@@ -427,14 +459,6 @@ void Excerpt::createExcerpt(Excerpt* excerpt)
         //score->spatiumChanged(oscore->spatium(), score->spatium());
         score->styleChanged();
     }
-
-    // second layout of score
-    score->setPlaylistDirty();
-    oscore->rebuildMidiMapping();
-    oscore->updateChannel();
-
-    score->setLayoutAll();
-    score->doLayout();
 }
 
 //---------------------------------------------------------
@@ -508,6 +532,60 @@ void MasterScore::initAndAddExcerpt(Excerpt* excerpt, bool fakeUndo)
     Excerpt::createExcerpt(excerpt);
 }
 
+//---------------------------------------------------------
+//   initAndAddExcerpts
+//    same as initAndAddExcerpt() for every excerpt,
+//    but the part scores are laid out together,
+//    in parallel if configured (see doLayoutPartScores())
+//---------------------------------------------------------
+
+void MasterScore::initAndAddExcerpts(const QList<Excerpt*>& excerpts, bool fakeUndo)
+{
+    TRACEFUNC;
+
+    //! NOTE The parts are cloned one by one, only their layout runs in parallel.
+    //! The cloning can't run on worker threads as is: linkTo() creates the link lists
+    //! of the master score elements and takes the link ids from the master score,
+    //! the copy constructors of chords, notes, tuplets and spanners link their children too,
+    //! the slur, tie and tuplet lookups read the link lists of the master score elements
+    //! while they are filled, and score->undo() executes the commands on push.
+    //! Cloning into private link lists would need all of these to be redirected first.
+    QList<Score*> partScores;
+    for (Excerpt* excerpt : excerpts) {
+        Score* score = new Score(masterScore());
+        excerpt->setPartScore(score);
+        score->style().set(Sid::createMultiMeasureRests, true);
+        auto excerptCmd = new AddExcerpt(excerpt);
+        if (fakeUndo) {
+            excerptCmd->redo(nullptr);
+        } else {
+            score->undo(excerptCmd);
+        }
+        Excerpt::clonePartScore(excerpt);
+        partScores.push_back(score);
+    }
+
+    if (partScores.empty()) {
+        return;
+    }
+
+    // initial layout of scores
+    addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
+    doLayoutPartScores(partScores, Fraction(0, 1), Fraction(-1, 1));
+
+    for (Excerpt* excerpt : excerpts) {
+        Excerpt::transposePartScore(excerpt);
+        excerpt->partScore()->setPlaylistDirty();
+    }
+
+    // second layout of scores
+    rebuildMidiMapping();
+    updateChannel();
+
+    setLayoutAll();
+    doLayoutPartScores(partScores, Fraction(0, 1), Fraction(-1, 1));
+}
+
 void MasterScore::initEmptyExcerpt(Excerpt* excerpt)
 {
     Excerpt::cloneMeasures(this, excerpt->partScore());
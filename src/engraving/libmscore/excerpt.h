@@ -97,6 +97,12 @@ public:
     static void cloneStaff2(Staff* ostaff, Staff* nstaff, const Fraction& startTick, const Fraction& endTick);
 
 private:
+    friend class MasterScore;
+
+    //! NOTE The steps of createExcerpt(), the part score is laid out after each of them
+    static void clonePartScore(Excerpt*);
+    static void transposePartScore(Excerpt*);
+
     static QString formatTitle(const QString& partName, const QList<Excerpt*>&);
 };
 }     // namespace Ms
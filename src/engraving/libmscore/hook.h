@@ -24,12 +24,15 @@
 #define __HOOK_H__
 
 #include "symbol.h"
+#include "objectpool.h"
 
 namespace Ms {
 class Chord;
 
 class Hook final : public Symbol
 {
+    DECLARE_POOLED_ALLOCATION(Hook)
+
     int _hookType { 0 };
 
 public:
@@ -85,12 +85,38 @@ static InstrumentFamily* searchInstrumentFamily(const QString& name)
     return nullptr;
 }
 
+//---------------------------------------------------------
+//   setInstrumentTemplatesLoader
+//    the templates are loaded on the first use, not on the startup,
+//    the loader is set by the instruments repository
+//---------------------------------------------------------
+
+static std::function<void()> s_instrumentTemplatesLoader;
+
+void setInstrumentTemplatesLoader(const std::function<void()>& loader)
+{
+    s_instrumentTemplatesLoader = loader;
+}
+
+//---------------------------------------------------------
+//   ensureInstrumentTemplatesLoaded
+//---------------------------------------------------------
+
+void ensureInstrumentTemplatesLoaded()
+{
+    if (s_instrumentTemplatesLoader) {
+        s_instrumentTemplatesLoader();
+    }
+}
+
 //---------------------------------------------------------
 //   searchInstrumentGroup
 //---------------------------------------------------------
 
 InstrumentGroup* searchInstrumentGroup(const QString& name)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
         if (g->id == name) {
             return g;
@@ -728,6 +754,8 @@ bool loadInstrumentTemplates(const QString& instrTemplates)
 
 InstrumentTemplate* searchTemplate(const QString& name)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
         for (InstrumentTemplate* it : qAsConst(g->instrumentTemplates)) {
             if (it->id == name) {
@@ -744,6 +772,8 @@ InstrumentTemplate* searchTemplate(const QString& name)
 
 InstrumentTemplate* searchTemplateForMusicXmlId(const QString& mxmlId)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
         for (InstrumentTemplate* it : qAsConst(g->instrumentTemplates)) {
             if (it->musicXMLid == mxmlId) {
@@ -756,6 +786,8 @@ InstrumentTemplate* searchTemplateForMusicXmlId(const QString& mxmlId)
 
 InstrumentTemplate* searchTemplateForInstrNameList(const QList<QString>& nameList)
 {
+    ensureInstrumentTemplatesLoaded();
+
     InstrumentTemplate* bestMatch = nullptr; // default if no matches
     int bestMatchStrength = 0; // higher for better matches
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
@@ -786,6 +818,8 @@ InstrumentTemplate* searchTemplateForInstrNameList(const QList<QString>& nameLis
 
 InstrumentTemplate* searchTemplateForMidiProgram(int midiProgram, const bool useDrumSet)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
         for (InstrumentTemplate* it : qAsConst(g->instrumentTemplates)) {
             if (it->channel.empty() || it->useDrumset != useDrumSet) {
@@ -802,6 +836,8 @@ InstrumentTemplate* searchTemplateForMidiProgram(int midiProgram, const bool use
 
 InstrumentTemplate* guessTemplateByNameData(const QList<QString>& nameDataList)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
         for (InstrumentTemplate* it : qAsConst(g->instrumentTemplates)) {
             for (const QString& name : nameDataList) {
@@ -833,6 +869,8 @@ InstrumentTemplate* guessTemplateByNameData(const QList<QString>& nameDataList)
 
 InstrumentIndex searchTemplateIndexForTrackName(const QString& trackName)
 {
+    ensureInstrumentTemplatesLoaded();
+
     int instIndex = 0;
     int grpIndex = 0;
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
@@ -853,6 +891,8 @@ InstrumentIndex searchTemplateIndexForTrackName(const QString& trackName)
 
 InstrumentIndex searchTemplateIndexForId(const QString& id)
 {
+    ensureInstrumentTemplatesLoaded();
+
     int instIndex = 0;
     int grpIndex = 0;
     for (InstrumentGroup* g : instrumentGroups) {
@@ -23,6 +23,8 @@
 #ifndef __INSTRTEMPLATE_H__
 #define __INSTRTEMPLATE_H__
 
+#include <functional>
+
 #include "mscore.h"
 #include "instrument.h"
 #include "clef.h"
@@ -170,6 +172,8 @@ extern QList<InstrumentFamily*> instrumentFamilies;
 extern QList<MidiArticulation> articulation;
 extern QList<InstrumentGroup*> instrumentGroups;
 extern QList<ScoreOrder> instrumentOrders;
+extern void setInstrumentTemplatesLoader(const std::function<void()>& loader);
+extern void ensureInstrumentTemplatesLoaded();
 extern void clearInstrumentTemplates();
 extern bool loadInstrumentTemplates(const QString& instrTemplates);
 extern InstrumentTemplate* searchTemplate(const QString& name);
@@ -0,0 +1,526 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "instrtemplatecache.h"
+
+#include <QDataStream>
+#include <QIODevice>
+
+#include "drumset.h"
+#include "instrtemplate.h"
+#include "scoreorder.h"
+#include "stafftype.h"
+
+#include "log.h"
+
+namespace Ms {
+static constexpr quint32 CACHE_MAGIC = 0x4D534954;   // "MSIT"
+static constexpr quint32 CACHE_VERSION = 1;
+static constexpr QDataStream::Version STREAM_VERSION = QDataStream::Qt_5_15;
+
+template<typename E>
+static void writeEnum(QDataStream& s, E v)
+{
+    s << static_cast<qint32>(v);
+}
+
+template<typename E>
+static E readEnum(QDataStream& s)
+{
+    qint32 v = 0;
+    s >> v;
+    return static_cast<E>(v);
+}
+
+static qint8 readInt8(QDataStream& s)
+{
+    qint8 v = 0;
+    s >> v;
+    return v;
+}
+
+static qint32 readInt(QDataStream& s)
+{
+    qint32 v = 0;
+    s >> v;
+    return v;
+}
+
+static bool readBool(QDataStream& s)
+{
+    bool v = false;
+    s >> v;
+    return v;
+}
+
+static QString readString(QDataStream& s)
+{
+    QString v;
+    s >> v;
+    return v;
+}
+
+//---------------------------------------------------------
+//   write
+//---------------------------------------------------------
+
+static void writeStaffNames(QDataStream& s, const StaffNameList& names)
+{
+    s << qint32(names.size());
+    for (const StaffName& n : names) {
+        s << n.name() << qint32(n.pos());
+    }
+}
+
+static void writeEventLists(QDataStream& s, const QList<NamedEventList>& lists)
+{
+    s << qint32(lists.size());
+    for (const NamedEventList& l : lists) {
+        s << l.name << l.descr << qint32(l.events.size());
+        for (const MidiCoreEvent& e : l.events) {
+            s << quint8(e.type()) << quint8(e.channel()) << quint8(e.dataA()) << quint8(e.dataB());
+        }
+    }
+}
+
+static void writeArticulations(QDataStream& s, const QList<MidiArticulation>& articulations)
+{
+    s << qint32(articulations.size());
+    for (const MidiArticulation& a : articulations) {
+        s << a.name << a.descr << qint32(a.velocity) << qint32(a.gateTime);
+    }
+}
+
+static void writeChannel(QDataStream& s, const Channel& c)
+{
+    s << c.name() << c.descr() << c.synti() << qint32(c.color());
+    s << qint8(c.volume()) << qint8(c.pan()) << qint8(c.chorus()) << qint8(c.reverb());
+    s << qint32(c.program()) << qint32(c.bank()) << qint32(c.channel());
+    s << c.soloMute() << c.mute() << c.solo() << c.userBankController();
+    writeEventLists(s, c.midiActions);
+    writeArticulations(s, c.articulation);
+}
+
+static void writeDrumset(QDataStream& s, const Drumset* drumset)
+{
+    s << bool(drumset != nullptr);
+    if (!drumset) {
+        return;
+    }
+
+    for (int pitch = 0; pitch < DRUM_INSTRUMENTS; ++pitch) {
+        const DrumInstrument& d = drumset->drum(pitch);
+        s << d.name;
+        writeEnum(s, d.notehead);
+        for (int i = 0; i < int(NoteHeadType::HEAD_TYPES); ++i) {
+            writeEnum(s, d.noteheads[i]);
+        }
+        s << qint32(d.line);
+        writeEnum(s, d.stemDirection);
+        s << qint32(d.voice) << qint8(d.shortcut);
+
+        s << qint32(d.variants.size());
+        for (const DrumInstrumentVariant& v : d.variants) {
+            s << qint32(v.pitch) << v.articulationName;
+            writeEnum(s, v.tremolo);
+        }
+    }
+}
+
+static void writeTemplate(QDataStream& s, const InstrumentTemplate& t)
+{
+    s << t.id << t.trackName;
+    writeStaffNames(s, t.longNames);
+    writeStaffNames(s, t.shortNames);
+    s << t.musicXMLid << t.description;
+    s << qint32(t.staffCount) << qint32(t.sequenceOrder);
+
+    s << t.trait.name;
+    writeEnum(s, t.trait.type);
+    s << t.trait.isDefault << t.trait.isHiddenOnScore;
+
+    s << qint8(t.minPitchA) << qint8(t.maxPitchA) << qint8(t.minPitchP) << qint8(t.maxPitchP);
+    s << qint8(t.transpose.diatonic) << qint8(t.transpose.chromatic);
+
+    writeEnum(s, t.staffGroup);
+    s << (t.staffTypePreset ? t.staffTypePreset->xmlName() : QString());
+    s << t.useDrumset;
+    writeDrumset(s, t.drumset);
+
+    s << qint32(t.stringData.frets()) << qint32(t.stringData.stringList().size());
+    for (const instrString& str : t.stringData.stringList()) {
+        s << qint32(str.pitch) << str.open << qint32(str.startFret);
+    }
+
+    writeEventLists(s, t.midiActions);
+    writeArticulations(s, t.articulation);
+
+    s << qint32(t.channel.size());
+    for (const Channel& c : t.channel) {
+        writeChannel(s, c);
+    }
+
+    s << qint32(t.genres.size());
+    for (const InstrumentGenre* g : t.genres) {
+        s << qint32(instrumentGenres.indexOf(const_cast<InstrumentGenre*>(g)));
+    }
+    s << qint32(instrumentFamilies.indexOf(t.family));
+
+    for (int i = 0; i < MAX_STAVES; ++i) {
+        writeEnum(s, t.clefTypes[i]._concertClef);
+        writeEnum(s, t.clefTypes[i]._transposingClef);
+        s << qint32(t.staffLines[i]);
+        writeEnum(s, t.bracket[i]);
+        s << qint32(t.bracketSpan[i]) << qint32(t.barlineSpan[i]) << t.smallStaff[i];
+    }
+
+    s << t.extended << t.singleNoteDynamics << t.groupId;
+}
+
+static void writeScoreOrder(QDataStream& s, const ScoreOrder& order)
+{
+    s << order.id << order.name << order.customized;
+
+    s << qint32(order.instrumentMap.size());
+    for (auto it = order.instrumentMap.cbegin(); it != order.instrumentMap.cend(); ++it) {
+        s << it.key() << it.value().id << it.value().name;
+    }
+
+    s << qint32(order.groups.size());
+    for (const ScoreGroup& g : order.groups) {
+        s << g.family << g.section << g.unsorted << g.bracket << g.showSystemMarkings << g.barLineSpan << g.thinBracket;
+    }
+}
+
+bool writeInstrumentTemplatesCache(QIODevice* device, const QByteArray& sourceHash)
+{
+    TRACEFUNC;
+
+    QDataStream s(device);
+    s.setVersion(STREAM_VERSION);
+
+    s << CACHE_MAGIC << CACHE_VERSION << sourceHash;
+
+    writeArticulations(s, articulation);
+
+    s << qint32(instrumentGenres.size());
+    for (const InstrumentGenre* g : qAsConst(instrumentGenres)) {
+        s << g->id << g->name;
+    }
+
+    s << qint32(instrumentFamilies.size());
+    for (const InstrumentFamily* f : qAsConst(instrumentFamilies)) {
+        s << f->id << f->name;
+    }
+
+    s << qint32(instrumentGroups.size());
+    for (const InstrumentGroup* g : qAsConst(instrumentGroups)) {
+        s << g->id << g->name << g->extended << qint32(g->instrumentTemplates.size());
+        for (const InstrumentTemplate* t : g->instrumentTemplates) {
+            writeTemplate(s, *t);
+        }
+    }
+
+    s << qint32(instrumentOrders.size());
+    for (const ScoreOrder& order : qAsConst(instrumentOrders)) {
+        writeScoreOrder(s, order);
+    }
+
+    return s.status() == QDataStream::Ok;
+}
+
+//---------------------------------------------------------
+//   read
+//---------------------------------------------------------
+
+static StaffNameList readStaffNames(QDataStream& s)
+{
+    StaffNameList names;
+    int count = readInt(s);
+    for (int i = 0; i < count && s.status() == QDataStream::Ok; ++i) {
+        QString name = readString(s);
+        int pos = readInt(s);
+        names.append(StaffName(name, pos));
+    }
+    return names;
+}
+
+static QList<NamedEventList> readEventLists(QDataStream& s)
+{
+    QList<NamedEventList> lists;
+    int count = readInt(s);
+    for (int i = 0; i < count && s.status() == QDataStream::Ok; ++i) {
+        NamedEventList l;
+        l.name = readString(s);
+        l.descr = readString(s);
+
+        int eventsCount = readInt(s);
+        for (int j = 0; j < eventsCount && s.status() == QDataStream::Ok; ++j) {
+            quint8 type = 0, channel = 0, a = 0, b = 0;
+            s >> type >> channel >> a >> b;
+            l.events.push_back(MidiCoreEvent(type, channel, a, b));
+        }
+
+        lists.append(l);
+    }
+    return lists;
+}
+
+static QList<MidiArticulation> readArticulations(QDataStream& s)
+{
+    QList<MidiArticulation> articulations;
+    int count = readInt(s);
+    for (int i = 0; i < count && s.status() == QDataStream::Ok; ++i) {
+        MidiArticulation a;
+        a.name = readString(s);
+        a.descr = readString(s);
+        a.velocity = readInt(s);
+        a.gateTime = readInt(s);
+        articulations.append(a);
+    }
+    return articulations;
+}
+
+static Channel readChannel(QDataStream& s)
+{
+    Channel c;
+    c.setName(readString(s));
+    c.setDescr(readString(s));
+    c.setSynti(readString(s));
+    c.setColor(readInt(s));
+    c.setVolume(readInt8(s));
+    c.setPan(readInt8(s));
+    c.setChorus(readInt8(s));
+    c.setReverb(readInt8(s));
+    c.setProgram(readInt(s));
+    c.setBank(readInt(s));
+    c.setChannel(readInt(s));
+    c.setSoloMute(readBool(s));
+    c.setMute(readBool(s));
+    c.setSolo(readBool(s));
+    c.setUserBankController(readBool(s));
+    c.midiActions = readEventLists(s);
+    c.articulation = readArticulations(s);
+    return c;
+}
+
+static Drumset* readDrumset(QDataStream& s)
+{
+    if (!readBool(s)) {
+        return nullptr;
+    }
+
+    Drumset* drumset = new Drumset();
+    for (int pitch = 0; pitch < DRUM_INSTRUMENTS && s.status() == QDataStream::Ok; ++pitch) {
+        DrumInstrument& d = drumset->drum(pitch);
+        d.name = readString(s);
+        d.notehead = readEnum<NoteHeadGroup>(s);
+        for (int i = 0; i < int(NoteHeadType::HEAD_TYPES); ++i) {
+            d.noteheads[i] = readEnum<SymId>(s);
+        }
+        d.line = readInt(s);
+        d.stemDirection = readEnum<DirectionV>(s);
+        d.voice = readInt(s);
+        d.shortcut = readInt8(s);
+
+        d.variants.clear();
+        int variantsCount = readInt(s);
+        for (int i = 0; i < variantsCount && s.status() == QDataStream::Ok; ++i) {
+            DrumInstrumentVariant v;
+            v.pitch = readInt(s);
+            v.articulationName = readString(s);
+            v.tremolo = readEnum<TremoloType>(s);
+            d.variants.append(v);
+        }
+    }
+    return drumset;
+}
+
+static InstrumentTemplate* readTemplate(QDataStream& s)
+{
+    InstrumentTemplate* t = new InstrumentTemplate();
+    t->id = readString(s);
+    t->trackName = readString(s);
+    t->longNames = readStaffNames(s);
+    t->shortNames = readStaffNames(s);
+    t->musicXMLid = readString(s);
+    t->description = readString(s);
+    t->staffCount = readInt(s);
+    t->sequenceOrder = readInt(s);
+
+    t->trait.name = readString(s);
+    t->trait.type = readEnum<TraitType>(s);
+    t->trait.isDefault = readBool(s);
+    t->trait.isHiddenOnScore = readBool(s);
+
+    t->minPitchA = readInt8(s);
+    t->maxPitchA = readInt8(s);
+    t->minPitchP = readInt8(s);
+    t->maxPitchP = readInt8(s);
+    t->transpose.diatonic = readInt8(s);
+    t->transpose.chromatic = readInt8(s);
+
+    t->staffGroup = readEnum<StaffGroup>(s);
+    QString presetName = readString(s);
+    t->staffTypePreset = presetName.isEmpty() ? nullptr : StaffType::presetFromXmlName(presetName);
+    t->useDrumset = readBool(s);
+    t->drumset = readDrumset(s);
+
+    t->stringData.setFrets(readInt(s));
+    int stringsCount = readInt(s);
+    for (int i = 0; i < stringsCount && s.status() == QDataStream::Ok; ++i) {
+        int pitch = readInt(s);
+        bool open = readBool(s);
+        int startFret = readInt(s);
+        t->stringData.stringList().append(instrString(pitch, open, startFret));
+    }
+
+    t->midiActions = readEventLists(s);
+    t->articulation = readArticulations(s);
+
+    int channelsCount = readInt(s);
+    for (int i = 0; i < channelsCount && s.status() == QDataStream::Ok; ++i) {
+        t->channel.append(readChannel(s));
+    }
+
+    int genresCount = readInt(s);
+    for (int i = 0; i < genresCount && s.status() == QDataStream::Ok; ++i) {
+        int idx = readInt(s);
+        if (idx >= 0 && idx < instrumentGenres.size()) {
+            t->genres.append(instrumentGenres.at(idx));
+        }
+    }
+
+    int familyIdx = readInt(s);
+    t->family = (familyIdx >= 0 && familyIdx < instrumentFamilies.size()) ? instrumentFamilies.at(familyIdx) : nullptr;
+
+    for (int i = 0; i < MAX_STAVES; ++i) {
+        t->clefTypes[i]._concertClef = readEnum<ClefType>(s);
+        t->clefTypes[i]._transposingClef = readEnum<ClefType>(s);
+        t->staffLines[i] = readInt(s);
+        t->bracket[i] = readEnum<BracketType>(s);
+        t->bracketSpan[i] = readInt(s);
+        t->barlineSpan[i] = readInt(s);
+        t->smallStaff[i] = readBool(s);
+    }
+
+    t->extended = readBool(s);
+    t->singleNoteDynamics = readBool(s);
+    t->groupId = readString(s);
+
+    return t;
+}
+
+static ScoreOrder readScoreOrder(QDataStream& s)
+{
+    ScoreOrder order;
+    order.id = readString(s);
+    order.name = readString(s);
+    order.customized = readBool(s);
+
+    int instrumentsCount = readInt(s);
+    for (int i = 0; i < instrumentsCount && s.status() == QDataStream::Ok; ++i) {
+        QString key = readString(s);
+        InstrumentOverwrite overwrite;
+        overwrite.id = readString(s);
+        overwrite.name = readString(s);
+        order.instrumentMap.insert(key, overwrite);
+    }
+
+    int groupsCount = readInt(s);
+    for (int i = 0; i < groupsCount && s.status() == QDataStream::Ok; ++i) {
+        ScoreGroup g;
+        g.family = readString(s);
+        g.section = readString(s);
+        g.unsorted = readString(s);
+        g.bracket = readBool(s);
+        g.showSystemMarkings = readBool(s);
+        g.barLineSpan = readBool(s);
+        g.thinBracket = readBool(s);
+        order.groups.append(g);
+    }
+
+    return order;
+}
+
+bool readInstrumentTemplatesCache(QIODevice* device, const QByteArray& sourceHash)
+{
+    TRACEFUNC;
+
+    clearInstrumentTemplates();
+
+    QDataStream s(device);
+    s.setVersion(STREAM_VERSION);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray hash;
+    s >> magic >> version >> hash;
+    if (s.status() != QDataStream::Ok || magic != CACHE_MAGIC || version != CACHE_VERSION || hash != sourceHash) {
+        return false;
+    }
+
+    articulation = readArticulations(s);
+
+    int genresCount = readInt(s);
+    for (int i = 0; i < genresCount && s.status() == QDataStream::Ok; ++i) {
+        InstrumentGenre* g = new InstrumentGenre();
+        g->id = readString(s);
+        g->name = readString(s);
+        instrumentGenres.append(g);
+    }
+
+    int familiesCount = readInt(s);
+    for (int i = 0; i < familiesCount && s.status() == QDataStream::Ok; ++i) {
+        InstrumentFamily* f = new InstrumentFamily();
+        f->id = readString(s);
+        f->name = readString(s);
+        instrumentFamilies.append(f);
+    }
+
+    int groupsCount = readInt(s);
+    for (int i = 0; i < groupsCount && s.status() == QDataStream::Ok; ++i) {
+        InstrumentGroup* g = new InstrumentGroup();
+        g->id = readString(s);
+        g->name = readString(s);
+        g->extended = readBool(s);
+        instrumentGroups.append(g);
+
+        int templatesCount = readInt(s);
+        for (int j = 0; j < templatesCount && s.status() == QDataStream::Ok; ++j) {
+            g->instrumentTemplates.append(readTemplate(s));
+        }
+    }
+
+    int ordersCount = readInt(s);
+    for (int i = 0; i < ordersCount && s.status() == QDataStream::Ok; ++i) {
+        instrumentOrders.append(readScoreOrder(s));
+    }
+
+    if (s.status() != QDataStream::Ok) {
+        LOGW() << "broken instrument templates cache";
+        clearInstrumentTemplates();
+        return false;
+    }
+
+    return true;
+}
+}
@@ -0,0 +1,44 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MS_INSTRTEMPLATECACHE_H
+#define MS_INSTRTEMPLATECACHE_H
+
+#include <QByteArray>
+
+class QIODevice;
+
+namespace Ms {
+//---------------------------------------------------------
+//   instrument templates cache
+//    binary form of the loaded instrument templates
+//    (groups, templates, genres, families, global articulations and score orders),
+//    it is much faster to read than to parse instruments.xml and orders.xml.
+//    The cache is valid only for the same source hash,
+//    the caller decides what the hash includes (the sources, the language...)
+//---------------------------------------------------------
+
+extern bool writeInstrumentTemplatesCache(QIODevice* device, const QByteArray& sourceHash);
+
+//! NOTE Replaces the loaded templates, if the cache is not valid the templates are cleared and false is returned
+extern bool readInstrumentTemplatesCache(QIODevice* device, const QByteArray& sourceHash);
+}     // namespace Ms
+#endif
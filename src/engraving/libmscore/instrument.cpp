@@ -1779,6 +1779,8 @@ void Instrument::updateInstrumentId()
     QString fallback;
     int bestMatchStrength = 0; // higher when fallback ID provides better match for instrument data
 
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
         for (InstrumentTemplate* it : qAsConst(g->instrumentTemplates)) {
             if (it->musicXMLid != instrumentId()) {
@@ -24,6 +24,7 @@
 #define __LEDGERLINE_H__
 
 #include "engravingitem.h"
+#include "objectpool.h"
 
 namespace Ms {
 class Chord;
@@ -39,6 +40,8 @@ class Chord;
 
 class LedgerLine final : public EngravingItem
 {
+    DECLARE_POOLED_ALLOCATION(LedgerLine)
+
     qreal _width;
     qreal _len;
     LedgerLine* _next;
@@ -125,6 +125,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/instrchange.cpp
     ${CMAKE_CURRENT_LIST_DIR}/instrchange.h
     ${CMAKE_CURRENT_LIST_DIR}/instrtemplate.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/instrtemplatecache.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/instrtemplatecache.h
     ${CMAKE_CURRENT_LIST_DIR}/instrtemplate.h
     ${CMAKE_CURRENT_LIST_DIR}/instrument.cpp
     ${CMAKE_CURRENT_LIST_DIR}/instrument.h
@@ -194,6 +196,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/noteline.cpp
     ${CMAKE_CURRENT_LIST_DIR}/noteline.h
     ${CMAKE_CURRENT_LIST_DIR}/notifier.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/objectpool.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/objectpool.h
     ${CMAKE_CURRENT_LIST_DIR}/ottava.cpp
     ${CMAKE_CURRENT_LIST_DIR}/ottava.h
     ${CMAKE_CURRENT_LIST_DIR}/page.cpp
@@ -290,6 +294,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/sticking.h
     ${CMAKE_CURRENT_LIST_DIR}/stringdata.cpp
     ${CMAKE_CURRENT_LIST_DIR}/stringdata.h
+    ${CMAKE_CURRENT_LIST_DIR}/structuralscorediff.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/structuralscorediff.h
     ${CMAKE_CURRENT_LIST_DIR}/symbol.cpp
     ${CMAKE_CURRENT_LIST_DIR}/symbol.h
     ${CMAKE_CURRENT_LIST_DIR}/synthesizerstate.cpp
@@ -21,6 +21,8 @@
  */
 #include "linkedobjects.h"
 
+#include <atomic>
+
 #include "score.h"
 #include "masterscore.h"
 #include "measure.h"
@@ -43,6 +45,22 @@ LinkedObjects::LinkedObjects(Score* score, int id)
     }
 }
 
+//---------------------------------------------------------
+//   setFrozen
+//---------------------------------------------------------
+
+static std::atomic<bool> s_frozen { false };
+
+void LinkedObjects::setFrozen(bool frozen)
+{
+    s_frozen = frozen;
+}
+
+bool LinkedObjects::frozen()
+{
+    return s_frozen;
+}
+
 //---------------------------------------------------------
 //   setLid
 //---------------------------------------------------------
@@ -39,6 +39,13 @@ public:
     int lid() const { return _lid; }
 
     EngravingObject* mainElement();
+
+    //! NOTE The link lists are shared between the master score and the part scores.
+    //! While the parts are laid out in parallel (see MasterScore::doLayoutPartScores)
+    //! the lists are read from several threads without a lock, so they must not change.
+    //! The changes are checked in the release builds too, they are logged and skipped
+    static void setFrozen(bool frozen);
+    static bool frozen();
 };
 }
 
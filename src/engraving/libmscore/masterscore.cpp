@@ -21,9 +21,13 @@
  */
 #include "masterscore.h"
 
+#include <algorithm>
+
 #include <QDate>
 #include <QBuffer>
 #include <QRegularExpression>
+#include <QThreadPool>
+#include <QtConcurrent>
 
 #include "io/mscreader.h"
 #include "io/mscwriter.h"
@@ -44,6 +48,7 @@
 #include "excerpt.h"
 #include "part.h"
 #include "linkedobjects.h"
+#include "scorefont.h"
 
 #include "log.h"
 
@@ -429,6 +434,64 @@ void MasterScore::removeExcerpt(Excerpt* ex)
     }
 }
 
+//---------------------------------------------------------
+//   doLayoutPartScores
+//    lay out the part scores, in parallel if more than one
+//    thread is configured (see partsLayoutThreadCount())
+//---------------------------------------------------------
+
+void MasterScore::doLayoutPartScores(const QList<Score*>& partScores, const Fraction& stick, const Fraction& etick)
+{
+    TRACEFUNC;
+
+    const int threadCount = std::min(engravingConfiguration() ? engravingConfiguration()->partsLayoutThreadCount() : 1,
+                                     static_cast<int>(partScores.size()));
+
+    if (threadCount <= 1) {
+        for (Score* score : partScores) {
+            score->doLayoutRange(stick, etick);
+        }
+        return;
+    }
+
+    //! NOTE The score fonts are loaded on the first use, so load them before the layout threads start
+    ScoreFont::fallbackFont();
+    for (const Score* score : partScores) {
+        ScoreFont::fontByName(score->style().value(Sid::MusicalSymbolFont).toString());
+    }
+
+    //! NOTE The part scores share the state of the master score. The command state stays locked
+    //! until all parts are laid out, so the layouts don't change the layout range. The update mode,
+    //! the layout flags and the undo stack are changed under their own locks.
+    _cmdState.lock();
+
+    //! NOTE The layout creates the multimeasure rests and links their elements to the underlying ones,
+    //! sets the drumset note heads and removes the disabled dividers of all linked elements.
+    //! The link lists and the linked elements are shared by all scores, so these changes are made here
+    //! one part after another and the parallel layouts only reuse them, the lists stay frozen until
+    //! all parts are laid out. A change of an element of another score is skipped then.
+    for (Score* score : partScores) {
+        score->prepareParallelLayout();
+    }
+
+    LinkedObjects::setFrozen(true);
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount);
+
+    for (Score* score : partScores) {
+        QtConcurrent::run(&threadPool, [score, stick, etick]() {
+            score->doLayoutRange(stick, etick);
+        });
+    }
+
+    threadPool.waitForDone();
+
+    LinkedObjects::setFrozen(false);
+
+    _cmdState.unlock();
+}
+
 //---------------------------------------------------------
 //   clone
 //---------------------------------------------------------
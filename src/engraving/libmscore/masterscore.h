@@ -27,6 +27,9 @@
 #include "score.h"
 #include "instrument.h"
 
+#include "modularity/ioc.h"
+#include "iengravingconfiguration.h"
+
 namespace mu::engraving {
 class EngravingProject;
 class MscReader;
@@ -77,13 +80,15 @@ public:
 class MasterScore : public Score
 {
     Q_OBJECT
+    INJECT_STATIC(engraving, mu::engraving::IEngravingConfiguration, engravingConfiguration)
+
     UndoStack * _undoStack = nullptr;
     TimeSigMap* _sigmap;
     TempoMap* _tempomap;
     RepeatList* _repeatList;
     RepeatList* _repeatList2;
     bool _expandRepeats = MScore::playRepeats;
-    bool _playlistDirty = true;
+    std::atomic<bool> _playlistDirty { true };     // set by the part layouts too, they can run in parallel
     QList<Excerpt*> _excerpts;
     std::vector<PartChannelSettingsLink> _playbackSettingsLinks;
     Score* _playbackScore = nullptr;
@@ -169,7 +174,7 @@ public:
 
     CmdState& cmdState() override { return _cmdState; }
     const CmdState& cmdState() const override { return _cmdState; }
-    void addLayoutFlags(LayoutFlags val) override { _cmdState.layoutFlags |= val; }
+    void addLayoutFlags(LayoutFlags val) override { _cmdState.addLayoutFlags(val); }
     void setInstrumentsChanged(bool val) override { _cmdState._instrumentsChanged = val; }
 
     void setExcerptsChanged(bool val) { _cmdState._excerptsChanged = val; }
@@ -209,8 +214,11 @@ public:
     void deleteExcerpt(Excerpt*);
 
     void initAndAddExcerpt(Excerpt*, bool);
+    void initAndAddExcerpts(const QList<Excerpt*>& excerpts, bool fakeUndo);
     void initEmptyExcerpt(Excerpt*);
 
+    void doLayoutPartScores(const QList<Score*>& partScores, const Fraction& stick, const Fraction& etick);
+
     void setPlaybackScore(Score*);
     Score* playbackScore() { return _playbackScore; }
     const Score* playbackScore() const { return _playbackScore; }
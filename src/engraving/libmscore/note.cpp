@@ -1228,11 +1228,20 @@ bool Note::isNoteName() const
 void Note::draw(mu::draw::Painter* painter) const
 {
     TRACE_OBJ_DRAW;
+    drawWithColor(painter, color());
+}
+
+//---------------------------------------------------------
+//   drawWithColor
+//---------------------------------------------------------
+
+void Note::drawWithColor(mu::draw::Painter* painter, const Color& normalColor) const
+{
     if (_hidden) {
         return;
     }
 
-    Color c(curColor());
+    Color c(curColor(visible(), normalColor));
     painter->setPen(c);
     bool tablature = staff() && staff()->isTabStaff(chord()->tick());
 
@@ -37,6 +37,7 @@
 #include "shape.h"
 #include "key.h"
 #include "iengravingconfiguration.h"
+#include "objectpool.h"
 #include "modularity/ioc.h"
 
 namespace mu::engraving {
@@ -134,6 +135,8 @@ static const int INVALID_LINE = -10000;
 
 class Note final : public EngravingItem
 {
+    DECLARE_POOLED_ALLOCATION(Note)
+
 public:
     enum class SlideType {
         Undefined = 0,
@@ -366,6 +369,8 @@ public:
     void connectTiedNotes();
 
     void draw(mu::draw::Painter*) const override;
+    //! NOTE Draws the note as if its color was normalColor, without changing the note
+    void drawWithColor(mu::draw::Painter* painter, const mu::draw::Color& normalColor) const;
 
     void read(XmlReader&) override;
     bool readProperties(XmlReader&) override;
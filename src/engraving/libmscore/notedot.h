@@ -24,6 +24,7 @@
 #define __NOTEDOT_H__
 
 #include "engravingitem.h"
+#include "objectpool.h"
 
 namespace mu::engraving {
 class Factory;
@@ -39,6 +40,8 @@ class Rest;
 
 class NoteDot final : public EngravingItem
 {
+    DECLARE_POOLED_ALLOCATION(NoteDot)
+
 public:
 
     NoteDot* clone() const override { return new NoteDot(*this); }
@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "objectpool.h"
+
+#include <algorithm>
+#include <new>
+
+using namespace Ms;
+
+static size_t alignedSize(size_t size)
+{
+    constexpr size_t alignment = alignof(std::max_align_t);
+    size = std::max(size, sizeof(void*));
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+ObjectPool::ObjectPool(size_t objectSize)
+    : m_objectSize(alignedSize(objectSize))
+{
+}
+
+void* ObjectPool::allocate()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_free) {
+        addSlab();
+    }
+
+    FreeObject* object = m_free;
+    m_free = object->next;
+    ++m_usedCount;
+
+    object->~FreeObject();
+    return object;
+}
+
+void ObjectPool::deallocate(void* p)
+{
+    if (!p) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_free = new (p) FreeObject { m_free };
+    --m_usedCount;
+}
+
+void ObjectPool::addSlab()
+{
+    const size_t slabSize = m_objectSize * OBJECTS_PER_SLAB;
+    std::unique_ptr<std::max_align_t[]> slab(new std::max_align_t[slabSize / sizeof(std::max_align_t)]);
+
+    //! NOTE Link the objects in the address order, so the consecutive allocations are adjacent
+    char* data = reinterpret_cast<char*>(slab.get());
+    for (size_t i = OBJECTS_PER_SLAB; i > 0; --i) {
+        m_free = new (data + (i - 1) * m_objectSize) FreeObject { m_free };
+    }
+
+    m_slabs.push_back(std::move(slab));
+}
+
+size_t ObjectPool::objectSize() const
+{
+    return m_objectSize;
+}
+
+size_t ObjectPool::usedCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_usedCount;
+}
+
+size_t ObjectPool::slabCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slabs.size();
+}
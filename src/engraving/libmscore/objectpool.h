@@ -0,0 +1,97 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_OBJECTPOOL_H
+#define MU_ENGRAVING_OBJECTPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Ms {
+//! NOTE Slab allocator for the elements created in large numbers (notes, chords, segments...).
+//! The objects are allocated from the slabs of OBJECTS_PER_SLAB objects, freed objects are reused,
+//! so a score allocates a few big blocks instead of many small ones and the objects of the same type
+//! lie close to each other. The slabs are never released, the pool only grows up to the peak usage.
+class ObjectPool
+{
+public:
+    static constexpr size_t OBJECTS_PER_SLAB = 256;
+
+    explicit ObjectPool(size_t objectSize);
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    void* allocate();
+    void deallocate(void* p);
+
+    size_t objectSize() const;
+    size_t usedCount() const;
+    size_t slabCount() const;
+
+private:
+    struct FreeObject {
+        FreeObject* next = nullptr;
+    };
+
+    void addSlab();
+
+    const size_t m_objectSize = 0;
+
+    mutable std::mutex m_mutex;
+    FreeObject* m_free = nullptr;
+    std::vector<std::unique_ptr<std::max_align_t[]> > m_slabs;
+    size_t m_usedCount = 0;
+};
+
+//! NOTE The pool is created on the first use and never deleted,
+//! because elements can be deleted from static destructors
+template<typename T>
+ObjectPool& objectPool()
+{
+    static ObjectPool* pool = new ObjectPool(sizeof(T));
+    return *pool;
+}
+}
+
+//! NOTE Class-level allocation from the pool of the class,
+//! the subclasses (different size) are allocated as usual
+#define DECLARE_POOLED_ALLOCATION(Class) \
+public: \
+    static void* operator new(size_t size) \
+    { \
+        if (size != sizeof(Class)) { \
+            return ::operator new(size); \
+        } \
+        return Ms::objectPool<Class>().allocate(); \
+    } \
+    static void operator delete(void* p, size_t size) \
+    { \
+        if (size != sizeof(Class)) { \
+            ::operator delete(p); \
+            return; \
+        } \
+        Ms::objectPool<Class>().deallocate(p); \
+    } \
+private:
+
+#endif // MU_ENGRAVING_OBJECTPOOL_H
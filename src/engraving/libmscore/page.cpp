@@ -22,6 +22,8 @@
 
 #include "page.h"
 
+#include <atomic>
+
 #include <QDateTime>
 
 #include "style/style.h"
@@ -62,6 +64,18 @@ Page::Page(RootItem* parent)
     : EngravingItem(ElementType::PAGE, parent, ElementFlag::NOT_SELECTABLE), _no(0)
 {
     bspTreeValid = false;
+    setContentChanged();
+}
+
+//---------------------------------------------------------
+//   setContentChanged
+//---------------------------------------------------------
+
+void Page::setContentChanged()
+{
+    //! NOTE The part scores can be laid out in parallel
+    static std::atomic<int> s_lastContentRevision { 0 };
+    _contentRevision = ++s_lastContentRevision;
 }
 
 //---------------------------------------------------------
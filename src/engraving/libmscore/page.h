@@ -54,6 +54,7 @@ class Page final : public EngravingItem
     void doRebuildBspTree();
 #endif
     bool bspTreeValid;
+    int _contentRevision = 0;
 
     friend class mu::engraving::Factory;
     Page(mu::engraving::RootItem* parent);
@@ -94,7 +95,12 @@ public:
 
     QList<EngravingItem*> items(const mu::RectF& r);
     QList<EngravingItem*> items(const mu::PointF& p);
-    void invalidateBspTree() { bspTreeValid = false; }
+    void invalidateBspTree() { bspTreeValid = false; setContentChanged(); }
+
+    //! NOTE Changed when the page is laid out again or needs a repaint. The revisions are unique
+    //! for all pages, so a view can tell which of the pages it has painted before have changed
+    int contentRevision() const { return _contentRevision; }
+    void setContentChanged();
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     QList<EngravingItem*> elements() const;           ///< list of visible elements
     mu::RectF tbbox();                             // tight bounding box, excluding white space
@@ -23,9 +23,11 @@
 #ifndef __REPEATLIST_H__
 #define __REPEATLIST_H__
 
-#include <QList>
+#include <atomic>
 #include <set>
 
+#include <QList>
+
 namespace Ms {
 class Score;
 class Measure;
@@ -76,7 +78,7 @@ class RepeatList : public QList<RepeatSegment*>
     mutable unsigned idx1, idx2;     // cached values
 
     bool _expanded = false;
-    bool _scoreChanged = true;
+    std::atomic<bool> _scoreChanged { true };     // set by the part layouts too, they can run in parallel
 
     std::set<std::pair<Jump const* const, int> > _jumpsTaken;     // take the jumps only once, so track them during unwind
     QList<QList<RepeatListElement*>*> _rlElements;   // all elements of the score that influence the RepeatList
@@ -25,6 +25,7 @@
 
 #include "chordrest.h"
 #include "notedot.h"
+#include "objectpool.h"
 
 namespace Ms {
 class TDuration;
@@ -36,6 +37,8 @@ class TDuration;
 
 class Rest : public ChordRest
 {
+    DECLARE_POOLED_ALLOCATION(Rest)
+
 public:
 
     ~Rest() { qDeleteAll(m_dots); }
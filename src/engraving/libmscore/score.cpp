@@ -1542,14 +1542,14 @@ void Score::addElement(EngravingItem* element)
                 ss->system()->add(ss);
             }
         }
-        cmdState().layoutFlags |= LayoutFlag::FIX_PITCH_VELO;
+        addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
         o->staff()->updateOttava();
         setPlaylistDirty();
     }
     break;
 
     case ElementType::DYNAMIC:
-        cmdState().layoutFlags |= LayoutFlag::FIX_PITCH_VELO;
+        addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
         setPlaylistDirty();
         break;
 
@@ -1692,13 +1692,13 @@ void Score::removeElement(EngravingItem* element)
         o->triggerLayout();
         removeSpanner(o);
         o->staff()->updateOttava();
-        cmdState().layoutFlags |= LayoutFlag::FIX_PITCH_VELO;
+        addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
         setPlaylistDirty();
     }
     break;
 
     case ElementType::DYNAMIC:
-        cmdState().layoutFlags |= LayoutFlag::FIX_PITCH_VELO;
+        addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
         setPlaylistDirty();
         break;
 
@@ -5319,6 +5319,12 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     m_layout.doLayoutRange(m_layoutOptions, st, et);
 }
 
+void Score::prepareParallelLayout()
+{
+    m_layoutOptions.updateFromStyle(style());
+    m_layout.prepareParallelLayout(m_layoutOptions);
+}
+
 UndoStack* Score::undoStack() const { return _masterScore->undoStack(); }
 const RepeatList& Score::repeatList()  const { return _masterScore->repeatList(); }
 const RepeatList& Score::repeatList2()  const { return _masterScore->repeatList2(); }
@@ -28,6 +28,8 @@
  Definition of Score class.
 */
 
+#include <atomic>
+#include <mutex>
 #include <set>
 
 #include <QQueue>
@@ -272,20 +274,24 @@ class CmdState
     bool _oneElement = true;
     bool _oneMeasureBase = true;
 
-    bool _locked = false;
+    //! NOTE Nested, the part scores can be laid out in parallel, each layout locks the state
+    std::atomic<int> _lockCount { 0 };
+    //! NOTE The update mode and the layout flags can be set from the part layouts running in parallel
+    std::mutex _mutex;
 
     void setMeasureBase(const MeasureBase* mb);
 
 public:
     LayoutFlags layoutFlags;
 
-    bool _excerptsChanged     { false };
-    bool _instrumentsChanged  { false };
+    std::atomic<bool> _excerptsChanged     { false };
+    std::atomic<bool> _instrumentsChanged  { false };
 
     void reset();
     UpdateMode updateMode() const { return _updateMode; }
     void setUpdateMode(UpdateMode m);
     void _setUpdateMode(UpdateMode m);
+    void addLayoutFlags(LayoutFlags f);
     bool layoutRange() const { return _updateMode == UpdateMode::Layout; }
     bool updateAll() const { return int(_updateMode) >= int(UpdateMode::UpdateAll); }
     bool updateRange() const { return _updateMode == UpdateMode::Update; }
@@ -299,8 +305,9 @@ public:
     int endStaff() const { return _endStaff; }
     const EngravingItem* element() const;
 
-    void lock() { _locked = true; }
-    void unlock() { _locked = false; }
+    void lock() { ++_lockCount; }
+    void unlock() { --_lockCount; }
+    bool locked() const { return _lockCount > 0; }
 #ifndef NDEBUG
     void dump();
 #endif
@@ -1059,6 +1066,9 @@ public:
 
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
+    //! NOTE Makes the changes of the layout which also change the linked elements of the other scores,
+    //! so the part scores can be laid out in parallel after it, see MasterScore::doLayoutPartScores
+    void prepareParallelLayout();
 
     SynthesizerState& synthesizerState() { return _synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
@@ -21,11 +21,18 @@
  */
 #include "scorefont.h"
 
+#include <cstring>
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
+#include <QFileInfo>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonParseError>
+#include <QSaveFile>
 
 #include "draw/painter.h"
 #include "types/symnames.h"
@@ -222,6 +229,11 @@ const char* ScoreFont::fallbackTextFont()
 
 void ScoreFont::load()
 {
+    TRACEFUNC;
+
+    QElapsedTimer timer;
+    timer.start();
+
     QString facePath = m_fontPath + m_filename;
     if (-1 == fontProvider()->addApplicationFont(m_family, facePath)) {
         LOGE() << "fatal error: cannot load internal font: " << facePath;
@@ -234,6 +246,48 @@ void ScoreFont::load()
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
+    QFile metadataFile(m_fontPath + "metadata.json");
+    if (!metadataFile.open(QIODevice::ReadOnly)) {
+        LOGE() << "Failed to open glyph metadata file: " << metadataFile.fileName();
+        computeAllMetrics();
+        return;
+    }
+
+    QByteArray metadata = metadataFile.readAll();
+
+    QByteArray fontData;
+    QFile fontFile(facePath);
+    if (fontFile.open(QIODevice::ReadOnly)) {
+        fontData = fontFile.readAll();
+    }
+
+    QString cachePath = metricsCachePath();
+    QByteArray hash = metricsHash(fontData, metadata);
+
+    bool isFromCache = !cachePath.isEmpty() && !fontData.isEmpty() && readMetricsCache(cachePath, hash);
+    if (!isFromCache) {
+        computeAllMetrics();
+
+        if (!loadMetadata(metadata)) {
+            return;
+        }
+
+        if (!cachePath.isEmpty() && !fontData.isEmpty()) {
+            writeMetricsCache(cachePath, hash);
+        }
+    }
+
+    m_engravingDefaults.push_back({ Sid::MusicalTextFont, QString("%1 Text").arg(m_family) });
+    m_loaded = true;
+
+    LOGI() << "score font " << m_name << " loaded " << (isFromCache ? "from metrics cache " : "")
+           << "in " << timer.elapsed() << " ms";
+}
+
+void ScoreFont::computeAllMetrics()
+{
+    TRACEFUNC;
+
     for (size_t id = 0; id < s_symIdCodes.size(); ++id) {
         uint code = s_symIdCodes[id];
         if (code == 0) {
@@ -242,19 +296,18 @@ void ScoreFont::load()
         Sym& sym = m_symbols[id];
         computeMetrics(sym, code);
     }
+}
 
-    QFile metadataFile(m_fontPath + "metadata.json");
-    if (!metadataFile.open(QIODevice::ReadOnly)) {
-        LOGE() << "Failed to open glyph metadata file: " << metadataFile.fileName();
-        return;
-    }
+bool ScoreFont::loadMetadata(const QByteArray& metadata)
+{
+    TRACEFUNC;
 
     QJsonParseError error;
-    QJsonObject metadataJson = QJsonDocument::fromJson(metadataFile.readAll(), &error).object();
+    QJsonObject metadataJson = QJsonDocument::fromJson(metadata, &error).object();
     if (error.error != QJsonParseError::NoError) {
-        LOGE() << "Json parse error in " << metadataFile.fileName()
+        LOGE() << "Json parse error in " << m_fontPath << "metadata.json"
                << ", offset " << error.offset << ": " << error.errorString();
-        return;
+        return false;
     }
 
     loadGlyphsWithAnchors(metadataJson.value("glyphsWithAnchors").toObject());
@@ -262,7 +315,7 @@ void ScoreFont::load()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
-    m_loaded = true;
+    return true;
 }
 
 void ScoreFont::loadGlyphsWithAnchors(const QJsonObject& glyphsWithAnchors)
@@ -569,8 +622,6 @@ void ScoreFont::loadEngravingDefaults(const QJsonObject& engravingDefaultsObject
             }
         }
     }
-
-    m_engravingDefaults.push_back({ Sid::MusicalTextFont, QString("%1 Text").arg(m_family) });
 }
 
 void ScoreFont::computeMetrics(ScoreFont::Sym& sym, uint code)
@@ -580,6 +631,257 @@ void ScoreFont::computeMetrics(ScoreFont::Sym& sym, uint code)
     sym.advance = fontProvider()->symAdvance(m_font, code, DPI_F);
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+//! NOTE Binary cache of the loaded metrics of the font (bboxes, advances, anchors, sub symbols and engraving defaults).
+//! It is written on the first load and then mapped into memory on the next loads,
+//! so there is no need to ask FreeType for each glyph and to parse metadata.json again.
+//! The cache is valid while the hash of the font file, the metadata and the glyph codes is the same.
+//! All records have fixed size and are aligned to 8 bytes, so they are read directly from the mapped file.
+
+static constexpr quint32 METRICS_CACHE_MAGIC = 0x4653534D; // "MSSF"
+static constexpr quint32 METRICS_CACHE_VERSION = 1;
+static constexpr int METRICS_CACHE_HASH_SIZE = 20; // SHA-1
+
+struct MetricsCacheHeader {
+    quint32 magic = METRICS_CACHE_MAGIC;
+    quint32 version = METRICS_CACHE_VERSION;
+    char hash[METRICS_CACHE_HASH_SIZE] = { 0 };
+    quint32 symbolsCount = 0;
+    quint32 anchorsCount = 0;
+    quint32 subSymbolsCount = 0;
+    quint32 defaultsCount = 0;
+    quint32 reserved = 0;
+    double textEnclosureThickness = 0.0;
+};
+
+struct MetricsCacheSym {
+    quint32 code = 0;
+    quint32 reserved = 0;
+    double x = 0.0;
+    double y = 0.0;
+    double width = 0.0;
+    double height = 0.0;
+    double advance = 0.0;
+};
+
+struct MetricsCacheAnchor {
+    quint32 symId = 0;
+    quint32 anchorId = 0;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+struct MetricsCacheSubSymbol {
+    quint32 symId = 0;
+    quint32 subSymbolId = 0;
+};
+
+struct MetricsCacheDefault {
+    qint32 styleId = 0;
+    quint32 reserved = 0;
+    double value = 0.0;
+};
+
+static_assert(sizeof(MetricsCacheHeader) == 56);
+static_assert(sizeof(MetricsCacheSym) == 48);
+static_assert(sizeof(MetricsCacheAnchor) == 24);
+static_assert(sizeof(MetricsCacheSubSymbol) == 8);
+static_assert(sizeof(MetricsCacheDefault) == 16);
+
+template<typename T>
+static void writeRecords(QByteArray& data, const std::vector<T>& records)
+{
+    data.append(reinterpret_cast<const char*>(records.data()), static_cast<int>(records.size() * sizeof(T)));
+}
+
+QString ScoreFont::metricsCachePath() const
+{
+    if (!globalConfiguration()) {
+        return QString();
+    }
+
+    return globalConfiguration()->userCachePath().toQString() + "/scorefonts/" + m_name + ".metrics";
+}
+
+QByteArray ScoreFont::metricsHash(const QByteArray& fontData, const QByteArray& metadata) const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(reinterpret_cast<const char*>(&METRICS_CACHE_VERSION), sizeof(METRICS_CACHE_VERSION));
+    hash.addData(reinterpret_cast<const char*>(&DPI_F), sizeof(DPI_F));
+    hash.addData(reinterpret_cast<const char*>(s_symIdCodes.data()), static_cast<int>(s_symIdCodes.size() * sizeof(uint)));
+    hash.addData(fontData);
+    hash.addData(metadata);
+    return hash.result();
+}
+
+bool ScoreFont::readMetricsCache(const QString& path, const QByteArray& hash)
+{
+    TRACEFUNC;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const qint64 size = file.size();
+    if (size < static_cast<qint64>(sizeof(MetricsCacheHeader))) {
+        return false;
+    }
+
+    const uchar* data = file.map(0, size);
+    if (!data) {
+        LOGW() << "failed map score font metrics cache: " << path;
+        return false;
+    }
+
+    auto unmap = [&file, data]() {
+        file.unmap(const_cast<uchar*>(data));
+    };
+
+    const MetricsCacheHeader* header = reinterpret_cast<const MetricsCacheHeader*>(data);
+    if (header->magic != METRICS_CACHE_MAGIC
+        || header->version != METRICS_CACHE_VERSION
+        || header->symbolsCount != m_symbols.size()
+        || hash.size() != METRICS_CACHE_HASH_SIZE
+        || std::memcmp(header->hash, hash.constData(), METRICS_CACHE_HASH_SIZE) != 0) {
+        unmap();
+        return false;
+    }
+
+    const qint64 expectedSize = sizeof(MetricsCacheHeader)
+                                + header->symbolsCount * sizeof(MetricsCacheSym)
+                                + header->anchorsCount * sizeof(MetricsCacheAnchor)
+                                + header->subSymbolsCount * sizeof(MetricsCacheSubSymbol)
+                                + header->defaultsCount * sizeof(MetricsCacheDefault);
+
+    if (size != expectedSize) {
+        LOGW() << "broken score font metrics cache: " << path;
+        unmap();
+        return false;
+    }
+
+    const uchar* ptr = data + sizeof(MetricsCacheHeader);
+
+    const MetricsCacheSym* syms = reinterpret_cast<const MetricsCacheSym*>(ptr);
+    for (quint32 i = 0; i < header->symbolsCount; ++i) {
+        const MetricsCacheSym& r = syms[i];
+        Sym& sym = m_symbols[i];
+        sym.code = r.code;
+        sym.bbox = RectF(r.x, r.y, r.width, r.height);
+        sym.advance = r.advance;
+        sym.smuflAnchors.clear();
+        sym.subSymbolIds.clear();
+    }
+    ptr += header->symbolsCount * sizeof(MetricsCacheSym);
+
+    const MetricsCacheAnchor* anchors = reinterpret_cast<const MetricsCacheAnchor*>(ptr);
+    for (quint32 i = 0; i < header->anchorsCount; ++i) {
+        const MetricsCacheAnchor& r = anchors[i];
+        if (r.symId >= m_symbols.size()) {
+            continue;
+        }
+        m_symbols[r.symId].smuflAnchors[static_cast<SmuflAnchorId>(r.anchorId)] = PointF(r.x, r.y);
+    }
+    ptr += header->anchorsCount * sizeof(MetricsCacheAnchor);
+
+    const MetricsCacheSubSymbol* subSymbols = reinterpret_cast<const MetricsCacheSubSymbol*>(ptr);
+    for (quint32 i = 0; i < header->subSymbolsCount; ++i) {
+        const MetricsCacheSubSymbol& r = subSymbols[i];
+        if (r.symId >= m_symbols.size()) {
+            continue;
+        }
+        m_symbols[r.symId].subSymbolIds.push_back(static_cast<SymId>(r.subSymbolId));
+    }
+    ptr += header->subSymbolsCount * sizeof(MetricsCacheSubSymbol);
+
+    m_engravingDefaults.clear();
+    const MetricsCacheDefault* defaults = reinterpret_cast<const MetricsCacheDefault*>(ptr);
+    for (quint32 i = 0; i < header->defaultsCount; ++i) {
+        m_engravingDefaults.push_back({ static_cast<Sid>(defaults[i].styleId), defaults[i].value });
+    }
+
+    m_textEnclosureThickness = header->textEnclosureThickness;
+
+    unmap();
+
+    return true;
+}
+
+void ScoreFont::writeMetricsCache(const QString& path, const QByteArray& hash) const
+{
+    TRACEFUNC;
+
+    MetricsCacheHeader header;
+    IF_ASSERT_FAILED(hash.size() == METRICS_CACHE_HASH_SIZE) {
+        return;
+    }
+    std::memcpy(header.hash, hash.constData(), METRICS_CACHE_HASH_SIZE);
+
+    std::vector<MetricsCacheSym> syms;
+    std::vector<MetricsCacheAnchor> anchors;
+    std::vector<MetricsCacheSubSymbol> subSymbols;
+    std::vector<MetricsCacheDefault> defaults;
+
+    syms.reserve(m_symbols.size());
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        const Sym& sym = m_symbols[id];
+
+        MetricsCacheSym r;
+        r.code = sym.code;
+        r.x = sym.bbox.x();
+        r.y = sym.bbox.y();
+        r.width = sym.bbox.width();
+        r.height = sym.bbox.height();
+        r.advance = sym.advance;
+        syms.push_back(r);
+
+        for (const auto& anchor : sym.smuflAnchors) {
+            anchors.push_back({ static_cast<quint32>(id), static_cast<quint32>(anchor.first), anchor.second.x(), anchor.second.y() });
+        }
+
+        for (SymId subSymbolId : sym.subSymbolIds) {
+            subSymbols.push_back({ static_cast<quint32>(id), static_cast<quint32>(subSymbolId) });
+        }
+    }
+
+    for (const auto& def : m_engravingDefaults) {
+        MetricsCacheDefault r;
+        r.styleId = static_cast<qint32>(def.first);
+        r.value = def.second.toDouble();
+        defaults.push_back(r);
+    }
+
+    header.symbolsCount = static_cast<quint32>(syms.size());
+    header.anchorsCount = static_cast<quint32>(anchors.size());
+    header.subSymbolsCount = static_cast<quint32>(subSymbols.size());
+    header.defaultsCount = static_cast<quint32>(defaults.size());
+    header.textEnclosureThickness = m_textEnclosureThickness;
+
+    QByteArray data;
+    data.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeRecords(data, syms);
+    writeRecords(data, anchors);
+    writeRecords(data, subSymbols);
+    writeRecords(data, defaults);
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    //! NOTE Several instances (for example, converters) may write the cache at the same time
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGW() << "failed open score font metrics cache for writing: " << path;
+        return;
+    }
+
+    file.write(data);
+    if (!file.commit()) {
+        LOGW() << "failed write score font metrics cache: " << path;
+    }
+}
+
 // =============================================
 // Symbol properties
 // =============================================
@@ -726,11 +1028,14 @@ void ScoreFont::draw(SymId id, Painter* painter, const SizeF& mag, const PointF&
         return;
     }
 
+    //! NOTE Symbols can be drawn from several threads at once (ex. parallel export of pages),
+    //! so the shared font isn't changed here
+    mu::draw::Font font = m_font;
+    font.setPointSizeF(20.0 * MScore::pixelRatio);
+
     painter->save();
-    qreal size = 20.0 * MScore::pixelRatio;
-    m_font.setPointSizeF(size);
     painter->scale(mag.width(), mag.height());
-    painter->setFont(m_font);
+    painter->setFont(font);
     painter->drawSymbol(PointF(pos.x() / mag.width(), pos.y() / mag.height()), symCode(id));
     painter->restore();
 }
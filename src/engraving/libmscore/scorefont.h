@@ -27,6 +27,7 @@
 #include "infrastructure/draw/geometry.h"
 
 #include "modularity/ioc.h"
+#include "iglobalconfiguration.h"
 #include "infrastructure/draw/ifontprovider.h"
 
 namespace mu::draw {
@@ -36,7 +37,8 @@ class Painter;
 namespace Ms {
 class ScoreFont
 {
-    INJECT_STATIC(score, mu::draw::IFontProvider, fontProvider)
+    INJECT_PINNED(score, mu::draw::IFontProvider, fontProvider)
+    INJECT_STATIC(score, mu::framework::IGlobalConfiguration, globalConfiguration)
 
 public:
     ScoreFont(const char* name, const char* family, const char* path, const char* filename);
@@ -103,18 +105,25 @@ private:
     static QJsonObject initGlyphNamesJson();
 
     void load();
+    void computeAllMetrics();
+    bool loadMetadata(const QByteArray& metadata);
     void loadGlyphsWithAnchors(const QJsonObject& glyphsWithAnchors);
     void loadComposedGlyphs();
     void loadStylisticAlternates(const QJsonObject& glyphsWithAlternatesObject);
     void loadEngravingDefaults(const QJsonObject& engravingDefaultsObject);
     void computeMetrics(Sym& sym, uint code);
 
+    QString metricsCachePath() const;
+    QByteArray metricsHash(const QByteArray& fontData, const QByteArray& metadata) const;
+    bool readMetricsCache(const QString& path, const QByteArray& hash);
+    void writeMetricsCache(const QString& path, const QByteArray& hash) const;
+
     Sym& sym(SymId id);
     const Sym& sym(SymId id) const;
 
     bool m_loaded = false;
     std::vector<Sym> m_symbols;
-    mutable mu::draw::Font m_font;
+    mu::draw::Font m_font;
 
     QString m_name;
     QString m_family;
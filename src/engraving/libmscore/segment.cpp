@@ -2236,7 +2236,7 @@ void Segment::createShape(int staffIdx)
         if (effectiveTrack >= strack && effectiveTrack < etrack) {
             setVisible(true);
             if (e->addToSkyline() && !e->isMeasureRepeat()) {
-                s.add(e->shape().translated(e->pos()));
+                s.add(e->shape(), e->pos());
             }
         }
     }
@@ -2273,7 +2273,7 @@ void Segment::createShape(int staffIdx)
                    && !e->isPlayTechAnnotation()) {
             // annotations added here are candidates for collision detection
             // lyrics, ...
-            s.add(e->shape().translated(e->pos()));
+            s.add(e->shape(), e->pos());
         }
     }
 }
@@ -26,6 +26,7 @@
 #include "engravingitem.h"
 #include "shape.h"
 #include "mscore.h"
+#include "objectpool.h"
 
 namespace mu::engraving {
 class Factory;
@@ -62,6 +63,8 @@ class System;
 
 class Segment final : public EngravingItem
 {
+    DECLARE_POOLED_ALLOCATION(Segment)
+
     SegmentType _segmentType { SegmentType::Invalid };
     Fraction _tick;    // { Fraction(0, 1) };
     Fraction _ticks;   // { Fraction(0, 1) };
@@ -242,7 +245,6 @@ public:
     using EngravingItem::prevElement;
     EngravingItem* prevElement(int activeStaff);
 
-    std::vector<Shape> shapes() { return _shapes; }
     const std::vector<Shape>& shapes() const { return _shapes; }
     const Shape& staffShape(int staffIdx) const { return _shapes[staffIdx]; }
     Shape& staffShape(int staffIdx) { return _shapes[staffIdx]; }
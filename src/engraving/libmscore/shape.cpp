@@ -77,19 +77,24 @@ void Shape::translateY(qreal yo)
 Shape Shape::translated(const PointF& pt) const
 {
     Shape s;
-    for (const ShapeElement& r : *this)
-#ifndef NDEBUG
-    {
-        s.add(r.translated(pt), r.text);
-    }
-#else
-    {
-        s.add(r.translated(pt));
-    }
-#endif
+    s.reserve(size());
+    s.add(*this, pt);
     return s;
 }
 
+//---------------------------------------------------------
+//   add
+//    add the shape translated by offset
+//---------------------------------------------------------
+
+void Shape::add(const Shape& s, const PointF& offset)
+{
+    for (const ShapeElement& r : s) {
+        push_back(r);
+        back().translate(offset);
+    }
+}
+
 //-------------------------------------------------------------------
 //   minHorizontalDistance
 //    a is located right of this shape.
@@ -322,7 +327,11 @@ void Shape::dump(const char* p) const
 
 void ShapeElement::dump() const
 {
+#ifdef DEBUG_SHAPES
     qDebug("   %s: %f %f %f %f", text ? text : "", x(), y(), width(), height());
+#else
+    qDebug("   %f %f %f %f", x(), y(), width(), height());
+#endif
 }
 
 //---------------------------------------------------------
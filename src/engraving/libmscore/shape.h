@@ -36,18 +36,29 @@ class Segment;
 //   ShapeElement
 //---------------------------------------------------------
 
+//! NOTE The element name is kept only for the shape debugging,
+//! otherwise a shape element is a plain rect in the debug builds too
 struct ShapeElement : public mu::RectF {
+#ifdef DEBUG_SHAPES
+    const char* text = nullptr;
+#endif
+    ShapeElement(const mu::RectF& f, const char* t = 0)
+        : mu::RectF(f)
+#ifdef DEBUG_SHAPES
+        , text(t)
+#endif
+    {
+        (void)t;
+    }
 #ifndef NDEBUG
-    const char* text;
     void dump() const;
-    ShapeElement(const mu::RectF& f, const char* t = 0)
-        : mu::RectF(f), text(t) {}
-#else
-    ShapeElement(const mu::RectF& f)
-        : mu::RectF(f) {}
 #endif
 };
 
+#ifndef DEBUG_SHAPES
+static_assert(sizeof(ShapeElement) == sizeof(mu::RectF), "ShapeElement must stay a plain rect");
+#endif
+
 //---------------------------------------------------------
 //   Shape
 //---------------------------------------------------------
@@ -69,6 +80,7 @@ public:
     Shape(const mu::RectF& r) { add(r); }
 #endif
     void add(const Shape& s) { insert(end(), s.begin(), s.end()); }
+    void add(const Shape& s, const mu::PointF& offset);     // same as add(s.translated(offset)), without the copy
 #ifndef NDEBUG
     void add(const mu::RectF& r, const char* t = 0);
 #else
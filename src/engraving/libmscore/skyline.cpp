@@ -116,6 +116,13 @@ void Skyline::add(const Shape& s)
     }
 }
 
+void Skyline::add(const Shape& s, const PointF& offset)
+{
+    for (const auto& r : s) {
+        add(r.translated(offset));
+    }
+}
+
 void SkylineLine::add(qreal x, qreal y, qreal w)
 {
 //      Q_ASSERT(w >= 0.0);
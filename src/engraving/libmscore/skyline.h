@@ -99,6 +99,7 @@ public:
 
     void clear();
     void add(const Shape& s);
+    void add(const Shape& s, const mu::PointF& offset);
     void add(const mu::RectF& r);
 
     qreal minDistance(const Skyline&) const;
@@ -190,9 +190,18 @@ void StaffLines::layoutPartialWidth(qreal w, qreal wPartial, bool alignRight)
 void StaffLines::draw(mu::draw::Painter* painter) const
 {
     TRACE_OBJ_DRAW;
+    drawLines(painter, lines);
+}
+
+//---------------------------------------------------------
+//   drawLines
+//---------------------------------------------------------
+
+void StaffLines::drawLines(mu::draw::Painter* painter, const std::vector<mu::LineF>& staffLines) const
+{
     using namespace mu::draw;
     painter->setPen(Pen(curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
-    painter->drawLines(lines);
+    painter->drawLines(staffLines);
 }
 
 //---------------------------------------------------------
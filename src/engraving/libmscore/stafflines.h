@@ -48,12 +48,15 @@ public:
 
     void layout() override;
     void draw(mu::draw::Painter*) const override;
+    //! NOTE Draws other lines with the pen of the staff lines, ex. the lines extended to the whole system
+    void drawLines(mu::draw::Painter* painter, const std::vector<mu::LineF>& staffLines) const;
     mu::PointF pagePos() const override;      ///< position in page coordinates
     mu::PointF canvasPos() const override;    ///< position in page coordinates
 
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
 
     std::vector<mu::LineF>& getLines() { return lines; }
+    const std::vector<mu::LineF>& getLines() const { return lines; }
     Measure* measure() const { return (Measure*)explicitParent(); }
     qreal y1() const;
     void layoutForWidth(qreal width);
@@ -24,12 +24,15 @@
 #define __STEM_H__
 
 #include "engravingitem.h"
+#include "objectpool.h"
 
 namespace Ms {
 class Chord;
 
 class Stem final : public EngravingItem
 {
+    DECLARE_POOLED_ALLOCATION(Stem)
+
 public:
 
     Stem& operator=(const Stem&) = delete;
@@ -0,0 +1,787 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "structuralscorediff.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "measure.h"
+#include "score.h"
+#include "segment.h"
+#include "staff.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+namespace Ms {
+using Hash = uint64_t;
+
+//! NOTE Bigger differences between the measures (or elements) sequences
+//! are not aligned, the remaining items are paired by position
+static constexpr size_t MAX_ALIGNMENT_CELLS = 4 * 1024 * 1024;
+
+//---------------------------------------------------------
+//   hashCombine
+//---------------------------------------------------------
+
+static inline void hashCombine(Hash& h, Hash v)
+{
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+}
+
+static inline void hashReal(Hash& h, qreal v)
+{
+    v += 0.0; // -0.0 == 0.0
+    Hash bits = 0;
+    std::memcpy(&bits, &v, std::min(sizeof(bits), sizeof(v)));
+    hashCombine(h, bits);
+}
+
+//---------------------------------------------------------
+//   hashValue
+//---------------------------------------------------------
+
+static void hashValue(Hash& h, const PropertyValue& v)
+{
+    hashCombine(h, static_cast<Hash>(v.type()));
+
+    switch (v.type()) {
+    case P_TYPE::UNDEFINED:
+        break;
+    case P_TYPE::BOOL:
+        hashCombine(h, v.toBool());
+        break;
+    case P_TYPE::INT:
+        hashCombine(h, static_cast<Hash>(v.toInt()));
+        break;
+    case P_TYPE::INT_LIST:
+        for (int i : v.value<QList<int> >()) {
+            hashCombine(h, static_cast<Hash>(i));
+        }
+        break;
+    case P_TYPE::REAL:
+        hashReal(h, v.toReal());
+        break;
+    case P_TYPE::STRING:
+        hashCombine(h, qHash(v.toString()));
+        break;
+    case P_TYPE::POINT: {
+        const PointF p = v.value<PointF>();
+        hashReal(h, p.x());
+        hashReal(h, p.y());
+    } break;
+    case P_TYPE::SIZE: {
+        const SizeF s = v.value<SizeF>();
+        hashReal(h, s.width());
+        hashReal(h, s.height());
+    } break;
+    case P_TYPE::SCALE: {
+        const ScaleF s = v.value<ScaleF>();
+        hashReal(h, s.width());
+        hashReal(h, s.height());
+    } break;
+    case P_TYPE::SPATIUM:
+        hashReal(h, v.value<Spatium>().val());
+        break;
+    case P_TYPE::MILLIMETRE:
+        hashReal(h, v.value<Millimetre>().val());
+        break;
+    case P_TYPE::PAIR_REAL: {
+        const PairF p = v.value<PairF>();
+        hashReal(h, p.first);
+        hashReal(h, p.second);
+    } break;
+    case P_TYPE::COLOR: {
+        const Color c = v.value<Color>();
+        hashCombine(h, static_cast<Hash>(c.red()));
+        hashCombine(h, static_cast<Hash>(c.green()));
+        hashCombine(h, static_cast<Hash>(c.blue()));
+        hashCombine(h, static_cast<Hash>(c.alpha()));
+    } break;
+    case P_TYPE::ALIGN: {
+        const Align a = v.value<Align>();
+        hashCombine(h, static_cast<Hash>(a.horizontal));
+        hashCombine(h, static_cast<Hash>(a.vertical));
+    } break;
+    case P_TYPE::FRACTION: {
+        const Fraction f = v.value<Fraction>();
+        hashCombine(h, static_cast<Hash>(f.numerator()));
+        hashCombine(h, static_cast<Hash>(f.denominator()));
+    } break;
+    case P_TYPE::DURATION_TYPE_WITH_DOTS: {
+        const DurationTypeWithDots d = v.value<DurationTypeWithDots>();
+        hashCombine(h, static_cast<Hash>(d.type));
+        hashCombine(h, static_cast<Hash>(d.dots));
+    } break;
+    case P_TYPE::PITCH_VALUES:
+        for (const PitchValue& pv : v.value<PitchValues>()) {
+            hashCombine(h, static_cast<Hash>(pv.time));
+            hashCombine(h, static_cast<Hash>(pv.pitch));
+            hashCombine(h, pv.vibrato);
+        }
+        break;
+    case P_TYPE::TEMPO:
+        hashReal(h, v.value<BeatsPerSecond>().val);
+        break;
+    case P_TYPE::GROUPS:
+        for (const GroupNode& n : v.value<GroupNodes>()) {
+            hashCombine(h, static_cast<Hash>(n.pos));
+            hashCombine(h, static_cast<Hash>(n.action));
+        }
+        break;
+    case P_TYPE::DRAW_PATH:
+        //! NOTE The path is changed only together with other properties
+        break;
+    default:
+        // enums
+        hashCombine(h, static_cast<Hash>(v.toQVariant().toInt()));
+        break;
+    }
+}
+
+//---------------------------------------------------------
+//   isComparedProperty
+//    Properties which depend on the position of the element
+//    in the score or on the editing state are not compared,
+//    the position is compared by the tree structure.
+//---------------------------------------------------------
+
+static bool isComparedProperty(Pid pid)
+{
+    switch (pid) {
+    case Pid::SELECTED:
+    case Pid::TICK:
+    case Pid::TRACK:
+    case Pid::SPANNER_TICK:
+    case Pid::SPANNER_TRACK2:
+        return false;
+    default:
+        break;
+    }
+    return true;
+}
+
+//---------------------------------------------------------
+//   isContentElement
+//    Layout elements are not compared
+//---------------------------------------------------------
+
+static bool isContentElement(const EngravingObject* e)
+{
+    if (!e || e->isSpannerSegment() || e->isLedgerLine() || e->isSystem() || e->isPage()) {
+        return false;
+    }
+    if (e->isEngravingItem() && toEngravingItem(e)->generated()) {
+        return false;
+    }
+    return true;
+}
+
+static int staffIndexOf(const EngravingObject* e)
+{
+    if (!e->isEngravingItem()) {
+        return -1;
+    }
+    int track = toEngravingItem(e)->track();
+    return track < 0 ? -1 : track / VOICES;
+}
+
+static std::vector<const EngravingObject*> contentChildren(const EngravingObject* e)
+{
+    std::vector<const EngravingObject*> children;
+    int count = e->scanChildCount();
+    children.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const EngravingObject* child = e->scanChild(i);
+        if (isContentElement(child)) {
+            children.push_back(child);
+        }
+    }
+    return children;
+}
+
+//---------------------------------------------------------
+//   align
+//    Aligns two sequences by their hashes (longest common
+//    subsequence), then pairs the remaining items between
+//    the aligned ones if canPair() allows it.
+//    Returns index pairs, -1 means there is no item in
+//    the corresponding sequence.
+//---------------------------------------------------------
+
+struct Aligned {
+    int first = -1;
+    int second = -1;
+};
+
+template<typename CanPair>
+static std::vector<Aligned> align(const std::vector<Hash>& a, const std::vector<Hash>& b, CanPair canPair)
+{
+    const int n = int(a.size());
+    const int m = int(b.size());
+
+    int prefix = 0;
+    while (prefix < n && prefix < m && a[prefix] == b[prefix]) {
+        ++prefix;
+    }
+    int suffix = 0;
+    while (suffix < n - prefix && suffix < m - prefix && a[n - 1 - suffix] == b[m - 1 - suffix]) {
+        ++suffix;
+    }
+
+    const int midA = n - prefix - suffix;
+    const int midB = m - prefix - suffix;
+
+    // matched pairs of the middle part
+    std::vector<Aligned> matches;
+    if (midA > 0 && midB > 0 && size_t(midA + 1) * size_t(midB + 1) <= MAX_ALIGNMENT_CELLS) {
+        std::vector<int> lcs(size_t(midA + 1) * size_t(midB + 1), 0);
+        auto cell = [&lcs, midB](int i, int j) -> int& { return lcs[size_t(i) * size_t(midB + 1) + size_t(j)]; };
+        for (int i = midA - 1; i >= 0; --i) {
+            for (int j = midB - 1; j >= 0; --j) {
+                if (a[prefix + i] == b[prefix + j]) {
+                    cell(i, j) = cell(i + 1, j + 1) + 1;
+                } else {
+                    cell(i, j) = std::max(cell(i + 1, j), cell(i, j + 1));
+                }
+            }
+        }
+        int i = 0;
+        int j = 0;
+        while (i < midA && j < midB) {
+            if (a[prefix + i] == b[prefix + j]) {
+                matches.push_back({ prefix + i, prefix + j });
+                ++i;
+                ++j;
+            } else if (cell(i + 1, j) >= cell(i, j + 1)) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+    }
+
+    std::vector<Aligned> result;
+    result.reserve(std::max(n, m));
+
+    for (int i = 0; i < prefix; ++i) {
+        result.push_back({ i, i });
+    }
+
+    auto addGap = [&result, &canPair](int beginA, int endA, int beginB, int endB) {
+        int i = beginA;
+        int j = beginB;
+        while (i < endA && j < endB && canPair(i, j)) {
+            result.push_back({ i++, j++ });
+        }
+        while (i < endA) {
+            result.push_back({ i++, -1 });
+        }
+        while (j < endB) {
+            result.push_back({ -1, j++ });
+        }
+    };
+
+    int lastA = prefix;
+    int lastB = prefix;
+    for (const Aligned& match : matches) {
+        addGap(lastA, match.first, lastB, match.second);
+        result.push_back(match);
+        lastA = match.first + 1;
+        lastB = match.second + 1;
+    }
+    addGap(lastA, n - suffix, lastB, m - suffix);
+
+    for (int i = 0; i < suffix; ++i) {
+        result.push_back({ n - suffix + i, m - suffix + i });
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder
+//---------------------------------------------------------
+
+class TreeDiffBuilder
+{
+public:
+    TreeDiffBuilder(const Score* s1, const Score* s2, std::vector<BaseDiff*>& diffs)
+        : m_diffs(diffs)
+    {
+        m_scores[0] = s1;
+        m_scores[1] = s2;
+    }
+
+    void build();
+
+private:
+    //! NOTE An element in a measure, with its segment if it is in a segment
+    struct MeasureItem {
+        const Segment* segment = nullptr;
+        const EngravingObject* element = nullptr;
+        Hash hash = 0;
+    };
+
+    struct MeasureNode {
+        const MeasureBase* measure = nullptr;
+        Hash hash = 0;
+        std::vector<MeasureItem> globalItems;
+        std::vector<std::vector<MeasureItem> > staffItems;
+        std::vector<Hash> staffHashes;
+    };
+
+    Hash elementHash(int score, const EngravingObject* e);
+    Hash propertiesHash(const EngravingObject* e) const;
+    Hash itemsHash(const std::vector<MeasureItem>& items) const;
+    std::vector<MeasureNode> measureNodes(int score);
+
+    void compareMeasures(const MeasureNode& n1, const MeasureNode& n2, const std::vector<Aligned>& staves);
+    void compareItems(const MeasureBase* m1, const MeasureBase* m2, const std::vector<MeasureItem>& items1,
+                      const std::vector<MeasureItem>& items2);
+    void compareElements(const EngravingObject* e1, const EngravingObject* e2);
+    void compareProperties(const EngravingObject* e1, const EngravingObject* e2);
+
+    void addElementDiff(DiffType type, const EngravingObject* ctx1, const EngravingObject* ctx2, const EngravingObject* e1,
+                        const EngravingObject* e2);
+
+    const Score* m_scores[2] = { nullptr, nullptr };
+    std::unordered_map<const EngravingObject*, Hash> m_hashes[2];
+    std::vector<BaseDiff*>& m_diffs;
+};
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::propertiesHash
+//---------------------------------------------------------
+
+Hash TreeDiffBuilder::propertiesHash(const EngravingObject* e) const
+{
+    Hash h = static_cast<Hash>(e->type());
+    for (int i = 0; i < int(Pid::END); ++i) {
+        const Pid pid = static_cast<Pid>(i);
+        if (!isComparedProperty(pid)) {
+            continue;
+        }
+        const PropertyValue v = e->getProperty(pid);
+        if (v.isValid()) {
+            hashCombine(h, static_cast<Hash>(i));
+            hashValue(h, v);
+        }
+    }
+    return h;
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::elementHash
+//    Merkle hash: own properties and hashes of the children
+//---------------------------------------------------------
+
+Hash TreeDiffBuilder::elementHash(int score, const EngravingObject* e)
+{
+    auto it = m_hashes[score].find(e);
+    if (it != m_hashes[score].end()) {
+        return it->second;
+    }
+
+    Hash h = propertiesHash(e);
+    for (const EngravingObject* child : contentChildren(e)) {
+        hashCombine(h, elementHash(score, child));
+    }
+
+    m_hashes[score].emplace(e, h);
+    return h;
+}
+
+Hash TreeDiffBuilder::itemsHash(const std::vector<MeasureItem>& items) const
+{
+    Hash h = items.size();
+    for (const MeasureItem& item : items) {
+        hashCombine(h, item.hash);
+    }
+    return h;
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::measureNodes
+//---------------------------------------------------------
+
+std::vector<TreeDiffBuilder::MeasureNode> TreeDiffBuilder::measureNodes(int score)
+{
+    const Score* s = m_scores[score];
+    const int nstaves = s->nstaves();
+
+    std::vector<MeasureNode> nodes;
+    for (const MeasureBase* mb = s->first(); mb; mb = mb->next()) {
+        MeasureNode node;
+        node.measure = mb;
+
+        if (!mb->isMeasure()) {
+            node.hash = elementHash(score, mb);
+            nodes.push_back(std::move(node));
+            continue;
+        }
+
+        const Measure* m = toMeasure(mb);
+        node.staffItems.resize(nstaves);
+
+        auto addItem = [&node, nstaves](const MeasureItem& item) {
+            int staffIdx = staffIndexOf(item.element);
+            if (staffIdx >= 0 && staffIdx < nstaves) {
+                node.staffItems[staffIdx].push_back(item);
+            } else {
+                node.globalItems.push_back(item);
+            }
+        };
+
+        for (const Segment* seg = m->first(); seg; seg = seg->next()) {
+            Hash segHash = static_cast<Hash>(seg->segmentType());
+            hashCombine(segHash, static_cast<Hash>(seg->rtick().numerator()));
+            hashCombine(segHash, static_cast<Hash>(seg->rtick().denominator()));
+
+            for (const EngravingObject* e : contentChildren(seg)) {
+                Hash h = segHash;
+                hashCombine(h, elementHash(score, e));
+                addItem({ seg, e, h });
+            }
+        }
+
+        for (const EngravingObject* e : contentChildren(m)) {
+            if (e->isSegment()) {
+                continue;
+            }
+            addItem({ nullptr, e, elementHash(score, e) });
+        }
+
+        node.hash = propertiesHash(m);
+        hashCombine(node.hash, itemsHash(node.globalItems));
+        for (const std::vector<MeasureItem>& items : node.staffItems) {
+            Hash h = itemsHash(items);
+            node.staffHashes.push_back(h);
+            hashCombine(node.hash, h);
+        }
+
+        nodes.push_back(std::move(node));
+    }
+
+    return nodes;
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::build
+//---------------------------------------------------------
+
+void TreeDiffBuilder::build()
+{
+    TRACEFUNC;
+
+    // staves
+    std::vector<Hash> staffHashes[2];
+    for (int i = 0; i < 2; ++i) {
+        for (const Staff* staff : m_scores[i]->staves()) {
+            staffHashes[i].push_back(elementHash(i, staff));
+        }
+    }
+
+    const std::vector<Aligned> staves = align(staffHashes[0], staffHashes[1], [](int, int) { return true; });
+    for (const Aligned& a : staves) {
+        const Staff* st1 = a.first >= 0 ? m_scores[0]->staves().at(a.first) : nullptr;
+        const Staff* st2 = a.second >= 0 ? m_scores[1]->staves().at(a.second) : nullptr;
+        if (st1 && st2) {
+            if (staffHashes[0][a.first] != staffHashes[1][a.second]) {
+                compareElements(st1, st2);
+            }
+        } else {
+            addElementDiff(st1 ? DiffType::DELETE : DiffType::INSERT, m_scores[0], m_scores[1], st1, st2);
+        }
+    }
+
+    // measures
+    std::vector<MeasureNode> nodes[2] = { measureNodes(0), measureNodes(1) };
+    std::vector<Hash> measureHashes[2];
+    for (int i = 0; i < 2; ++i) {
+        for (const MeasureNode& node : nodes[i]) {
+            measureHashes[i].push_back(node.hash);
+        }
+    }
+
+    const std::vector<Aligned> measures = align(measureHashes[0], measureHashes[1], [&nodes](int i, int j) {
+        return nodes[0][i].measure->type() == nodes[1][j].measure->type();
+    });
+
+    const MeasureBase* lastMeasure[2] = { nullptr, nullptr };
+    for (const Aligned& a : measures) {
+        const MeasureNode* n1 = a.first >= 0 ? &nodes[0][a.first] : nullptr;
+        const MeasureNode* n2 = a.second >= 0 ? &nodes[1][a.second] : nullptr;
+        if (n1 && n2) {
+            if (n1->hash != n2->hash) {
+                compareMeasures(*n1, *n2, staves);
+            }
+        } else {
+            addElementDiff(n1 ? DiffType::DELETE : DiffType::INSERT, lastMeasure[0], lastMeasure[1],
+                           n1 ? n1->measure : nullptr, n2 ? n2->measure : nullptr);
+        }
+
+        if (n1) {
+            lastMeasure[0] = n1->measure;
+        }
+        if (n2) {
+            lastMeasure[1] = n2->measure;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::compareMeasures
+//---------------------------------------------------------
+
+void TreeDiffBuilder::compareMeasures(const MeasureNode& n1, const MeasureNode& n2, const std::vector<Aligned>& staves)
+{
+    if (!n1.measure->isMeasure()) {
+        compareElements(n1.measure, n2.measure);
+        return;
+    }
+
+    compareProperties(n1.measure, n2.measure);
+
+    if (itemsHash(n1.globalItems) != itemsHash(n2.globalItems)) {
+        compareItems(n1.measure, n2.measure, n1.globalItems, n2.globalItems);
+    }
+
+    //! NOTE The contents of inserted or removed staves are not compared
+    for (const Aligned& a : staves) {
+        if (a.first < 0 || a.second < 0) {
+            continue;
+        }
+        if (n1.staffHashes.at(a.first) != n2.staffHashes.at(a.second)) {
+            compareItems(n1.measure, n2.measure, n1.staffItems.at(a.first), n2.staffItems.at(a.second));
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::compareItems
+//---------------------------------------------------------
+
+void TreeDiffBuilder::compareItems(const MeasureBase* m1, const MeasureBase* m2, const std::vector<MeasureItem>& items1,
+                                   const std::vector<MeasureItem>& items2)
+{
+    std::vector<Hash> hashes1;
+    hashes1.reserve(items1.size());
+    for (const MeasureItem& item : items1) {
+        hashes1.push_back(item.hash);
+    }
+
+    std::vector<Hash> hashes2;
+    hashes2.reserve(items2.size());
+    for (const MeasureItem& item : items2) {
+        hashes2.push_back(item.hash);
+    }
+
+    const std::vector<Aligned> aligned = align(hashes1, hashes2, [&items1, &items2](int i, int j) {
+        const MeasureItem& i1 = items1[i];
+        const MeasureItem& i2 = items2[j];
+        if (i1.element->type() != i2.element->type()) {
+            return false;
+        }
+        if (!i1.segment || !i2.segment) {
+            return i1.segment == i2.segment;
+        }
+        return i1.segment->segmentType() == i2.segment->segmentType() && i1.segment->rtick() == i2.segment->rtick();
+    });
+
+    for (const Aligned& a : aligned) {
+        const MeasureItem* i1 = a.first >= 0 ? &items1[a.first] : nullptr;
+        const MeasureItem* i2 = a.second >= 0 ? &items2[a.second] : nullptr;
+        if (i1 && i2) {
+            if (i1->hash != i2->hash) {
+                compareElements(i1->element, i2->element);
+            }
+        } else {
+            addElementDiff(i1 ? DiffType::DELETE : DiffType::INSERT, m1, m2,
+                           i1 ? i1->element : nullptr, i2 ? i2->element : nullptr);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::compareElements
+//    Compares two elements of the same type, descends only
+//    into the children with different hashes
+//---------------------------------------------------------
+
+void TreeDiffBuilder::compareElements(const EngravingObject* e1, const EngravingObject* e2)
+{
+    compareProperties(e1, e2);
+
+    const std::vector<const EngravingObject*> children1 = contentChildren(e1);
+    const std::vector<const EngravingObject*> children2 = contentChildren(e2);
+
+    std::vector<Hash> hashes1;
+    hashes1.reserve(children1.size());
+    for (const EngravingObject* c : children1) {
+        hashes1.push_back(elementHash(0, c));
+    }
+
+    std::vector<Hash> hashes2;
+    hashes2.reserve(children2.size());
+    for (const EngravingObject* c : children2) {
+        hashes2.push_back(elementHash(1, c));
+    }
+
+    const std::vector<Aligned> aligned = align(hashes1, hashes2, [&children1, &children2](int i, int j) {
+        return children1[i]->type() == children2[j]->type();
+    });
+
+    for (const Aligned& a : aligned) {
+        const EngravingObject* c1 = a.first >= 0 ? children1[a.first] : nullptr;
+        const EngravingObject* c2 = a.second >= 0 ? children2[a.second] : nullptr;
+        if (c1 && c2) {
+            if (hashes1[a.first] != hashes2[a.second]) {
+                compareElements(c1, c2);
+            }
+        } else {
+            addElementDiff(c1 ? DiffType::DELETE : DiffType::INSERT, e1, e2, c1, c2);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::compareProperties
+//---------------------------------------------------------
+
+void TreeDiffBuilder::compareProperties(const EngravingObject* e1, const EngravingObject* e2)
+{
+    const EngravingObject* p1 = e1->explicitParent();
+    const EngravingObject* p2 = e2->explicitParent();
+
+    for (int i = 0; i < int(Pid::END); ++i) {
+        const Pid pid = static_cast<Pid>(i);
+        if (!isComparedProperty(pid)) {
+            continue;
+        }
+
+        const PropertyValue v1 = e1->getProperty(pid);
+        const PropertyValue v2 = e2->getProperty(pid);
+        if (v1 == v2) {
+            continue;
+        }
+
+        //! NOTE Unknown properties are taken from the parent, the parent reports them itself
+        if (p1 && p2 && p1->getProperty(pid) == v1 && p2->getProperty(pid) == v2) {
+            continue;
+        }
+
+        PropertyDiff* diff = new PropertyDiff();
+        diff->type = DiffType::REPLACE;
+        diff->textDiff = nullptr;
+        diff->ctx[0] = e1;
+        diff->ctx[1] = e2;
+        diff->before[0] = nullptr;
+        diff->before[1] = nullptr;
+        diff->pid = pid;
+        m_diffs.push_back(diff);
+    }
+}
+
+//---------------------------------------------------------
+//   TreeDiffBuilder::addElementDiff
+//---------------------------------------------------------
+
+void TreeDiffBuilder::addElementDiff(DiffType type, const EngravingObject* ctx1, const EngravingObject* ctx2,
+                                     const EngravingObject* e1, const EngravingObject* e2)
+{
+    ElementDiff* diff = new ElementDiff();
+    diff->type = type;
+    diff->textDiff = nullptr;
+    diff->ctx[0] = ctx1;
+    diff->ctx[1] = ctx2;
+    diff->before[0] = nullptr;
+    diff->before[1] = nullptr;
+    diff->el[0] = e1;
+    diff->el[1] = e2;
+    m_diffs.push_back(diff);
+}
+
+//---------------------------------------------------------
+//   positionSort
+//---------------------------------------------------------
+
+static bool positionSort(BaseDiff* d1, BaseDiff* d2)
+{
+    return d1->afrac(0) < d2->afrac(0) || d1->afrac(1) < d2->afrac(1);
+}
+
+//---------------------------------------------------------
+//   StructuralScoreDiff
+//---------------------------------------------------------
+
+StructuralScoreDiff::StructuralScoreDiff(Score* s1, Score* s2)
+    : _s1(s1), _s2(s2)
+{
+    update();
+}
+
+StructuralScoreDiff::~StructuralScoreDiff()
+{
+    qDeleteAll(_diffs);
+}
+
+//---------------------------------------------------------
+//   StructuralScoreDiff::update
+//    Updates the diff according to the current state of
+//    the compared scores.
+//---------------------------------------------------------
+
+void StructuralScoreDiff::update()
+{
+    if (updated()) {
+        return;
+    }
+
+    qDeleteAll(_diffs);
+    _diffs.clear();
+
+    TreeDiffBuilder(_s1, _s2, _diffs).build();
+
+    std::stable_sort(_diffs.begin(), _diffs.end(), positionSort);
+
+    _scoreState1 = _s1->state();
+    _scoreState2 = _s2->state();
+}
+
+//---------------------------------------------------------
+//   StructuralScoreDiff::userDiff
+//---------------------------------------------------------
+
+QString StructuralScoreDiff::userDiff() const
+{
+    QStringList list;
+    for (const BaseDiff* d : _diffs) {
+        list.push_back(d->toString());
+    }
+    return list.join('\n');
+}
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __STRUCTURALSCOREDIFF_H__
+#define __STRUCTURALSCOREDIFF_H__
+
+#include <vector>
+
+#include "scorediff.h"
+
+namespace Ms {
+class Score;
+
+//---------------------------------------------------------
+//   StructuralScoreDiff
+//    Compares scores by their element trees instead of
+//    their MSCX text. Every element gets a content hash
+//    which includes the hashes of its children, every
+//    measure gets a hash per staff. Only the measures,
+//    staves and elements whose hashes differ are compared
+//    property by property.
+//    The diff items are the same as for ScoreDiff but have
+//    no textDiff.
+//    s1, s2 are scores to compare.
+//    StructuralScoreDiff does NOT take ownership of the scores.
+//---------------------------------------------------------
+
+class StructuralScoreDiff
+{
+public:
+    StructuralScoreDiff(Score* s1, Score* s2);
+    StructuralScoreDiff(const StructuralScoreDiff&) = delete;
+    ~StructuralScoreDiff();
+
+    void update();
+    bool updated() const { return _scoreState1 == _s1->state() && _scoreState2 == _s2->state(); }
+
+    std::vector<BaseDiff*>& diffs() { return _diffs; }
+
+    const Score* score1() const { return _s1; }
+    const Score* score2() const { return _s2; }
+
+    bool equal() const { return _diffs.empty(); }
+
+    QString userDiff() const;
+
+private:
+    std::vector<BaseDiff*> _diffs;
+    Score* _s1 = nullptr;
+    Score* _s2 = nullptr;
+    ScoreContentState _scoreState1;
+    ScoreContentState _scoreState2;
+};
+}     // namespace Ms
+#endif
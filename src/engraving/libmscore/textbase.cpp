@@ -2566,6 +2566,23 @@ QString TextBase::xmlText() const
     return text->_text;
 }
 
+//---------------------------------------------------------
+//   updateInvalidText
+//    generate the invalid text or layout in place,
+//    then xmlText() and plainText() don't need a
+//    temporary clone of this text
+//---------------------------------------------------------
+
+void TextBase::updateInvalidText()
+{
+    if (textInvalid) {
+        genText();
+    }
+    if (layoutInvalid) {
+        createLayout();
+    }
+}
+
 //---------------------------------------------------------
 //   unEscape
 //---------------------------------------------------------
@@ -3066,21 +3083,36 @@ AccessibleItem* TextBase::createAccessible()
 
 void TextBase::notifyAboutTextCursorChanged()
 {
-    accessible()->accessiblePropertyChanged().send(accessibility::IAccessible::Property::TextCursor, Val());
+    AccessibleItem* accessibleItem = accessibleIfCreated();
+    if (!accessibleItem) {
+        return;
+    }
+
+    accessibleItem->accessiblePropertyChanged().send(accessibility::IAccessible::Property::TextCursor, Val());
 }
 
 void TextBase::notifyAboutTextInserted(int startPosition, int endPosition, const QString& text)
 {
+    AccessibleItem* accessibleItem = accessibleIfCreated();
+    if (!accessibleItem) {
+        return;
+    }
+
     auto range = accessibility::IAccessible::TextRange(startPosition, endPosition, text);
-    accessible()->accessiblePropertyChanged().send(accessibility::IAccessible::Property::TextInsert,
-                                                   Val(range.toMap()));
+    accessibleItem->accessiblePropertyChanged().send(accessibility::IAccessible::Property::TextInsert,
+                                                     Val(range.toMap()));
 }
 
 void TextBase::notifyAboutTextRemoved(int startPosition, int endPosition, const QString& text)
 {
+    AccessibleItem* accessibleItem = accessibleIfCreated();
+    if (!accessibleItem) {
+        return;
+    }
+
     auto range = accessibility::IAccessible::TextRange(startPosition, endPosition, text);
-    accessible()->accessiblePropertyChanged().send(accessibility::IAccessible::Property::TextRemove,
-                                                   Val(range.toMap()));
+    accessibleItem->accessiblePropertyChanged().send(accessibility::IAccessible::Property::TextRemove,
+                                                     Val(range.toMap()));
 }
 
 //---------------------------------------------------------
@@ -352,6 +352,7 @@ public:
     virtual void setXmlText(const QString&);
     QString xmlText() const;
     QString plainText() const;
+    void updateInvalidText();
     void resetFormatting();
 
     void insertText(EditData&, const QString&);
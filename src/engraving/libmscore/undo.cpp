@@ -32,6 +32,8 @@
  between startUndo() and endUndo().
 */
 
+#include <set>
+
 #include "undo.h"
 #include "engravingitem.h"
 #include "note.h"
@@ -313,6 +315,8 @@ void UndoStack::beginMacro(Score* score)
 
 void UndoStack::push(UndoCommand* cmd, EditData* ed)
 {
+    std::lock_guard<std::recursive_mutex> lock(pushMutex);
+
     if (!curCmd) {
         // this can happen for layout() outside of a command (load)
         if (!ScoreLoad::loading()) {
@@ -341,6 +345,8 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
 
 void UndoStack::push1(UndoCommand* cmd)
 {
+    std::lock_guard<std::recursive_mutex> lock(pushMutex);
+
     if (!curCmd) {
         if (!ScoreLoad::loading()) {
             qWarning("no active command, UndoStack %p", this);
@@ -2414,6 +2420,90 @@ void ChangeBracketProperty::flip(EditData* ed)
     level = toBracketItem(element)->column();
 }
 
+//---------------------------------------------------------
+//   ChangeLinkedProperty
+//---------------------------------------------------------
+
+std::atomic<uint64_t> ChangeLinkedProperty::s_commands { 0 };
+std::atomic<uint64_t> ChangeLinkedProperty::s_members { 0 };
+std::atomic<uint64_t> ChangeLinkedProperty::s_scores { 0 };
+std::atomic<uint64_t> ChangeLinkedProperty::s_maxMembers { 0 };
+
+ChangeLinkedProperty::ChangeLinkedProperty(Pid i, std::vector<Member>&& members)
+    : id(i), m_members(std::move(members))
+{
+    std::set<const Score*> scores;
+    for (const Member& m : m_members) {
+        scores.insert(m.element->score());
+    }
+
+    const uint64_t count = m_members.size();
+    ++s_commands;
+    s_members += count;
+    s_scores += scores.size();
+
+    uint64_t maxMembers = s_maxMembers.load();
+    while (count > maxMembers && !s_maxMembers.compare_exchange_weak(maxMembers, count)) {
+    }
+}
+
+bool ChangeLinkedProperty::isFiltered(UndoCommand::Filter f, const EngravingItem* target) const
+{
+    if (f != UndoCommand::Filter::ChangePropertyLinked) {
+        return false;
+    }
+
+    const QList<EngravingObject*> links = target->linkList();
+    for (const Member& m : m_members) {
+        if (links.contains(m.element)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//   ChangeLinkedProperty::flip
+//---------------------------------------------------------
+
+void ChangeLinkedProperty::flip(EditData*)
+{
+    LOG_UNDO() << int(id) << "(" << propertyName(id) << ")" << "members:" << m_members.size();
+
+    for (Member& m : m_members) {
+        PropertyValue v = m.element->getProperty(id);
+        PropertyFlags ps = m.element->propertyFlags(id);
+
+        m.element->setProperty(id, m.property);
+        m.element->setPropertyFlags(id, m.flags);
+        m.property = v;
+        m.flags = ps;
+    }
+}
+
+ChangeLinkedProperty::Stats ChangeLinkedProperty::stats()
+{
+    Stats stats;
+    stats.commands = s_commands.load();
+    stats.members = s_members.load();
+    stats.scores = s_scores.load();
+    stats.maxMembers = s_maxMembers.load();
+    return stats;
+}
+
+void ChangeLinkedProperty::resetStats()
+{
+    s_commands = 0;
+    s_members = 0;
+    s_scores = 0;
+    s_maxMembers = 0;
+}
+
+double ChangeLinkedProperty::Stats::membersPerCommand() const
+{
+    return commands > 0 ? static_cast<double>(members) / static_cast<double>(commands) : 0.0;
+}
+
 //---------------------------------------------------------
 //   ChangeTextLineProperty::flip
 //---------------------------------------------------------
@@ -2616,6 +2706,10 @@ LinkUnlink::~LinkUnlink()
 
 void LinkUnlink::link()
 {
+    IF_ASSERT_FAILED(!LinkedObjects::frozen()) {
+        return;
+    }
+
     if (le->size() == 1) {
         le->front()->setLinks(le);
     }
@@ -2626,6 +2720,10 @@ void LinkUnlink::link()
 
 void LinkUnlink::unlink()
 {
+    IF_ASSERT_FAILED(!LinkedObjects::frozen()) {
+        return;
+    }
+
     Q_ASSERT(le->contains(e));
     le->removeOne(e);
     if (le->size() == 1) {
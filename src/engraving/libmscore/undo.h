@@ -28,6 +28,10 @@
  Definition of undo-releated classes and structs.
 */
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 #include "style/style.h"
 #include "compat/midi/midipatch.h"
 
@@ -194,6 +198,10 @@ class UndoStack
     int cleanState;
     int curIdx;
 
+    //! NOTE The part scores push the commands to the stack of the master score,
+    //! they can do it from several threads when the parts are laid out in parallel
+    std::recursive_mutex pushMutex;
+
     void remove(int idx);
 
 public:
@@ -1153,6 +1161,56 @@ public:
     UNDO_NAME("ChangeBracketProperty")
 };
 
+//---------------------------------------------------------
+//   ChangeLinkedProperty
+//    changes a property of all elements of a link group
+//    with one command, instead of a ChangeProperty for
+//    every linked element
+//---------------------------------------------------------
+
+class ChangeLinkedProperty : public UndoCommand
+{
+public:
+    struct Member {
+        EngravingObject* element = nullptr;
+        mu::engraving::PropertyValue property;
+        PropertyFlags flags = PropertyFlags::NOSTYLE;
+    };
+
+    //! NOTE Fan-out of the linked property changes, to see how many elements a change touches
+    struct Stats {
+        uint64_t commands = 0;
+        uint64_t members = 0;
+        uint64_t scores = 0;
+        uint64_t maxMembers = 0;
+
+        double membersPerCommand() const;
+    };
+
+    ChangeLinkedProperty(Pid i, std::vector<Member>&& members);
+
+    Pid getId() const { return id; }
+    const std::vector<Member>& members() const { return m_members; }
+    UNDO_NAME("ChangeLinkedProperty")
+
+    bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
+
+    static Stats stats();
+    static void resetStats();
+
+protected:
+    void flip(EditData*) override;
+
+private:
+    Pid id;
+    std::vector<Member> m_members;
+
+    static std::atomic<uint64_t> s_commands;
+    static std::atomic<uint64_t> s_members;
+    static std::atomic<uint64_t> s_scores;
+    static std::atomic<uint64_t> s_maxMembers;
+};
+
 //---------------------------------------------------------
 //   ChangeTextLineProperty
 //---------------------------------------------------------
@@ -36,7 +36,7 @@ namespace mu::engraving {
 class PaintDebugger;
 class DebugPaint
 {
-    INJECT_STATIC(engraving, diagnostics::IEngravingElementsProvider, elementsProvider)
+    INJECT_PINNED(engraving, diagnostics::IEngravingElementsProvider, elementsProvider)
 public:
 
     static void paintElementDebug(mu::draw::Painter& painter, const Ms::EngravingItem* element, std::shared_ptr<PaintDebugger>& debugger);
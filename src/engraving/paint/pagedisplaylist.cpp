@@ -0,0 +1,227 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pagedisplaylist.h"
+
+#include "infrastructure/draw/bufferedpaintprovider.h"
+#include "libmscore/engravingitem.h"
+#include "libmscore/page.h"
+#include "libmscore/textbase.h"
+
+#include "paint.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::draw;
+using namespace mu::engraving;
+using namespace Ms;
+
+bool PageDisplayList::isValid() const
+{
+    return m_isValid;
+}
+
+void PageDisplayList::invalidate()
+{
+    m_isValid = false;
+    m_hasLiveElements = false;
+    m_pageRevision = 0;
+    m_items = nullptr;
+}
+
+int PageDisplayList::pageRevision() const
+{
+    return m_pageRevision;
+}
+
+size_t PageDisplayList::itemCount() const
+{
+    return m_items ? m_items->size() : 0;
+}
+
+bool PageDisplayList::hasLiveElements() const
+{
+    return m_hasLiveElements;
+}
+
+bool PageDisplayList::isLiveElement(const EngravingItem* element)
+{
+    //! NOTE Images are scaled depending on the painter transform
+    if (element->isImage()) {
+        return true;
+    }
+
+    //! NOTE The text being edited draws a cursor and a frame depending on the painter transform
+    if (element->isTextBase() && toTextBase(element)->cursor()->editing()) {
+        return true;
+    }
+
+    return false;
+}
+
+void PageDisplayList::record(Page* page)
+{
+    TRACEFUNC;
+
+    m_items = nullptr;
+    m_hasLiveElements = false;
+    m_pageRevision = 0;
+    m_isValid = true;
+
+    IF_ASSERT_FAILED(page) {
+        return;
+    }
+
+    m_pageRevision = page->contentRevision();
+
+    std::shared_ptr<Items> items = std::make_shared<Items>();
+
+    QList<EngravingItem*> elements = page->elements();
+    Paint::sortElements(elements);
+
+    std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+    Painter painter(provider, "pagedisplaylist");
+    painter.setAntialiasing(true);
+
+    items->reserve(elements.size());
+
+    for (const EngravingItem* element : elements) {
+        if (!element->isInteractionAvailable()) {
+            continue;
+        }
+
+        Item item;
+        item.bbox = element->pageBoundingRect();
+
+        if (isLiveElement(element)) {
+            item.liveElement = element;
+            items->push_back(std::move(item));
+            m_hasLiveElements = true;
+            continue;
+        }
+
+        //! NOTE Nested objects (see TRACE_OBJ_DRAW) are written to the buffer before the element object,
+        //! so all objects since the begin belong to this element
+        size_t objectsBegin = provider->drawData().objects.size();
+
+        painter.beginObject(element->typeName(), element->pagePos());
+        Paint::paintElement(painter, element);
+        painter.endObject();
+
+        const std::vector<DrawData::Object>& objects = provider->drawData().objects;
+        for (size_t i = objectsBegin; i < objects.size(); ++i) {
+            for (const DrawData::Data& data : objects.at(i).datas) {
+                if (!data.empty()) {
+                    item.datas.push_back(data);
+                }
+            }
+        }
+
+        if (!item.datas.empty()) {
+            items->push_back(std::move(item));
+        }
+    }
+
+    painter.endDraw();
+
+    m_items = items;
+}
+
+void PageDisplayList::replayData(IPaintProviderPtr provider, const DrawData::Data& data, const Transform& baseTransform)
+{
+    const DrawData::State& st = data.state;
+    provider->setPen(st.pen);
+    provider->setBrush(st.brush);
+    provider->setFont(st.font);
+    provider->setTransform(st.transform * baseTransform);
+    provider->setAntialiasing(st.isAntialiasing);
+    provider->setCompositionMode(st.compositionMode);
+
+    for (const DrawPath& path : data.paths) {
+        provider->setPen(path.pen);
+        provider->setBrush(path.brush);
+        provider->drawPath(path.path);
+    }
+
+    provider->setPen(st.pen);
+    provider->setBrush(st.brush);
+
+    for (const DrawPolygon& pl : data.polygons) {
+        if (pl.polygon.empty()) {
+            continue;
+        }
+        provider->drawPolygon(&pl.polygon[0], pl.polygon.size(), pl.mode);
+    }
+
+    for (const DrawText& t : data.texts) {
+        provider->drawText(t.pos, t.text);
+    }
+
+    for (const DrawRectText& t : data.rectTexts) {
+        provider->drawText(t.rect, t.flags, t.text);
+    }
+
+    for (const DrawPixmap& px : data.pixmaps) {
+        provider->drawPixmap(px.pos, px.pm);
+    }
+
+    for (const DrawTiledPixmap& px : data.tiledPixmap) {
+        provider->drawTiledPixmap(px.rect, px.pm, px.offset);
+    }
+}
+
+void PageDisplayList::paint(Painter& painter, const RectF& rect) const
+{
+    if (!m_items) {
+        return;
+    }
+
+    IPaintProviderPtr provider = painter.provider();
+
+    //! NOTE Remember the painter state, the replay changes it directly through the provider
+    const Transform baseTransform = provider->transform();
+    const Pen pen = provider->pen();
+    const Brush brush = provider->brush();
+    const Font font = provider->font();
+
+    for (const Item& item : *m_items) {
+        if (!item.bbox.intersects(rect)) {
+            continue;
+        }
+
+        if (item.liveElement) {
+            provider->setTransform(baseTransform);
+            Paint::paintElement(painter, item.liveElement);
+            continue;
+        }
+
+        for (const DrawData::Data& data : item.datas) {
+            replayData(provider, data, baseTransform);
+        }
+    }
+
+    provider->setTransform(baseTransform);
+    provider->setPen(pen);
+    provider->setBrush(brush);
+    provider->setFont(font);
+    provider->setCompositionMode(CompositionMode::SourceOver);
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_PAGEDISPLAYLIST_H
+#define MU_ENGRAVING_PAGEDISPLAYLIST_H
+
+#include <memory>
+#include <vector>
+
+#include "infrastructure/draw/painter.h"
+#include "infrastructure/draw/buffereddrawtypes.h"
+
+namespace Ms {
+class EngravingItem;
+class Page;
+}
+
+namespace mu::engraving {
+//! NOTE Retained list of the draw calls of all page elements.
+//! It is recorded once (after layout) in page coordinates
+//! and then replayed on every repaint, only the elements
+//! which intersect the visible rect are replayed.
+//! The recorded data is shared between copies and never changed after recording,
+//! so a copy without live elements can be replayed from another thread.
+class PageDisplayList
+{
+public:
+    PageDisplayList() = default;
+
+    bool isValid() const;
+    void invalidate();
+
+    void record(Ms::Page* page);
+
+    //! NOTE The content revision of the page at the time of recording,
+    //! the list is outdated if the page revision has changed since
+    int pageRevision() const;
+
+    //! NOTE The painter must be translated to the page position,
+    //! the rect is in page coordinates
+    void paint(draw::Painter& painter, const RectF& rect) const;
+
+    size_t itemCount() const;
+    bool hasLiveElements() const;
+
+private:
+    struct Item {
+        RectF bbox;
+        //! NOTE Elements whose drawing depends on the current painter transform
+        //! are not recorded, they are painted directly
+        const Ms::EngravingItem* liveElement = nullptr;
+        std::vector<draw::DrawData::Data> datas;
+    };
+
+    static bool isLiveElement(const Ms::EngravingItem* element);
+    static void replayData(draw::IPaintProviderPtr provider, const draw::DrawData::Data& data, const Transform& baseTransform);
+
+    using Items = std::vector<Item>;
+
+    std::shared_ptr<const Items> m_items;
+    int m_pageRevision = 0;
+    bool m_hasLiveElements = false;
+    bool m_isValid = false;
+};
+}
+
+#endif // MU_ENGRAVING_PAGEDISPLAYLIST_H
@@ -47,11 +47,9 @@ void Paint::paintElement(mu::draw::Painter& painter, const Ms::EngravingItem* el
     painter.translate(-elementPosition);
 }
 
-void Paint::paintElements(mu::draw::Painter& painter, const QList<EngravingItem*>& elements)
+void Paint::sortElements(QList<Ms::EngravingItem*>& elements)
 {
-    QList<Ms::EngravingItem*> sortedElements = elements;
-
-    std::sort(sortedElements.begin(), sortedElements.end(), [](Ms::EngravingItem* e1, Ms::EngravingItem* e2) {
+    std::sort(elements.begin(), elements.end(), [](Ms::EngravingItem* e1, Ms::EngravingItem* e2) {
         if (e1->z() == e2->z()) {
             if (e1->selected()) {
                 return false;
@@ -68,6 +66,12 @@ void Paint::paintElements(mu::draw::Painter& painter, const QList<EngravingItem*
 
         return e1->z() < e2->z();
     });
+}
+
+void Paint::paintElements(mu::draw::Painter& painter, const QList<EngravingItem*>& elements)
+{
+    QList<Ms::EngravingItem*> sortedElements = elements;
+    sortElements(sortedElements);
 
     for (const EngravingItem* element : sortedElements) {
         if (!element->isInteractionAvailable()) {
@@ -37,6 +37,8 @@ public:
 
     static void paintElement(mu::draw::Painter& painter, const Ms::EngravingItem* element);
     static void paintElements(mu::draw::Painter& painter, const QList<Ms::EngravingItem*>& elements);
+
+    static void sortElements(QList<Ms::EngravingItem*>& elements);
 };
 }
 
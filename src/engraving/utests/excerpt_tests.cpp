@@ -0,0 +1,138 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "modularity/ioc.h"
+#include "iengravingconfiguration.h"
+
+#include "libmscore/excerpt.h"
+#include "libmscore/linkedobjects.h"
+#include "libmscore/measure.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/structuralscorediff.h"
+
+#include "utils/scoregenerator.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace Ms;
+
+class ExcerptTests : public ::testing::Test
+{
+};
+
+static ScoreGenerator::Params scoreParams()
+{
+    ScoreGenerator::Params params;
+    params.staves = 6;
+    params.measures = 24;
+    params.tupletsEvery = 3;
+    params.lyrics = true;
+    params.chordSymbols = true;
+    params.spannersEvery = 4;
+
+    return params;
+}
+
+static MasterScore* createScoreWithParts(const ScoreGenerator::Params& params, int partsLayoutThreadCount)
+{
+    auto configuration = modularity::ioc()->resolve<IEngravingConfiguration>("utests");
+    configuration->setPartsLayoutThreadCount(partsLayoutThreadCount);
+
+    MasterScore* score = ScoreGenerator::generate(params);
+    score->initAndAddExcerpts(Excerpt::createExcerptsFromParts(score->parts()), false);
+
+    configuration->setPartsLayoutThreadCount(std::nullopt);
+
+    return score;
+}
+
+static int mmRestCount(const Score* score)
+{
+    int count = 0;
+    for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (m->mmRest()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+static void checkPartsEqual(MasterScore* serialScore, MasterScore* parallelScore)
+{
+    ASSERT_EQ(parallelScore->excerpts().size(), serialScore->excerpts().size());
+
+    for (int i = 0; i < serialScore->excerpts().size(); ++i) {
+        Score* serialPart = serialScore->excerpts().at(i)->partScore();
+        Score* parallelPart = parallelScore->excerpts().at(i)->partScore();
+        ASSERT_TRUE(serialPart && parallelPart);
+
+        StructuralScoreDiff diff(serialPart, parallelPart);
+        EXPECT_TRUE(diff.equal()) << diff.userDiff().toStdString();
+
+        EXPECT_EQ(parallelPart->npages(), serialPart->npages());
+        EXPECT_EQ(parallelPart->systems().size(), serialPart->systems().size());
+        EXPECT_EQ(mmRestCount(parallelPart), mmRestCount(serialPart));
+    }
+}
+
+TEST_F(ExcerptTests, ParallelPartsLayout)
+{
+    //! GIVEN The same generated score twice
+    //! DO Create the parts of the first one laid out one by one, of the second one in parallel
+    MasterScore* serialScore = createScoreWithParts(scoreParams(), 1);
+    MasterScore* parallelScore = createScoreWithParts(scoreParams(), 4);
+
+    //! CHECK The part scores are the same and laid out the same
+    ASSERT_EQ(serialScore->excerpts().size(), 6);
+    checkPartsEqual(serialScore, parallelScore);
+
+    delete parallelScore;
+    delete serialScore;
+}
+
+TEST_F(ExcerptTests, ParallelPartsLayoutMMRests)
+{
+    //! GIVEN The same generated score twice, each staff rests for several measures
+    //! (without the chord symbols, they break the multimeasure rests)
+    ScoreGenerator::Params params = scoreParams();
+    params.restsEvery = 4;
+    params.chordSymbols = false;
+
+    //! DO Create the parts of the first one laid out one by one, of the second one in parallel
+    MasterScore* serialScore = createScoreWithParts(params, 1);
+    MasterScore* parallelScore = createScoreWithParts(params, 4);
+
+    //! CHECK The parts got the multimeasure rests, the same as laid out one by one
+    ASSERT_EQ(serialScore->excerpts().size(), 6);
+    for (const Excerpt* excerpt : serialScore->excerpts()) {
+        EXPECT_GT(mmRestCount(excerpt->partScore()), 0);
+    }
+    checkPartsEqual(serialScore, parallelScore);
+
+    //! CHECK The link lists are not frozen after the layout
+    EXPECT_FALSE(LinkedObjects::frozen());
+
+    delete parallelScore;
+    delete serialScore;
+}
@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "infrastructure/internal/fontmetricscache.h"
+#include "infrastructure/internal/qfontprovider.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class FontMetricsCacheTests : public ::testing::Test
+{
+public:
+    FontMetricsCache::LineMetrics lineMetrics(FontMetricsCache& cache, const Font& font)
+    {
+        return cache.lineMetrics(font, [this]() {
+            ++m_computeCount;
+            FontMetricsCache::LineMetrics metrics;
+            metrics.lineSpacing = m_computeCount;
+            return metrics;
+        });
+    }
+
+    qreal horizontalAdvance(FontMetricsCache& cache, const Font& font, const QString& text)
+    {
+        return cache.textMetric<qreal>(font, text, FontMetricsCache::TextKind::String,
+                                       &FontMetricsCache::TextMetrics::horizontalAdvance, [this]() {
+            ++m_computeCount;
+            return static_cast<qreal>(m_computeCount);
+        });
+    }
+
+    int m_computeCount = 0;
+};
+
+TEST_F(FontMetricsCacheTests, LineMetricsHitsAndMisses)
+{
+    //! GIVEN An empty cache
+    FontMetricsCache cache;
+
+    Font font;
+    font.setFamily("Edwin");
+    font.setPointSizeF(10.0);
+
+    //! DO Ask twice for the same font
+    qreal first = lineMetrics(cache, font).lineSpacing;
+    qreal second = lineMetrics(cache, font).lineSpacing;
+
+    //! CHECK The metrics are computed once
+    EXPECT_EQ(m_computeCount, 1);
+    EXPECT_EQ(first, second);
+
+    FontMetricsCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.fonts, 1u);
+}
+
+TEST_F(FontMetricsCacheTests, DifferentPointSizesMiss)
+{
+    //! GIVEN A cache with the metrics of a font
+    FontMetricsCache cache;
+
+    Font font;
+    font.setFamily("Edwin");
+    font.setPointSizeF(10.0);
+    lineMetrics(cache, font);
+
+    //! DO Ask for the same font with a slightly different size
+    Font other = font;
+    other.setPointSizeF(10.0 + 1e-9);
+    lineMetrics(cache, other);
+    lineMetrics(cache, other);
+
+    //! CHECK The close sizes are different keys, each one is computed once
+    EXPECT_EQ(m_computeCount, 2);
+
+    FontMetricsCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.fonts, 2u);
+}
+
+TEST_F(FontMetricsCacheTests, TextMetricsHitsAndMisses)
+{
+    //! GIVEN An empty cache
+    FontMetricsCache cache;
+
+    Font font;
+    font.setFamily("Edwin");
+    font.setPointSizeF(10.0);
+
+    //! DO Ask for two strings, one of them twice, and for the same string with another font
+    horizontalAdvance(cache, font, "abc");
+    horizontalAdvance(cache, font, "abc");
+    horizontalAdvance(cache, font, "abd");
+
+    Font bold = font;
+    bold.setBold(true);
+    horizontalAdvance(cache, bold, "abc");
+
+    //! CHECK Only the repeated request is a hit
+    EXPECT_EQ(m_computeCount, 3);
+
+    FontMetricsCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 3u);
+    EXPECT_EQ(stats.texts, 3u);
+}
+
+TEST_F(FontMetricsCacheTests, Clear)
+{
+    //! GIVEN A cache with the metrics of a font and a string
+    FontMetricsCache cache;
+
+    Font font;
+    font.setFamily("Edwin");
+    font.setPointSizeF(10.0);
+    lineMetrics(cache, font);
+    horizontalAdvance(cache, font, "abc");
+
+    //! DO Clear it
+    cache.clear();
+
+    //! CHECK The metrics are computed again
+    EXPECT_EQ(cache.stats().fonts, 0u);
+    EXPECT_EQ(cache.stats().texts, 0u);
+
+    lineMetrics(cache, font);
+    horizontalAdvance(cache, font, "abc");
+    EXPECT_EQ(m_computeCount, 4);
+}
+
+TEST_F(FontMetricsCacheTests, ClearWhenFontAdded)
+{
+    //! GIVEN A font provider with the cached metrics
+    QFontProvider provider;
+
+    Font font;
+    font.setFamily("Edwin");
+    font.setPointSizeF(10.0);
+    provider.lineSpacing(font);
+    provider.horizontalAdvance(font, QString("abc"));
+
+    FontMetricsCache::Stats stats = provider.metricsCacheStats();
+    EXPECT_EQ(stats.fonts, 1u);
+    EXPECT_EQ(stats.texts, 1u);
+
+    //! DO Add a font
+    provider.addApplicationFont("Edwin", ":/fonts/edwin/Edwin-Roman.otf");
+
+    //! CHECK The cached metrics are dropped
+    stats = provider.metricsCacheStats();
+    EXPECT_EQ(stats.fonts, 0u);
+    EXPECT_EQ(stats.texts, 0u);
+}
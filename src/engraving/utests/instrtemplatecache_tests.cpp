@@ -0,0 +1,170 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QBuffer>
+#include <QByteArray>
+
+#include "libmscore/instrtemplate.h"
+#include "libmscore/instrtemplatecache.h"
+#include "libmscore/scoreorder.h"
+#include "libmscore/stafftype.h"
+#include "rw/xml.h"
+
+using namespace Ms;
+
+class InstrTemplateCacheTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        clearInstrumentTemplates();
+        loadInstrumentTemplates(":/data/instruments.xml");
+        loadInstrumentTemplates(":/data/orders.xml");
+    }
+
+    void TearDown() override
+    {
+        //! NOTE Other tests use only the instruments
+        clearInstrumentTemplates();
+        loadInstrumentTemplates(":/data/instruments.xml");
+    }
+
+    //! NOTE Everything that is loaded, in a comparable form
+    static QString dumpTemplates()
+    {
+        QByteArray data;
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::WriteOnly);
+
+        XmlWriter xml(nullptr, &buffer);
+        for (const MidiArticulation& a : qAsConst(articulation)) {
+            a.write(xml);
+        }
+
+        for (const InstrumentGenre* genre : qAsConst(instrumentGenres)) {
+            xml.tag("Genre", genre->id + "/" + genre->name);
+        }
+
+        for (const InstrumentFamily* family : qAsConst(instrumentFamilies)) {
+            xml.tag("Family", family->id + "/" + family->name);
+        }
+
+        for (const InstrumentGroup* group : qAsConst(instrumentGroups)) {
+            xml.startObject(QString("InstrumentGroup id=\"%1\"").arg(group->id));
+            xml.tag("name", group->name);
+            xml.tag("extended", group->extended);
+            for (const InstrumentTemplate* t : group->instrumentTemplates) {
+                t->write(xml);
+                xml.tag("trackName", t->trackName);
+                xml.tag("sequenceOrder", t->sequenceOrder);
+                xml.tag("groupId", t->groupId);
+                xml.tag("staffTypePreset", t->staffTypePreset ? t->staffTypePreset->xmlName() : QString());
+            }
+            xml.endObject();
+        }
+
+        xml.flush();
+        return QString::fromUtf8(data);
+    }
+};
+
+TEST_F(InstrTemplateCacheTests, WriteRead)
+{
+    //! GIVEN The loaded instrument templates and score orders
+    ASSERT_FALSE(instrumentGroups.isEmpty());
+    ASSERT_FALSE(instrumentOrders.isEmpty());
+
+    const QString originTemplates = dumpTemplates();
+    const QList<ScoreOrder> originOrders = instrumentOrders;
+    const QByteArray hash("source hash");
+
+    //! DO Write them to the cache
+    QByteArray cacheData;
+    {
+        QBuffer buf(&cacheData);
+        buf.open(QIODevice::WriteOnly);
+        EXPECT_TRUE(writeInstrumentTemplatesCache(&buf, hash));
+    }
+
+    //! DO Read them back
+    clearInstrumentTemplates();
+    {
+        QBuffer buf(&cacheData);
+        buf.open(QIODevice::ReadOnly);
+        EXPECT_TRUE(readInstrumentTemplatesCache(&buf, hash));
+    }
+
+    //! CHECK The same templates and orders are loaded
+    EXPECT_EQ(dumpTemplates(), originTemplates);
+
+    ASSERT_EQ(instrumentOrders.size(), originOrders.size());
+    for (int i = 0; i < originOrders.size(); ++i) {
+        EXPECT_TRUE(instrumentOrders.at(i) == originOrders.at(i));
+        EXPECT_EQ(instrumentOrders.at(i).name, originOrders.at(i).name);
+    }
+
+    //! CHECK The genres and the family point to the loaded lists
+    for (const InstrumentGroup* group : qAsConst(instrumentGroups)) {
+        for (const InstrumentTemplate* t : group->instrumentTemplates) {
+            for (InstrumentGenre* genre : t->genres) {
+                EXPECT_TRUE(instrumentGenres.contains(genre));
+            }
+            EXPECT_TRUE(!t->family || instrumentFamilies.contains(t->family));
+        }
+    }
+}
+
+TEST_F(InstrTemplateCacheTests, OutdatedCache)
+{
+    //! GIVEN The cache written for a source hash
+    QByteArray cacheData;
+    {
+        QBuffer buf(&cacheData);
+        buf.open(QIODevice::WriteOnly);
+        EXPECT_TRUE(writeInstrumentTemplatesCache(&buf, QByteArray("old hash")));
+    }
+
+    //! DO Read it for another hash
+    {
+        QBuffer buf(&cacheData);
+        buf.open(QIODevice::ReadOnly);
+        EXPECT_FALSE(readInstrumentTemplatesCache(&buf, QByteArray("new hash")));
+    }
+
+    //! CHECK Nothing is loaded
+    EXPECT_TRUE(instrumentGroups.isEmpty());
+    EXPECT_TRUE(instrumentOrders.isEmpty());
+
+    //! DO Read a truncated cache
+    cacheData.truncate(cacheData.size() / 2);
+    {
+        QBuffer buf(&cacheData);
+        buf.open(QIODevice::ReadOnly);
+        EXPECT_FALSE(readInstrumentTemplatesCache(&buf, QByteArray("old hash")));
+    }
+
+    //! CHECK Nothing is loaded
+    EXPECT_TRUE(instrumentGroups.isEmpty());
+    EXPECT_TRUE(instrumentGenres.isEmpty());
+}
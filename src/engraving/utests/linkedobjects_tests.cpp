@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/note.h"
+#include "libmscore/undo.h"
+
+#include "utils/scoregenerator.h"
+#include "utils/scoreutils.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class LinkedObjectsTests : public ::testing::Test
+{
+};
+
+TEST_F(LinkedObjectsTests, ChangeLinkedProperty)
+{
+    //! GIVEN A score with a linked staff and a part for each instrument
+    ScoreGenerator::Params params;
+    params.staves = 2;
+    params.measures = 4;
+    params.parts = true;
+    params.linkedStaves = true;
+
+    MasterScore* score = ScoreGenerator::generate(params);
+    ASSERT_TRUE(score);
+    score->doLayout();
+
+    Note* note = ScoreUtils::firstNote(score);
+    ASSERT_TRUE(note);
+
+    const QList<EngravingObject*> links = note->linkList();
+    ASSERT_EQ(links.size(), 4);
+
+    ChangeLinkedProperty::resetStats();
+
+    //! DO Change a linked property of the note
+    score->startCmd();
+    note->undoChangeProperty(Pid::GHOST, true);
+    score->endCmd();
+
+    //! CHECK All the linked notes are changed with one command
+    for (EngravingObject* e : links) {
+        EXPECT_TRUE(e->getProperty(Pid::GHOST).toBool());
+    }
+
+    ChangeLinkedProperty::Stats stats = ChangeLinkedProperty::stats();
+    EXPECT_EQ(stats.commands, 1u);
+    EXPECT_EQ(stats.members, 4u);
+    EXPECT_EQ(stats.maxMembers, 4u);
+    EXPECT_EQ(stats.scores, 2u);
+
+    //! DO Undo the change
+    score->undoStack()->undo(nullptr);
+
+    //! CHECK All the linked notes are restored
+    for (EngravingObject* e : links) {
+        EXPECT_FALSE(e->getProperty(Pid::GHOST).toBool());
+    }
+
+    delete score;
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "libmscore/objectpool.h"
+
+using namespace Ms;
+
+class ObjectPoolTests : public ::testing::Test
+{
+};
+
+TEST_F(ObjectPoolTests, ReuseFreedObjects)
+{
+    //! GIVEN A pool with one allocated object
+    ObjectPool pool(40);
+    void* first = pool.allocate();
+    EXPECT_EQ(pool.usedCount(), 1u);
+
+    //! DO Free it and allocate again
+    pool.deallocate(first);
+    void* second = pool.allocate();
+
+    //! CHECK The freed memory is reused
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(pool.usedCount(), 1u);
+    EXPECT_EQ(pool.slabCount(), 1u);
+
+    pool.deallocate(second);
+    EXPECT_EQ(pool.usedCount(), 0u);
+}
+
+TEST_F(ObjectPoolTests, GrowBySlabs)
+{
+    //! GIVEN An empty pool
+    ObjectPool pool(40);
+    EXPECT_EQ(pool.objectSize() % alignof(std::max_align_t), 0u);
+
+    //! DO Allocate more objects than fit into one slab
+    std::set<void*> objects;
+    for (size_t i = 0; i < ObjectPool::OBJECTS_PER_SLAB + 1; ++i) {
+        objects.insert(pool.allocate());
+    }
+
+    //! CHECK All objects are distinct and aligned, a second slab is added
+    EXPECT_EQ(objects.size(), ObjectPool::OBJECTS_PER_SLAB + 1);
+    EXPECT_EQ(pool.slabCount(), 2u);
+    for (void* p : objects) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignof(std::max_align_t), 0u);
+        pool.deallocate(p);
+    }
+    EXPECT_EQ(pool.usedCount(), 0u);
+}
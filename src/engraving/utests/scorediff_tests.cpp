@@ -0,0 +1,421 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <QElapsedTimer>
+
+#include "libmscore/factory.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/note.h"
+#include "libmscore/part.h"
+#include "libmscore/scorediff.h"
+#include "libmscore/segment.h"
+#include "libmscore/spanner.h"
+#include "libmscore/staff.h"
+#include "libmscore/stafftext.h"
+#include "libmscore/structuralscorediff.h"
+
+#include "utils/scoregenerator.h"
+#include "utils/scorerw.h"
+#include "utils/scoreutils.h"
+
+#include "log.h"
+
+static const QString ALL_ELEMENTS_DATA_DIR("all_elements_data/");
+static const QString SCOREDIFF_DATA_DIR("scorediff_data/");
+
+using namespace Ms;
+using namespace mu::engraving;
+
+class ScoreDiffTests : public ::testing::Test
+{
+public:
+    //! NOTE The inserted and removed elements, the property changes are not included
+    static std::vector<const ElementDiff*> elementDiffs(StructuralScoreDiff& diff)
+    {
+        std::vector<const ElementDiff*> result;
+        for (const BaseDiff* d : diff.diffs()) {
+            if (d->itemType() == ItemType::ELEMENT) {
+                result.push_back(static_cast<const ElementDiff*>(d));
+            }
+        }
+        return result;
+    }
+
+    static MasterScore* generateScore(int staves, int spannersEvery)
+    {
+        ScoreGenerator::Params params;
+        params.staves = staves;
+        params.measures = 8;
+        params.spannersEvery = spannersEvery;
+
+        MasterScore* score = ScoreGenerator::generate(params);
+        if (score) {
+            score->doLayout();
+        }
+        return score;
+    }
+
+    static Measure* measureAt(Score* score, int idx)
+    {
+        Measure* m = score->firstMeasure();
+        for (int i = 0; m && i < idx; ++i) {
+            m = m->nextMeasure();
+        }
+        return m;
+    }
+};
+
+TEST_F(ScoreDiffTests, EqualScores)
+{
+    //! GIVEN The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    MasterScore* score2 = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Compare them
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK There are no differences
+    EXPECT_TRUE(diff.equal());
+    EXPECT_TRUE(ScoreDiff(score1, score2, true).equal());
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, ChangedPitch)
+{
+    //! GIVEN The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    MasterScore* score2 = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Change the pitch of a note in the second score
+    Note* note = ScoreUtils::firstNote(score2);
+    ASSERT_TRUE(note);
+    score2->startCmd();
+    note->undoChangeProperty(Pid::PITCH, note->pitch() + 1);
+    score2->endCmd();
+
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK The pitch change of this note is found
+    bool found = false;
+    for (const BaseDiff* d : diff.diffs()) {
+        if (d->itemType() == ItemType::PROPERTY && d->ctx[1] == note
+            && static_cast<const PropertyDiff*>(d)->pid == Pid::PITCH) {
+            found = true;
+        }
+    }
+    EXPECT_TRUE(found);
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, InsertedMeasure)
+{
+    //! GIVEN The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Insert a measure before the third measure of the second score
+    score2->startCmd();
+    MeasureBase* inserted = score2->insertMeasure(ElementType::MEASURE, measureAt(score2, 2));
+    score2->endCmd();
+    ASSERT_TRUE(inserted);
+
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK Only the inserted measure is found, after the second measure
+    std::vector<const ElementDiff*> diffs = elementDiffs(diff);
+    ASSERT_EQ(diffs.size(), 1);
+    EXPECT_EQ(diffs[0]->type, DiffType::INSERT);
+    EXPECT_EQ(diffs[0]->el[0], nullptr);
+    EXPECT_EQ(diffs[0]->el[1], inserted);
+    EXPECT_EQ(diffs[0]->ctx[0], measureAt(score1, 1));
+    EXPECT_EQ(diffs[0]->ctx[1], measureAt(score2, 1));
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, RemovedMeasure)
+{
+    //! GIVEN The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Remove the third measure of the second score
+    Measure* removed = measureAt(score2, 2);
+    ASSERT_TRUE(removed);
+    score2->startCmd();
+    score2->deleteMeasures(removed, removed);
+    score2->endCmd();
+
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK Only the third measure of the first score is found as removed
+    std::vector<const ElementDiff*> diffs = elementDiffs(diff);
+    ASSERT_EQ(diffs.size(), 1);
+    EXPECT_EQ(diffs[0]->type, DiffType::DELETE);
+    EXPECT_EQ(diffs[0]->el[0], measureAt(score1, 2));
+    EXPECT_EQ(diffs[0]->el[1], nullptr);
+    EXPECT_EQ(diffs[0]->ctx[0], measureAt(score1, 1));
+    EXPECT_EQ(diffs[0]->ctx[1], measureAt(score2, 1));
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, ReorderedMeasures)
+{
+    //! GIVEN A score with the measures 1 2 3 4 5 6 and a score with the measures 1 4 5 2 3 6
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures-reordered.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Compare them
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK The common measures 1 4 5 6 are aligned,
+    //! the measures 2 3 are removed before them and inserted after them
+    std::vector<const ElementDiff*> diffs = elementDiffs(diff);
+    ASSERT_EQ(diffs.size(), 4);
+
+    std::vector<const EngravingObject*> removed;
+    std::vector<const EngravingObject*> inserted;
+    for (const ElementDiff* d : diffs) {
+        if (d->type == DiffType::DELETE) {
+            removed.push_back(d->el[0]);
+        } else if (d->type == DiffType::INSERT) {
+            inserted.push_back(d->el[1]);
+        }
+    }
+
+    auto contains = [](const std::vector<const EngravingObject*>& list, const EngravingObject* e) {
+        return std::find(list.cbegin(), list.cend(), e) != list.cend();
+    };
+
+    ASSERT_EQ(removed.size(), 2);
+    EXPECT_TRUE(contains(removed, measureAt(score1, 1)));
+    EXPECT_TRUE(contains(removed, measureAt(score1, 2)));
+
+    ASSERT_EQ(inserted.size(), 2);
+    EXPECT_TRUE(contains(inserted, measureAt(score2, 3)));
+    EXPECT_TRUE(contains(inserted, measureAt(score2, 4)));
+
+    //! CHECK The aligned measures have no property changes
+    EXPECT_EQ(diffs.size(), diff.diffs().size());
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, AddedStaff)
+{
+    //! GIVEN The same score generated twice
+    MasterScore* score1 = generateScore(2, 0);
+    MasterScore* score2 = generateScore(2, 0);
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Add a staff to the last part of the second score
+    Staff* oldStaff = score2->staff(1);
+    Staff* newStaff = Factory::createStaff(oldStaff->part());
+    newStaff->setPart(oldStaff->part());
+    newStaff->initFromStaffType(oldStaff->staffType(Fraction(0, 1)));
+    newStaff->setDefaultClefType(ClefTypeList(ClefType::F));
+
+    score2->startCmd();
+    score2->undoInsertStaff(newStaff, 2, true);
+    score2->endCmd();
+
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK Only the added staff is found, its content is not compared
+    std::vector<const ElementDiff*> diffs = elementDiffs(diff);
+    ASSERT_EQ(diffs.size(), 1);
+    EXPECT_EQ(diffs[0]->type, DiffType::INSERT);
+    EXPECT_EQ(diffs[0]->el[0], nullptr);
+    EXPECT_EQ(diffs[0]->el[1], newStaff);
+    EXPECT_EQ(diffs[0]->ctx[0], score1);
+    EXPECT_EQ(diffs[0]->ctx[1], score2);
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, RemovedStaff)
+{
+    //! GIVEN The same score generated twice
+    MasterScore* score1 = generateScore(3, 0);
+    MasterScore* score2 = generateScore(3, 0);
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Remove the last part of the second score
+    score2->startCmd();
+    score2->cmdRemovePart(score2->parts().back());
+    score2->endCmd();
+
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK Only the last staff of the first score is found as removed
+    std::vector<const ElementDiff*> diffs = elementDiffs(diff);
+    ASSERT_EQ(diffs.size(), 1);
+    EXPECT_EQ(diffs[0]->type, DiffType::DELETE);
+    EXPECT_EQ(diffs[0]->el[0], score1->staff(2));
+    EXPECT_EQ(diffs[0]->el[1], nullptr);
+    EXPECT_EQ(diffs[0]->ctx[0], score1);
+    EXPECT_EQ(diffs[0]->ctx[1], score2);
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, AddedAnnotation)
+{
+    //! GIVEN The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "measures.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! DO Add a staff text to the second measure of the second score
+    Segment* segment = measureAt(score2, 1)->first(SegmentType::ChordRest);
+    ASSERT_TRUE(segment);
+    StaffText* text = Factory::createStaffText(segment);
+    text->setPlainText("staff text");
+    text->setTrack(0);
+    text->setParent(segment);
+
+    score2->startCmd();
+    score2->undoAddElement(text);
+    score2->endCmd();
+
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK Only the added text is found, in the second measure
+    std::vector<const ElementDiff*> diffs = elementDiffs(diff);
+    ASSERT_EQ(diffs.size(), 1);
+    EXPECT_EQ(diffs[0]->type, DiffType::INSERT);
+    EXPECT_EQ(diffs[0]->el[0], nullptr);
+    EXPECT_EQ(diffs[0]->el[1], text);
+    EXPECT_EQ(diffs[0]->ctx[0], measureAt(score1, 1));
+    EXPECT_EQ(diffs[0]->ctx[1], measureAt(score2, 1));
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, RemovedSpanner)
+{
+    //! GIVEN The same score with slurs and hairpins generated twice
+    MasterScore* score1 = generateScore(1, 2);
+    MasterScore* score2 = generateScore(1, 2);
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    auto firstHairpin = [](Score* score) -> Spanner* {
+        for (const auto& i : score->spanner()) {
+            if (i.second->isHairpin()) {
+                return i.second;
+            }
+        }
+        return nullptr;
+    };
+
+    Spanner* hairpin1 = firstHairpin(score1);
+    Spanner* hairpin2 = firstHairpin(score2);
+    ASSERT_TRUE(hairpin1);
+    ASSERT_TRUE(hairpin2);
+    ASSERT_EQ(hairpin1->tick(), hairpin2->tick());
+
+    //! DO Remove the first hairpin of the second score
+    score2->startCmd();
+    score2->undoRemoveElement(hairpin2);
+    score2->endCmd();
+
+    StructuralScoreDiff diff(score1, score2);
+
+    //! CHECK Only the hairpin of the first score is found as removed, in its start measure
+    std::vector<const ElementDiff*> diffs = elementDiffs(diff);
+    ASSERT_EQ(diffs.size(), 1);
+    EXPECT_EQ(diffs[0]->type, DiffType::DELETE);
+    EXPECT_EQ(diffs[0]->el[0], hairpin1);
+    EXPECT_EQ(diffs[0]->el[1], nullptr);
+    EXPECT_EQ(diffs[0]->ctx[0], score1->tick2measure(hairpin1->tick()));
+    EXPECT_EQ(diffs[0]->ctx[1], score2->tick2measure(hairpin1->tick()));
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreDiffTests, DISABLED_Benchmark)
+{
+    //! GIVEN The same score read twice, with one changed note
+    MasterScore* score1 = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    MasterScore* score2 = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    Note* note = ScoreUtils::firstNote(score2);
+    ASSERT_TRUE(note);
+    score2->startCmd();
+    note->undoChangeProperty(Pid::PITCH, note->pitch() + 1);
+    score2->endCmd();
+
+    constexpr int ITERATIONS = 10;
+
+    //! DO Compare the scores with the text and the structural diffs
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        ScoreDiff diff(score1, score2);
+    }
+    qint64 textDiffTime = timer.elapsed();
+
+    timer.restart();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        StructuralScoreDiff diff(score1, score2);
+    }
+    qint64 structuralDiffTime = timer.elapsed();
+
+    //! CHECK Print the results
+    LOGI() << "ScoreDiff: " << textDiffTime / ITERATIONS << " ms, StructuralScoreDiff: " << structuralDiffTime / ITERATIONS << " ms";
+
+    delete score1;
+    delete score2;
+}
@@ -0,0 +1,180 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "libmscore/chord.h"
+#include "libmscore/excerpt.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+
+#include "utils/scoregenerator.h"
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace Ms;
+using namespace mu::engraving;
+
+class ScoreGeneratorTests : public ::testing::Test
+{
+public:
+    //! NOTE The written scores are removed with the temporary dir after each test
+    QString scorePath(const ScoreGenerator::Params& params) const
+    {
+        return QDir(m_dir.path()).filePath(params.name() + ".mscz");
+    }
+
+    QTemporaryDir m_dir;
+};
+
+static ScoreGenerator::Params allFeaturesParams()
+{
+    ScoreGenerator::Params params;
+    params.staves = 3;
+    params.measures = 8;
+    params.notesPerMeasure = 4;
+    params.tupletsEvery = 2;
+    params.lyrics = true;
+    params.chordSymbols = true;
+    params.spannersEvery = 2;
+    params.parts = true;
+    params.linkedStaves = true;
+    return params;
+}
+
+TEST_F(ScoreGeneratorTests, Generate)
+{
+    //! GIVEN Params with all features
+    ScoreGenerator::Params params = allFeaturesParams();
+
+    //! DO Generate the score
+    MasterScore* score = ScoreGenerator::generate(params);
+    ASSERT_TRUE(score);
+    score->doLayout();
+
+    //! CHECK The score has the requested structure
+    EXPECT_EQ(score->nmeasures(), params.measures);
+    EXPECT_EQ(score->parts().size(), params.staves);
+    EXPECT_EQ(score->nstaves(), params.staves * 2);
+    EXPECT_EQ(score->excerpts().size(), params.staves);
+    EXPECT_FALSE(score->spanner().empty());
+
+    //! CHECK The first measure has chords with lyrics and a chord symbol
+    Segment* segment = score->firstMeasure()->first(SegmentType::ChordRest);
+    ASSERT_TRUE(segment);
+    EngravingItem* e = segment->element(0);
+    ASSERT_TRUE(e && e->isChord());
+    EXPECT_FALSE(toChord(e)->lyrics().empty());
+    EXPECT_FALSE(segment->annotations().empty());
+
+    //! CHECK The second measure is filled with triplets
+    segment = score->firstMeasure()->nextMeasure()->first(SegmentType::ChordRest);
+    ASSERT_TRUE(segment);
+    e = segment->element(0);
+    ASSERT_TRUE(e && e->isChord());
+    EXPECT_TRUE(toChord(e)->tuplet());
+
+    delete score;
+}
+
+TEST_F(ScoreGeneratorTests, WriteRead)
+{
+    ASSERT_TRUE(m_dir.isValid());
+
+    //! GIVEN A generated score with all features
+    ScoreGenerator::Params params = allFeaturesParams();
+    MasterScore* score = ScoreGenerator::generate(params);
+    ASSERT_TRUE(score);
+
+    //! DO Write it as mscz and read back
+    const QString path = scorePath(params);
+    ASSERT_TRUE(ScoreGenerator::writeMscz(score, path));
+
+    MasterScore* readScore = ScoreRW::readScore(path, true);
+    ASSERT_TRUE(readScore);
+
+    //! CHECK The structure is the same
+    EXPECT_EQ(readScore->nmeasures(), score->nmeasures());
+    EXPECT_EQ(readScore->nstaves(), score->nstaves());
+    EXPECT_EQ(readScore->excerpts().size(), score->excerpts().size());
+    EXPECT_EQ(readScore->spanner().size(), score->spanner().size());
+
+    delete readScore;
+    delete score;
+}
+
+TEST_F(ScoreGeneratorTests, DISABLED_Scaling)
+{
+    //! GIVEN Scores growing in one dimension
+    std::vector<ScoreGenerator::Params> series;
+    for (int measures : { 100, 200, 400, 800, 2000 }) {
+        ScoreGenerator::Params params;
+        params.staves = 8;
+        params.measures = measures;
+        series.push_back(params);
+    }
+    for (int staves : { 1, 4, 16, 60 }) {
+        ScoreGenerator::Params params;
+        params.staves = staves;
+        params.measures = 100;
+        series.push_back(params);
+    }
+
+    ASSERT_TRUE(m_dir.isValid());
+
+    for (const ScoreGenerator::Params& params : series) {
+        //! DO Layout, save and load each score
+        MasterScore* score = ScoreGenerator::generate(params);
+        ASSERT_TRUE(score);
+
+        QElapsedTimer timer;
+        timer.start();
+        score->doLayout();
+        qint64 layoutTime = timer.elapsed();
+
+        const QString path = scorePath(params);
+        timer.restart();
+        ASSERT_TRUE(ScoreGenerator::writeMscz(score, path));
+        qint64 saveTime = timer.elapsed();
+
+        timer.restart();
+        MasterScore* readScore = ScoreRW::readScore(path, true);
+        qint64 loadTime = timer.elapsed();
+        ASSERT_TRUE(readScore);
+
+        //! NOTE The largest scores take a lot of space, so they are not kept until the end of the test
+        QFile::remove(path);
+
+        //! CHECK Print the results
+        LOGI() << params.name() << ": layout " << layoutTime << " ms, save " << saveTime << " ms, load " << loadTime << " ms";
+
+        delete readScore;
+        delete score;
+    }
+}
@@ -0,0 +1,337 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "scoregenerator.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "engraving/infrastructure/io/mscwriter.h"
+
+#include "engraving/libmscore/chord.h"
+#include "engraving/libmscore/excerpt.h"
+#include "engraving/libmscore/factory.h"
+#include "engraving/libmscore/hairpin.h"
+#include "engraving/libmscore/harmony.h"
+#include "engraving/libmscore/lyrics.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/mcursor.h"
+#include "engraving/libmscore/measure.h"
+#include "engraving/libmscore/note.h"
+#include "engraving/libmscore/part.h"
+#include "engraving/libmscore/rest.h"
+#include "engraving/libmscore/segment.h"
+#include "engraving/libmscore/slur.h"
+#include "engraving/libmscore/staff.h"
+#include "engraving/libmscore/tuplet.h"
+
+#include "log.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+static const Fraction TIME_SIG(4, 4);
+
+//! NOTE Single staff instruments, the parts are cycled through them
+static const char* INSTRUMENTS[] = {
+    "violin", "viola", "violoncello", "flute", "oboe", "clarinet", "bassoon", "horn", "trumpet", "trombone"
+};
+
+static const char* CHORD_SYMBOLS[] = { "C", "Am7", "Dm7", "G7", "Cmaj7", "F6", "Bb7(#11)", "E7b9" };
+static const char* SYLLABLES[] = { "la", "li", "lo", "lu", "le" };
+
+static const int SCALE[] = { 0, 2, 4, 5, 7, 9, 11 };
+
+//! NOTE Two octaves of the C major scale from C4, so there are no accidentals
+static int scalePitch(int step)
+{
+    step %= 14;
+    return 60 + 12 * (step / 7) + SCALE[step % 7];
+}
+
+static void appendMeasures(MasterScore* score, int count)
+{
+    Fraction tick = score->lastMeasure() ? score->lastMeasure()->endTick() : Fraction(0, 1);
+    for (int i = 0; i < count; ++i) {
+        Measure* measure = Factory::createMeasure(score->dummy()->system());
+        measure->setTick(tick);
+        measure->setTimesig(TIME_SIG);
+        measure->setTicks(TIME_SIG);
+        score->measures()->add(measure);
+        tick += TIME_SIG;
+    }
+}
+
+static Chord* addChord(Measure* measure, int track, const Fraction& tick, const TDuration& duration, int step, Tuplet* tuplet)
+{
+    Segment* segment = measure->getSegment(SegmentType::ChordRest, tick);
+    Chord* chord = Factory::createChord(segment);
+    chord->setTrack(track);
+    chord->setDurationType(duration);
+    chord->setTicks(duration.fraction());
+    chord->setTuplet(tuplet);
+    segment->add(chord);
+
+    if (tuplet) {
+        tuplet->add(chord);
+    }
+
+    //! NOTE Every 4th chord has two notes
+    const int notes = step % 4 == 0 ? 2 : 1;
+    for (int i = 0; i < notes; ++i) {
+        Note* note = Factory::createNote(chord);
+        chord->add(note);
+        note->setPitch(scalePitch(step + i * 2));
+        note->setTpcFromPitch();
+    }
+
+    return chord;
+}
+
+static std::vector<Chord*> fillMeasure(Measure* measure, int track, int firstStep, int notesPerMeasure, bool withTuplets)
+{
+    std::vector<Chord*> chords;
+    Fraction tick = measure->tick();
+    int step = firstStep;
+
+    if (withTuplets) {
+        //! NOTE Eighth triplets on every beat
+        const TDuration eighth(DurationType::V_EIGHTH);
+        const Fraction tripletTicks(1, 12);
+
+        for (int beat = 0; beat < TIME_SIG.numerator(); ++beat) {
+            Tuplet* tuplet = new Tuplet(measure);
+            tuplet->setRatio(Fraction(3, 2));
+            tuplet->setTicks(Fraction(1, 4));
+            tuplet->setBaseLen(eighth);
+            tuplet->setTrack(track);
+            tuplet->setTick(tick);
+            tuplet->setParent(measure);
+
+            for (int i = 0; i < 3; ++i) {
+                chords.push_back(addChord(measure, track, tick, eighth, step++, tuplet));
+                tick += tripletTicks;
+            }
+        }
+
+        return chords;
+    }
+
+    const TDuration duration(TIME_SIG / notesPerMeasure);
+    for (int i = 0; i < notesPerMeasure; ++i) {
+        chords.push_back(addChord(measure, track, tick, duration, step++, nullptr));
+        tick += duration.fraction();
+    }
+
+    return chords;
+}
+
+static void addMeasureRest(Measure* measure, int track)
+{
+    Segment* segment = measure->getSegment(SegmentType::ChordRest, measure->tick());
+    Rest* rest = Factory::createRest(segment, TDuration(DurationType::V_MEASURE));
+    rest->setTrack(track);
+    rest->setTicks(measure->ticks());
+    segment->add(rest);
+}
+
+static void addLyrics(const std::vector<Chord*>& chords)
+{
+    for (size_t i = 0; i < chords.size(); ++i) {
+        Chord* chord = chords[i];
+        Lyrics* lyrics = Factory::createLyrics(chord);
+        lyrics->setTrack(chord->track());
+        lyrics->setPlainText(SYLLABLES[i % std::size(SYLLABLES)]);
+        chord->add(lyrics);
+    }
+}
+
+static void addChordSymbols(Measure* measure, int track, int measureIdx)
+{
+    //! NOTE Two chord symbols per measure, on the first and the third beat (if there is a chord)
+    const Fraction ticks[] = { measure->tick(), measure->tick() + TIME_SIG / 2 };
+    for (size_t i = 0; i < std::size(ticks); ++i) {
+        Segment* segment = measure->findSegment(SegmentType::ChordRest, ticks[i]);
+        if (!segment || !segment->element(track)) {
+            continue;
+        }
+
+        Harmony* harmony = Factory::createHarmony(segment);
+        harmony->setTrack(track);
+        harmony->setHarmony(CHORD_SYMBOLS[(measureIdx * 2 + i) % std::size(CHORD_SYMBOLS)]);
+        segment->add(harmony);
+    }
+}
+
+static void addSpanners(MasterScore* score, Measure* measure, int track, const std::vector<Chord*>& chords, int measureIdx)
+{
+    if (chords.size() > 1) {
+        Slur* slur = Factory::createSlur(score->dummy());
+        slur->setTrack(track);
+        slur->setTrack2(track);
+        slur->setTick(chords.front()->tick());
+        slur->setTick2(chords.back()->tick());
+        slur->setStartElement(chords.front());
+        slur->setEndElement(chords.back());
+        score->addSpanner(slur);
+    }
+
+    Hairpin* hairpin = Factory::createHairpin(score->dummy()->segment());
+    hairpin->setHairpinType(measureIdx % 2 ? HairpinType::DECRESC_HAIRPIN : HairpinType::CRESC_HAIRPIN);
+    hairpin->setTrack(track);
+    hairpin->setTrack2(track);
+    hairpin->setTick(measure->tick());
+    hairpin->setTick2(measure->endTick());
+    score->addSpanner(hairpin);
+}
+
+static void addLinkedStaves(MasterScore* score)
+{
+    //! NOTE The same as adding a linked staff in the instruments panel
+    for (Part* part : score->parts()) {
+        Staff* staff = part->staff(0);
+        Staff* linkedStaff = Factory::createStaff(part);
+        linkedStaff->setPart(part);
+        linkedStaff->initFromStaffType(staff->staffType(Fraction(0, 1)));
+        linkedStaff->setDefaultClefType(staff->defaultClefType());
+
+        score->undoInsertStaff(linkedStaff, part->nstaves(), false);
+        Excerpt::cloneStaff(staff, linkedStaff);
+    }
+}
+
+QString ScoreGenerator::Params::name() const
+{
+    QString name = QString("gen_%1st_%2m_%3n").arg(staves).arg(measures).arg(notesPerMeasure);
+    if (tupletsEvery > 0) {
+        name += QString("_tuplets%1").arg(tupletsEvery);
+    }
+    if (lyrics) {
+        name += "_lyrics";
+    }
+    if (chordSymbols) {
+        name += "_chords";
+    }
+    if (spannersEvery > 0) {
+        name += QString("_spanners%1").arg(spannersEvery);
+    }
+    if (restsEvery > 0) {
+        name += QString("_rests%1").arg(restsEvery);
+    }
+    if (parts) {
+        name += "_parts";
+    }
+    if (linkedStaves) {
+        name += "_linked";
+    }
+    return name;
+}
+
+MasterScore* ScoreGenerator::generate(const Params& params)
+{
+    TRACEFUNC;
+
+    //! NOTE The score is built like on load, without undo commands
+    ScoreLoad sl;
+
+    //! NOTE Only the power of two durations
+    int notesPerMeasure = 1;
+    while (notesPerMeasure * 2 <= std::clamp(params.notesPerMeasure, 1, 16)) {
+        notesPerMeasure *= 2;
+    }
+
+    MCursor c;
+    c.setTimeSig(TIME_SIG);
+    c.createScore(params.name());
+    for (int i = 0; i < std::max(params.staves, 1); ++i) {
+        c.addPart(INSTRUMENTS[i % std::size(INSTRUMENTS)]);
+    }
+    c.move(0, Fraction(0, 1));
+    c.addTimeSig(TIME_SIG);
+
+    MasterScore* score = c.score();
+    appendMeasures(score, std::max(params.measures, 1) - score->nmeasures());
+    score->checkChordList();
+
+    int measureIdx = 0;
+    for (Measure* measure = score->firstMeasure(); measure; measure = measure->nextMeasure(), ++measureIdx) {
+        const bool withTuplets = params.tupletsEvery > 0 && (measureIdx % params.tupletsEvery) == params.tupletsEvery - 1;
+        const bool withSpanners = params.spannersEvery > 0 && (measureIdx % params.spannersEvery) == params.spannersEvery - 1;
+
+        for (int staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+            const int track = staffIdx * VOICES;
+            if (params.restsEvery > 0 && ((measureIdx + staffIdx) / params.restsEvery) % 2 == 1) {
+                addMeasureRest(measure, track);
+                continue;
+            }
+
+            std::vector<Chord*> chords = fillMeasure(measure, track, measureIdx * 4 + staffIdx * 3, notesPerMeasure,
+                                                     withTuplets);
+
+            if (params.lyrics) {
+                addLyrics(chords);
+            }
+
+            if (params.chordSymbols && staffIdx == 0) {
+                addChordSymbols(measure, track, measureIdx);
+            }
+
+            if (withSpanners) {
+                addSpanners(score, measure, track, chords, measureIdx);
+            }
+        }
+    }
+
+    if (params.linkedStaves) {
+        addLinkedStaves(score);
+    }
+
+    //! NOTE The same as after reading (see read400)
+    score->setUpTempoMap();
+    score->rebuildMidiMapping();
+    score->updateChannel();
+
+    if (params.parts) {
+        score->initAndAddExcerpts(Excerpt::createExcerptsFromParts(score->parts()), false);
+    }
+
+    return score;
+}
+
+bool ScoreGenerator::writeMscz(MasterScore* score, const QString& path)
+{
+    TRACEFUNC;
+
+    MscWriter::Params params;
+    params.filePath = path;
+    params.mode = MscIoMode::Zip;
+
+    MscWriter writer(params);
+    if (!writer.open()) {
+        return false;
+    }
+
+    bool ok = score->writeMscz(writer, false, false);
+    writer.close();
+
+    return ok;
+}
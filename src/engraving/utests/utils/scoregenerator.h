@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_SCOREGENERATOR_H
+#define MU_ENGRAVING_SCOREGENERATOR_H
+
+#include <QString>
+
+namespace Ms {
+class MasterScore;
+}
+
+namespace mu::engraving {
+//! NOTE Builds synthetic scores of any size for the scaling tests and benchmarks.
+//! Every feature has its own parameter, so its cost can be measured separately.
+//! The content is deterministic, the same params give the same score.
+class ScoreGenerator
+{
+public:
+    struct Params {
+        int staves = 4;
+        int measures = 32;
+        //! NOTE Chords in a 4/4 measure: 1, 2, 4, 8 or 16
+        int notesPerMeasure = 4;
+        //! NOTE Every n-th measure is filled with triplets, 0 - no tuplets
+        int tupletsEvery = 0;
+        bool lyrics = false;
+        bool chordSymbols = false;
+        //! NOTE A slur and a hairpin in every n-th measure of each staff, 0 - no spanners
+        int spannersEvery = 0;
+        //! NOTE Each staff rests for n measures in every 2n measures, shifted by the staff index,
+        //! so the parts get multimeasure rests, 0 - no rests
+        int restsEvery = 0;
+        //! NOTE An excerpt for each part
+        bool parts = false;
+        //! NOTE A linked staff for each part
+        bool linkedStaves = false;
+
+        //! NOTE The name describes the params, ex: gen_60st_2000m_4n_lyrics
+        QString name() const;
+    };
+
+    static Ms::MasterScore* generate(const Params& params);
+    static bool writeMscz(Ms::MasterScore* score, const QString& path);
+};
+}
+
+#endif // MU_ENGRAVING_SCOREGENERATOR_H
@@ -32,6 +32,7 @@
 #include "internal/audiothread.h"
 #include "internal/audiobuffer.h"
 #include "internal/audiothreadsecurer.h"
+#include "internal/rtmessagedispatcher.h"
 
 #include "internal/worker/audioengine.h"
 #include "internal/worker/playback.h"
@@ -183,6 +184,9 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
         return;
     }
 
+    // Messages from the worker, sent on every audio block (signal levels, playback position)
+    RtMessageDispatcher::instance()->start();
+
     // Setup worker
     auto workerSetup = [activeSpec]() {
         AudioSanitizer::setupWorkerThread();
@@ -232,4 +236,6 @@ void AudioModule::onDeinit()
             AudioEngine::instance()->deinit();
         });
     }
+
+    RtMessageDispatcher::instance()->stop();
 }
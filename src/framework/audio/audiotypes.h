@@ -222,39 +222,6 @@ struct AudioSignalVal {
 
 using AudioSignalChanges = async::Channel<audioch_t, AudioSignalVal>;
 
-struct AudioSignalsNotifier {
-    void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
-    {
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
-
-        volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
-
-        if (RealIsEqual(signalVal.amplitude, newAmplitude)
-            && RealIsEqual(signalVal.pressure, validatedPressure)) {
-            return;
-        }
-
-        if (std::abs(signalVal.amplitude - newAmplitude) < AMPLITUDE_MINIMAL_VALUABLE_DIFF
-            && std::abs(signalVal.pressure - newPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
-            return;
-        }
-
-        signalVal.amplitude = newAmplitude;
-        signalVal.pressure = validatedPressure;
-
-        audioSignalChanges.send(audioChNumber, signalVal);
-    }
-
-    AudioSignalChanges audioSignalChanges;
-
-private:
-    static constexpr float AMPLITUDE_MINIMAL_VALUABLE_DIFF = 0.01f;
-    static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 1.f;
-    static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
-
-    std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
-};
-
 using PlaybackData = std::variant<midi::MidiData, io::Device*>;
 
 enum class PlaybackStatus {
@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_RTCHANNEL_H
+#define MU_AUDIO_RTCHANNEL_H
+
+#include <functional>
+#include <memory>
+
+#include "rtqueue.h"
+#include "rtmessagedispatcher.h"
+
+#include "log.h"
+
+namespace mu::audio {
+//! NOTE Channel from the audio worker to the main thread, for the messages sent on every audio block
+//! (signal levels, playback position, status).
+//! Unlike async::Channel, send doesn't allocate or lock: the message is pushed into a preallocated queue,
+//! which is drained on the main thread by RtMessageDispatcher.
+//! There is one producer (the audio worker) and one receiver, which is called on the main thread.
+template<typename T, size_t Capacity = 256>
+class RtChannel
+{
+public:
+    using Handler = std::function<void (const T&)>;
+
+    RtChannel()
+        : m_data(std::make_shared<Data>()) {}
+
+    bool send(const T& message)
+    {
+        return m_data->queue.push(message);
+    }
+
+    void onReceive(const Handler& handler)
+    {
+        IF_ASSERT_FAILED(!m_data->handler) {
+            return;
+        }
+
+        m_data->handler = handler;
+
+        std::weak_ptr<Data> weakData = m_data;
+        RtMessageDispatcher::instance()->addDrain([weakData]() {
+            std::shared_ptr<Data> data = weakData.lock();
+            if (!data) {
+                return false;
+            }
+
+            T message;
+            while (data->queue.pop(message)) {
+                data->handler(message);
+            }
+
+            return true;
+        });
+    }
+
+    bool isConnected() const
+    {
+        return m_data->handler != nullptr;
+    }
+
+private:
+    struct Data {
+        RtQueue<T, Capacity> queue;
+        Handler handler;
+    };
+
+    std::shared_ptr<Data> m_data;
+};
+}
+
+#endif // MU_AUDIO_RTCHANNEL_H
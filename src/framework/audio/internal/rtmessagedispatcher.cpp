@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "rtmessagedispatcher.h"
+
+#include <QTimer>
+
+#include "audiosanitizer.h"
+
+using namespace mu::audio;
+
+static constexpr int DRAIN_INTERVAL_MS = 16; // ~60 fps
+
+RtMessageDispatcher* RtMessageDispatcher::instance()
+{
+    static RtMessageDispatcher d;
+    return &d;
+}
+
+RtMessageDispatcher::~RtMessageDispatcher()
+{
+    stop();
+}
+
+void RtMessageDispatcher::addDrain(const Drain& drain)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_drains.push_back(drain);
+}
+
+void RtMessageDispatcher::start()
+{
+    ONLY_AUDIO_MAIN_THREAD;
+
+    if (m_timer) {
+        return;
+    }
+
+    m_timer = std::make_unique<QTimer>();
+    m_timer->setInterval(DRAIN_INTERVAL_MS);
+    QObject::connect(m_timer.get(), &QTimer::timeout, [this]() {
+        drain();
+    });
+    m_timer->start();
+}
+
+void RtMessageDispatcher::stop()
+{
+    if (!m_timer) {
+        return;
+    }
+
+    m_timer->stop();
+    m_timer = nullptr;
+}
+
+void RtMessageDispatcher::drain()
+{
+    //! NOTE The handlers are called without the lock,
+    //! so they can subscribe to new channels
+    std::vector<Drain> drains;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        drains.swap(m_drains);
+    }
+
+    for (auto it = drains.begin(); it != drains.end();) {
+        if ((*it)()) {
+            ++it;
+        } else {
+            it = drains.erase(it);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    drains.insert(drains.end(), m_drains.begin(), m_drains.end());
+    m_drains.swap(drains);
+}
@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_RTMESSAGEDISPATCHER_H
+#define MU_AUDIO_RTMESSAGEDISPATCHER_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class QTimer;
+
+namespace mu::audio {
+//! NOTE Drains the realtime channels (see RtChannel) on the main thread at the UI frame rate.
+//! The audio worker only pushes the messages into the preallocated queues,
+//! the handlers (and so the async channels) are called here.
+class RtMessageDispatcher
+{
+public:
+    static RtMessageDispatcher* instance();
+
+    //! NOTE Returns false when its channel is destroyed, then it is removed
+    using Drain = std::function<bool ()>;
+
+    //! NOTE Must not be called from the audio processing
+    void addDrain(const Drain& drain);
+
+    void start();
+    void stop();
+
+    void drain();
+
+private:
+    RtMessageDispatcher() = default;
+    ~RtMessageDispatcher();
+
+    std::mutex m_mutex;
+    std::vector<Drain> m_drains;
+    std::unique_ptr<QTimer> m_timer;
+};
+}
+
+#endif // MU_AUDIO_RTMESSAGEDISPATCHER_H
@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_RTQUEUE_H
+#define MU_AUDIO_RTQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace mu::audio {
+//! NOTE Lock-free single producer / single consumer queue with a preallocated storage.
+//! push and pop never allocate or lock, so it can be used from the audio worker.
+//! If the queue is full, push drops the message and returns false.
+template<typename T, size_t Capacity>
+class RtQueue
+{
+    static_assert(std::is_trivially_copyable<T>::value, "RtQueue messages must be trivially copyable");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "RtQueue capacity must be a power of two");
+
+public:
+    RtQueue() = default;
+    RtQueue(const RtQueue&) = delete;
+    RtQueue& operator=(const RtQueue&) = delete;
+
+    //! NOTE Only from the producer thread
+    bool push(const T& message)
+    {
+        const size_t write = m_writeIndex.load(std::memory_order_relaxed);
+        const size_t next = (write + 1) & MASK;
+        if (next == m_readIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        m_buffer[write] = message;
+        m_writeIndex.store(next, std::memory_order_release);
+        return true;
+    }
+
+    //! NOTE Only from the consumer thread
+    bool pop(T& message)
+    {
+        const size_t read = m_readIndex.load(std::memory_order_relaxed);
+        if (read == m_writeIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        message = m_buffer[read];
+        m_readIndex.store((read + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const
+    {
+        return m_readIndex.load(std::memory_order_acquire) == m_writeIndex.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    std::array<T, Capacity> m_buffer = {};
+    alignas(64) std::atomic<size_t> m_writeIndex { 0 };
+    alignas(64) std::atomic<size_t> m_readIndex { 0 };
+};
+}
+
+#endif // MU_AUDIO_RTQUEUE_H
@@ -34,7 +34,7 @@ namespace mu::audio {
 class Mixer;
 class AudioOutputHandler : public IAudioOutput, public async::Asyncable
 {
-    INJECT(audio, fx::IFxResolver, fxResolver)
+    INJECT_PINNED(audio, fx::IFxResolver, fxResolver)
 
 public:
     explicit AudioOutputHandler(IGetTrackSequence* getSequence);
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_AUDIOSIGNALSNOTIFIER_H
+#define MU_AUDIO_AUDIOSIGNALSNOTIFIER_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "audiotypes.h"
+#include "internal/rtchannel.h"
+
+namespace mu::audio {
+//! NOTE Called for every audio block, so the values are kept in a preallocated array
+//! and passed to the main thread through a realtime channel,
+//! audioSignalChanges is sent on the main thread
+class AudioSignalsNotifier
+{
+public:
+    AudioSignalsNotifier()
+    {
+        AudioSignalChanges audioSignalChangesCh = audioSignalChanges;
+        m_signalChanges.onReceive([audioSignalChangesCh](const SignalChange& change) mutable {
+            audioSignalChangesCh.send(change.audioChNumber, change.value);
+        });
+    }
+
+    void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
+    {
+        AudioSignalVal& signalVal = m_signalValues[audioChNumber];
+
+        volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
+
+        if (RealIsEqual(signalVal.amplitude, newAmplitude)
+            && RealIsEqual(signalVal.pressure, validatedPressure)) {
+            return;
+        }
+
+        if (std::abs(signalVal.amplitude - newAmplitude) < AMPLITUDE_MINIMAL_VALUABLE_DIFF
+            && std::abs(signalVal.pressure - newPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
+            return;
+        }
+
+        signalVal.amplitude = newAmplitude;
+        signalVal.pressure = validatedPressure;
+
+        m_signalChanges.send(SignalChange { audioChNumber, signalVal });
+    }
+
+    AudioSignalChanges audioSignalChanges;
+
+private:
+    static constexpr float AMPLITUDE_MINIMAL_VALUABLE_DIFF = 0.01f;
+    static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 1.f;
+    static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
+
+    struct SignalChange {
+        audioch_t audioChNumber = 0;
+        AudioSignalVal value;
+    };
+
+    std::array<AudioSignalVal, std::numeric_limits<audioch_t>::max() + 1> m_signalValues = {};
+    RtChannel<SignalChange> m_signalChanges;
+};
+}
+
+#endif // MU_AUDIO_AUDIOSIGNALSNOTIFIER_H
@@ -28,7 +28,6 @@ using namespace mu::audio;
 
 Clock::Clock()
 {
-    m_status.set(PlaybackStatus::Stopped);
 }
 
 msecs_t Clock::currentTime() const
@@ -60,7 +59,7 @@ void Clock::forward(const msecs_t nextMsecs)
 
 void Clock::start()
 {
-    m_status.set(PlaybackStatus::Running);
+    setStatus(PlaybackStatus::Running);
 }
 
 void Clock::reset()
@@ -71,18 +70,18 @@ void Clock::reset()
 
 void Clock::stop()
 {
-    m_status.set(PlaybackStatus::Stopped);
+    setStatus(PlaybackStatus::Stopped);
     seek(0);
 }
 
 void Clock::pause()
 {
-    m_status.set(PlaybackStatus::Paused);
+    setStatus(PlaybackStatus::Paused);
 }
 
 void Clock::resume()
 {
-    m_status.set(PlaybackStatus::Running);
+    setStatus(PlaybackStatus::Running);
     seek(m_currentTime);
 }
 
@@ -118,10 +117,16 @@ void Clock::resetTimeLoop()
 
 bool Clock::isRunning() const
 {
-    return m_status.val == PlaybackStatus::Running;
+    return m_status == PlaybackStatus::Running;
 }
 
-async::Channel<msecs_t> Clock::timeChanged() const
+void Clock::setStatus(const PlaybackStatus status)
+{
+    m_status = status;
+    m_statusChanged.send(status);
+}
+
+RtChannel<msecs_t> Clock::timeChanged() const
 {
     return m_timeChanged;
 }
@@ -131,7 +136,7 @@ async::Notification Clock::seekOccurred() const
     return m_seekOccurred;
 }
 
-async::Channel<PlaybackStatus> Clock::statusChanged() const
+RtChannel<PlaybackStatus> Clock::statusChanged() const
 {
-    return m_status.ch;
+    return m_statusChanged;
 }
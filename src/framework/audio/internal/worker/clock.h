@@ -49,19 +49,21 @@ public:
 
     bool isRunning() const override;
 
-    async::Channel<msecs_t> timeChanged() const override;
+    RtChannel<msecs_t> timeChanged() const override;
     async::Notification seekOccurred() const override;
-    async::Channel<PlaybackStatus> statusChanged() const override;
+    RtChannel<PlaybackStatus> statusChanged() const override;
 
 private:
+    void setStatus(const PlaybackStatus status);
 
-    ValCh<PlaybackStatus> m_status;
+    PlaybackStatus m_status = PlaybackStatus::Stopped;
     msecs_t m_currentTime = 0;
     msecs_t m_timeDuration = 0;
     msecs_t m_timeLoopStart = 0;
     msecs_t m_timeLoopEnd = 0;
 
-    async::Channel<msecs_t> m_timeChanged;
+    RtChannel<msecs_t> m_timeChanged;
+    RtChannel<PlaybackStatus> m_statusChanged;
     async::Notification m_seekOccurred;
 };
 }
@@ -34,7 +34,7 @@
 namespace mu::audio {
 class EventAudioSource : public ITrackAudioInput, public async::Asyncable
 {
-    INJECT(audio, synth::ISynthResolver, synthResolver)
+    INJECT_PINNED(audio, synth::ISynthResolver, synthResolver)
 
 public:
     explicit EventAudioSource(const TrackId trackId, const mpe::PlaybackData& playbackData);
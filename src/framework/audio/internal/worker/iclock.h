@@ -30,6 +30,7 @@
 #include "async/notification.h"
 
 #include "audiotypes.h"
+#include "internal/rtchannel.h"
 
 namespace mu::audio {
 class IClock
@@ -54,9 +55,10 @@ public:
 
     virtual bool isRunning() const = 0;
 
-    virtual async::Channel<msecs_t> timeChanged() const = 0;
+    //! NOTE The time is changed on every audio block, so it's passed through the realtime channels
+    virtual RtChannel<msecs_t> timeChanged() const = 0;
     virtual async::Notification seekOccurred() const = 0;
-    virtual async::Channel<PlaybackStatus> statusChanged() const = 0;
+    virtual RtChannel<PlaybackStatus> statusChanged() const = 0;
 };
 
 using IClockPtr = std::shared_ptr<IClock>;
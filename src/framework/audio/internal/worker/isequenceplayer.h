@@ -27,6 +27,7 @@
 #include "async/channel.h"
 
 #include "audiotypes.h"
+#include "internal/rtchannel.h"
 
 namespace mu::audio {
 class ISequencePlayer
@@ -44,8 +45,8 @@ public:
     virtual Ret setLoop(const msecs_t fromMsec, const msecs_t toMsec) = 0;
     virtual void resetLoop() = 0;
 
-    virtual async::Channel<msecs_t> playbackPositionMSecs() const = 0;
-    virtual async::Channel<PlaybackStatus> playbackStatusChanged() const = 0;
+    virtual RtChannel<msecs_t> playbackPositionMSecs() const = 0;
+    virtual RtChannel<PlaybackStatus> playbackStatusChanged() const = 0;
 };
 using ISequencePlayerPtr = std::shared_ptr<ISequencePlayer>;
 }
@@ -40,8 +40,8 @@
 namespace mu::audio {
 class MidiAudioSource : public ITrackAudioInput, public async::Asyncable
 {
-    INJECT(audio, synth::ISynthResolver, synthResolver)
-    INJECT(audio, midi::IMidiOutPort, midiOutPort)
+    INJECT_PINNED(audio, synth::ISynthResolver, synthResolver)
+    INJECT_PINNED(audio, midi::IMidiOutPort, midiOutPort)
 
 public:
     explicit MidiAudioSource(const TrackId trackId, const midi::MidiData& midiData);
@@ -29,12 +29,13 @@
 #include "ifxresolver.h"
 #include "ifxprocessor.h"
 #include "track.h"
+#include "audiosignalsnotifier.h"
 #include "internal/dsp/compressor.h"
 
 namespace mu::audio {
 class MixerChannel : public ITrackAudioOutput, public async::Asyncable
 {
-    INJECT(audio, fx::IFxResolver, fxResolver)
+    INJECT_PINNED(audio, fx::IFxResolver, fxResolver)
 
 public:
     explicit MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate);
@@ -185,11 +185,14 @@ void PlayerHandler::ensureSubscriptions(const ITrackSequencePtr s) const
 
     TrackSequenceId sequenceId = s->id();
 
-    s->player()->playbackPositionMSecs().onReceive(this, [this, sequenceId](const msecs_t newPosMsecs) {
-        m_playbackPositionMsecsChanged.send(sequenceId, newPosMsecs);
+    //! NOTE The realtime channels are received on the main thread
+    async::Channel<TrackSequenceId, msecs_t> positionChanged = m_playbackPositionMsecsChanged;
+    s->player()->playbackPositionMSecs().onReceive([positionChanged, sequenceId](const msecs_t newPosMsecs) mutable {
+        positionChanged.send(sequenceId, newPosMsecs);
     });
 
-    s->player()->playbackStatusChanged().onReceive(this, [this, sequenceId](const PlaybackStatus newStatus) {
-        m_playbackStatusChanged.send(sequenceId, newStatus);
+    async::Channel<TrackSequenceId, PlaybackStatus> statusChanged = m_playbackStatusChanged;
+    s->player()->playbackStatusChanged().onReceive([statusChanged, sequenceId](const PlaybackStatus newStatus) mutable {
+        statusChanged.send(sequenceId, newStatus);
     });
 }
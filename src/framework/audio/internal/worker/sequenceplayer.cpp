@@ -116,14 +116,14 @@ void SequencePlayer::resetLoop()
     m_clock->resetTimeLoop();
 }
 
-Channel<msecs_t> SequencePlayer::playbackPositionMSecs() const
+RtChannel<msecs_t> SequencePlayer::playbackPositionMSecs() const
 {
     ONLY_AUDIO_WORKER_THREAD;
 
     return m_clock->timeChanged();
 }
 
-Channel<PlaybackStatus> SequencePlayer::playbackStatusChanged() const
+RtChannel<PlaybackStatus> SequencePlayer::playbackStatusChanged() const
 {
     ONLY_AUDIO_WORKER_THREAD;
 
@@ -45,8 +45,8 @@ public:
     Ret setLoop(const msecs_t fromMsec, const msecs_t toMsec) override;
     void resetLoop() override;
 
-    async::Channel<msecs_t> playbackPositionMSecs() const override;
-    async::Channel<PlaybackStatus> playbackStatusChanged() const override;
+    RtChannel<msecs_t> playbackPositionMSecs() const override;
+    RtChannel<PlaybackStatus> playbackStatusChanged() const override;
 
 private:
     TracksMap tracks() const;
@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "internal/audiosanitizer.h"
+#include "internal/worker/clock.h"
+#include "internal/worker/mixer.h"
+#include "internal/worker/sinesource.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+//! NOTE Counts the heap allocations of this thread, while the tracking is enabled
+static thread_local bool s_isAllocationTrackingEnabled = false;
+static thread_local size_t s_allocationsCount = 0;
+
+void* operator new(std::size_t size)
+{
+    if (s_isAllocationTrackingEnabled) {
+        ++s_allocationsCount;
+    }
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+class MixerTests : public ::testing::Test
+{
+protected:
+    static constexpr unsigned int SAMPLE_RATE = 48000;
+    static constexpr audioch_t AUDIO_CHANNELS_COUNT = 2;
+    static constexpr samples_t SAMPLES_PER_CHANNEL = 1024;
+
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+
+        m_mixer = std::make_shared<Mixer>();
+        m_mixer->setAudioChannelsCount(AUDIO_CHANNELS_COUNT);
+
+        for (TrackId trackId = 0; trackId < 8; ++trackId) {
+            m_mixer->addChannel(trackId, std::make_shared<SineSource>());
+        }
+
+        m_mixer->setSampleRate(SAMPLE_RATE);
+
+        m_clock = std::make_shared<Clock>();
+        m_clock->setTimeDuration(60 * 60 * 1000);
+        m_clock->start();
+        m_mixer->addClock(m_clock);
+
+        m_buffer.resize(SAMPLES_PER_CHANNEL * AUDIO_CHANNELS_COUNT);
+    }
+
+    void TearDown() override
+    {
+        m_mixer->removeClock(m_clock);
+    }
+
+    size_t process(int blocksCount)
+    {
+        s_allocationsCount = 0;
+        s_isAllocationTrackingEnabled = true;
+
+        for (int i = 0; i < blocksCount; ++i) {
+            m_mixer->process(m_buffer.data(), SAMPLES_PER_CHANNEL);
+        }
+
+        s_isAllocationTrackingEnabled = false;
+        return s_allocationsCount;
+    }
+
+    std::shared_ptr<Mixer> m_mixer;
+    std::shared_ptr<Clock> m_clock;
+    std::vector<float> m_buffer;
+};
+
+TEST_F(MixerTests, Process_NoHeapAllocations)
+{
+    //! GIVEN Mixer with a few channels and a running clock,
+    //! the first block resizes the mix buffer
+    process(1);
+
+    //! DO Process many blocks, the meters and the clock send their messages on every block
+    size_t allocationsCount = process(1000);
+
+    //! CHECK Nothing is allocated on the heap
+    EXPECT_EQ(allocationsCount, size_t(0));
+}
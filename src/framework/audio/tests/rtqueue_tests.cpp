@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "internal/rtqueue.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+class RtQueueTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(RtQueueTests, PushPop_Fifo)
+{
+    //! GIVEN Empty queue
+    RtQueue<int, 8> queue;
+    EXPECT_TRUE(queue.empty());
+
+    //! DO Push a few messages
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(queue.push(i));
+    }
+
+    //! CHECK They are popped in the same order
+    int message = -1;
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(queue.pop(message));
+        EXPECT_EQ(message, i);
+    }
+
+    EXPECT_FALSE(queue.pop(message));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(RtQueueTests, Push_Full)
+{
+    //! GIVEN Queue with the capacity 4, so 3 messages can be stored
+    RtQueue<int, 4> queue;
+
+    //! DO Push more messages than it can store
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    EXPECT_TRUE(queue.push(3));
+
+    //! CHECK The extra message is dropped
+    EXPECT_FALSE(queue.push(4));
+
+    //! DO Pop one message
+    int message = 0;
+    EXPECT_TRUE(queue.pop(message));
+    EXPECT_EQ(message, 1);
+
+    //! CHECK The queue wraps around
+    EXPECT_TRUE(queue.push(5));
+
+    std::vector<int> rest;
+    while (queue.pop(message)) {
+        rest.push_back(message);
+    }
+
+    EXPECT_EQ(rest, std::vector<int>({ 2, 3, 5 }));
+}
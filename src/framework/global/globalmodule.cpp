@@ -140,6 +140,7 @@ void GlobalModule::onInit(const IApplication::RunMode&)
         pr->reg("appDataPath", s_globalConf->appDataPath());
         pr->reg("appConfigPath", s_globalConf->appConfigPath());
         pr->reg("userAppDataPath", s_globalConf->userAppDataPath());
+        pr->reg("userCachePath", s_globalConf->userCachePath());
         pr->reg("userBackupPath", s_globalConf->userBackupPath());
         pr->reg("userDataPath", s_globalConf->userDataPath());
         pr->reg("log file", logFile->filePath());
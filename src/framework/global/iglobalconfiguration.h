@@ -52,6 +52,10 @@ public:
     //! Like: user/appdata/MuseScore
     virtual io::path userAppDataPath() const = 0;
 
+    //! NOTE The path to the dir with the user cache files, they can be removed at any time (must be writable, private for a user)
+    //! Like: user/cache/MuseScore
+    virtual io::path userCachePath() const = 0;
+
     //! NOTE The path to the dir with the user backup files (must be writable, probably private for a user)
     //! Like: user/appdata/MuseScore/backups
     virtual io::path userBackupPath() const = 0;
@@ -95,6 +95,26 @@ QString GlobalConfiguration::resolveUserAppDataPath() const
 #endif
 }
 
+io::path GlobalConfiguration::userCachePath() const
+{
+    if (m_userCachePath.empty()) {
+        m_userCachePath = resolveUserCachePath();
+    }
+    return m_userCachePath;
+}
+
+QString GlobalConfiguration::resolveUserCachePath() const
+{
+#if defined(WIN_PORTABLE)
+    return QDir::cleanPath(QString("%1/../../../Data/cache")
+                           .arg(QCoreApplication::applicationDirPath()));
+#elif defined(Q_OS_WASM)
+    return QString("/files/cache");
+#else
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+#endif
+}
+
 io::path GlobalConfiguration::userBackupPath() const
 {
     return settings()->value(BACKUP_KEY).toString();
@@ -36,6 +36,7 @@ public:
     io::path appConfigPath() const override;
 
     io::path userAppDataPath() const override;
+    io::path userCachePath() const override;
     io::path userBackupPath() const override;
     io::path userDataPath() const override;
 
@@ -47,9 +48,11 @@ public:
 private:
     QString resolveAppDataPath() const;
     QString resolveUserAppDataPath() const;
+    QString resolveUserCachePath() const;
 
     mutable io::path m_appDataPath;
     mutable io::path m_userAppDataPath;
+    mutable io::path m_userCachePath;
 };
 }
 
@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_FRAMEWORK_LAZYINIT_H
+#define MU_FRAMEWORK_LAZYINIT_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "startuptracer.h"
+
+namespace mu {
+/*!
+ * mu::LazyInit
+ * Deferred initialization of an expensive service, it is done on the first use instead of on the module init,
+ * so the modes which don't use the service (like the converter) don't pay for it.
+ * usage:
+ *      LazyInit m_lazyInit { "InstrumentsRepository", [this]() { load(); } };
+ *      ...
+ *      const Data& data() const { m_lazyInit.ensure(); return m_data; }
+ *
+ * Can be called from any thread. The call from the initialization itself (directly or indirectly) does nothing.
+ */
+class LazyInit
+{
+public:
+    LazyInit(const std::string& name, const std::function<void()>& init)
+        : m_name(name), m_init(init) {}
+
+    void ensure() const
+    {
+        if (m_done.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        if (m_done.load(std::memory_order_relaxed) || m_running) {
+            return;
+        }
+
+        m_running = true;
+        StartupTracer::instance()->trace(m_name, "lazyInit", m_init);
+        m_running = false;
+
+        m_done.store(true, std::memory_order_release);
+    }
+
+    bool isDone() const
+    {
+        return m_done.load(std::memory_order_acquire);
+    }
+
+private:
+    std::string m_name;
+    std::function<void()> m_init;
+
+    mutable std::recursive_mutex m_mutex;
+    mutable bool m_running = false;
+    mutable std::atomic<bool> m_done = false;
+};
+}
+
+#endif // MU_FRAMEWORK_LAZYINIT_H
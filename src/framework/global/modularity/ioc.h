@@ -48,6 +48,15 @@ public: \
         return _static##getter; \
     } \
 
+//! NOTE For the hot paths (layout, paint, audio processing).
+//! Returns a raw pointer to the service pinned in its typed slot (see PinnedService),
+//! the service can't be replaced per object, mocks are registered in the ioc
+#define INJECT_PINNED(Module, Interface, getter) \
+public: \
+    static Interface* getter() {  \
+        return mu::modularity::PinnedService<Interface>::get(#Module); \
+    } \
+
 namespace mu::modularity {
 inline ModulesIoC* ioc()
 {
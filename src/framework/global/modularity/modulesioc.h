@@ -23,14 +23,20 @@
 #ifndef MU_MODULARITY_MODULESIOC_H
 #define MU_MODULARITY_MODULESIOC_H
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
 #include <cassert>
 #include <iostream>
 #include "imoduleexport.h"
 
 namespace mu::modularity {
+template<class I>
+class PinnedService;
+
 class ModulesIoC
 {
 public:
@@ -117,8 +123,40 @@ public:
 #endif
     }
 
+    //! NOTE See PinnedService
+    template<class I>
+    I* pin(const std::string& module)
+    {
+        std::shared_ptr<I> p = resolve<I>(module);
+        if (!p) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(m_pinMutex);
+        if (I* pinned = PinnedService<I>::s_ptr.load(std::memory_order_acquire)) {
+            return pinned;
+        }
+
+        PinnedService<I>::s_pinned = p;
+        PinnedService<I>::s_ptr.store(p.get(), std::memory_order_release);
+        m_unpins[I::interfaceId()] = []() {
+            PinnedService<I>::s_ptr.store(nullptr, std::memory_order_release);
+            PinnedService<I>::s_pinned = nullptr;
+        };
+
+        return p.get();
+    }
+
     void reset()
     {
+        {
+            std::lock_guard<std::mutex> lock(m_pinMutex);
+            for (auto& unpin : m_unpins) {
+                unpin.second();
+            }
+            m_unpins.clear();
+        }
+
         m_map.clear();
     }
 
@@ -128,6 +166,15 @@ private:
 
     void unregisterService(const std::string& id)
     {
+        {
+            std::lock_guard<std::mutex> lock(m_pinMutex);
+            auto it = m_unpins.find(id);
+            if (it != m_unpins.end()) {
+                it->second();
+                m_unpins.erase(it);
+            }
+        }
+
         m_map.erase(id);
     }
 
@@ -177,6 +224,31 @@ private:
     };
 
     std::map<std::string, Service > m_map;
+
+    std::mutex m_pinMutex;
+    std::map<std::string, std::function<void()> > m_unpins;
+};
+
+//! NOTE Typed slot of a service for the hot paths (see INJECT_PINNED).
+//! The first get() resolves the service and pins it in the slot,
+//! the next ones only load the raw pointer, without the map lookup and the refcounting.
+//! The service is unpinned when it is unregistered or the ioc is reset,
+//! so it must be registered as an instance, not with a creator.
+template<class I>
+class PinnedService
+{
+public:
+    static I* get(const char* module)
+    {
+        I* p = s_ptr.load(std::memory_order_acquire);
+        return p ? p : ModulesIoC::instance()->pin<I>(module);
+    }
+
+private:
+    friend class ModulesIoC;
+
+    static inline std::atomic<I*> s_ptr { nullptr };
+    static inline std::shared_ptr<I> s_pinned;
 };
 
 template<class T>
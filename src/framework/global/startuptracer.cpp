@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "startuptracer.h"
+
+#include <algorithm>
+#include <map>
+
+#include "log.h"
+
+using namespace mu;
+
+static const std::string MARK_STAGE("mark");
+
+//! NOTE Steps cheaper than this are not printed one by one, only in the stage totals
+static constexpr double MIN_PRINTED_DURATION_MS = 1.0;
+
+StartupTracer* StartupTracer::instance()
+{
+    static StartupTracer t;
+    return &t;
+}
+
+StartupTracer::StartupTracer()
+    : m_start(Clock::now())
+{
+}
+
+double StartupTracer::elapsedMs() const
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - m_start).count();
+}
+
+void StartupTracer::addRecord(const std::string& name, const std::string& stage, double startMs, double durationMs)
+{
+    std::lock_guard lock(m_mutex);
+    m_records.push_back({ name, stage, startMs, durationMs });
+}
+
+void StartupTracer::mark(const std::string& name)
+{
+    addRecord(name, MARK_STAGE, elapsedMs(), 0.0);
+}
+
+std::vector<StartupTracer::Record> StartupTracer::records() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_records;
+}
+
+void StartupTracer::print() const
+{
+    std::vector<Record> records = this->records();
+
+    std::vector<std::string> stages;
+    std::map<std::string, double> stageTotals;
+    std::vector<Record> steps;
+
+    for (const Record& r : records) {
+        if (r.stage == MARK_STAGE) {
+            continue;
+        }
+
+        if (stageTotals.find(r.stage) == stageTotals.end()) {
+            stages.push_back(r.stage);
+        }
+        stageTotals[r.stage] += r.durationMs;
+
+        if (r.durationMs >= MIN_PRINTED_DURATION_MS) {
+            steps.push_back(r);
+        }
+    }
+
+    std::sort(steps.begin(), steps.end(), [](const Record& r1, const Record& r2) {
+        return r1.durationMs > r2.durationMs;
+    });
+
+    LOGI() << "startup trace, elapsed: " << elapsedMs() << " ms";
+
+    for (const std::string& stage : stages) {
+        LOGI() << "  stage " << stage << ": " << stageTotals[stage] << " ms";
+    }
+
+    for (const Record& r : steps) {
+        LOGI() << "  " << r.name << "::" << r.stage << ": " << r.durationMs << " ms";
+    }
+
+    for (const Record& r : records) {
+        if (r.stage == MARK_STAGE) {
+            LOGI() << "  [" << r.startMs << " ms] " << r.name;
+        }
+    }
+}
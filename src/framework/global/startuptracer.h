@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_FRAMEWORK_STARTUPTRACER_H
+#define MU_FRAMEWORK_STARTUPTRACER_H
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mu {
+//! NOTE Records the cost of the application startup steps:
+//! the setup stages of each module (registerExports, onInit...),
+//! the lazy initializations of services (see LazyInit)
+//! and the marks of the main startup points (like "main qml loaded").
+//! The time is counted from the creation of the tracer, that is, from the application start.
+class StartupTracer
+{
+public:
+    static StartupTracer* instance();
+
+    struct Record {
+        std::string name;
+        std::string stage;
+        double startMs = 0.0;
+        double durationMs = 0.0;
+    };
+
+    template<typename Func>
+    void trace(const std::string& name, const std::string& stage, Func func)
+    {
+        const double start = elapsedMs();
+        func();
+        addRecord(name, stage, start, elapsedMs() - start);
+    }
+
+    void addRecord(const std::string& name, const std::string& stage, double startMs, double durationMs);
+    void mark(const std::string& name);
+
+    double elapsedMs() const;
+    std::vector<Record> records() const;
+
+    //! NOTE Prints the total time of the stages, the most expensive steps and the marks
+    void print() const;
+
+private:
+    StartupTracer();
+
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point m_start;
+
+    mutable std::mutex m_mutex;
+    std::vector<Record> m_records;
+};
+}
+
+#endif // MU_FRAMEWORK_STARTUPTRACER_H
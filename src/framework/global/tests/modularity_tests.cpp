@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "modularity/ioc.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::modularity;
+
+namespace mu {
+class IModularityTestService : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IModularityTestService)
+
+public:
+    virtual ~IModularityTestService() = default;
+
+    virtual int value() const = 0;
+};
+
+class ModularityTestService : public IModularityTestService
+{
+public:
+    int value() const override { return 1; }
+};
+
+class InjectClient
+{
+    INJECT(global, IModularityTestService, service)
+};
+
+class InjectStaticClient
+{
+    INJECT_STATIC(global, IModularityTestService, service)
+};
+
+class InjectPinnedClient
+{
+    INJECT_PINNED(global, IModularityTestService, service)
+};
+
+class ModularityTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_service = std::make_shared<ModularityTestService>();
+        ioc()->registerExport<IModularityTestService>("global", m_service);
+    }
+
+    void TearDown() override
+    {
+        ioc()->unregisterExport<IModularityTestService>("global");
+    }
+
+protected:
+    std::shared_ptr<ModularityTestService> m_service;
+};
+
+TEST_F(ModularityTests, InjectPinned)
+{
+    //! DO Get the service
+    IModularityTestService* service = InjectPinnedClient::service();
+
+    //! CHECK It is the registered one, and it's pinned (one more reference)
+    EXPECT_EQ(service, m_service.get());
+    EXPECT_EQ(m_service.use_count(), 3);
+
+    //! DO Unregister the service
+    ioc()->unregisterExport<IModularityTestService>("global");
+
+    //! CHECK It is unpinned
+    EXPECT_EQ(InjectPinnedClient::service(), nullptr);
+    EXPECT_EQ(m_service.use_count(), 1);
+
+    //! DO Register another service
+    auto other = std::make_shared<ModularityTestService>();
+    ioc()->registerExport<IModularityTestService>("global", other);
+
+    //! CHECK The other one is pinned
+    EXPECT_EQ(InjectPinnedClient::service(), other.get());
+}
+
+template<typename Func>
+static double nsPerCall(int threads, int calls, const Func& func)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([calls, &func]() {
+            int sum = 0;
+            for (int i = 0; i < calls; ++i) {
+                sum += func();
+            }
+            EXPECT_EQ(sum, calls);
+        });
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / calls;
+}
+
+TEST_F(ModularityTests, DISABLED_InjectBenchmark)
+{
+    //! GIVEN Clients with the different injections
+    InjectClient injectClient;
+    InjectStaticClient injectStaticClient;
+    InjectPinnedClient injectPinnedClient;
+
+    const int calls = 10000000;
+
+    for (int threads : { 1, 4 }) {
+        //! DO Call the service through each of them, from one and from several threads
+        double inject = nsPerCall(threads, calls, [&injectClient]() { return injectClient.service()->value(); });
+        double injectStatic = nsPerCall(threads, calls, [&injectStaticClient]() { return injectStaticClient.service()->value(); });
+        double injectPinned = nsPerCall(threads, calls, [&injectPinnedClient]() { return injectPinnedClient.service()->value(); });
+
+        //! CHECK Print the results
+        LOGI() << "threads: " << threads << ", ns per call: INJECT " << inject << ", INJECT_STATIC " << injectStatic
+               << ", INJECT_PINNED " << injectPinned;
+    }
+}
+}
@@ -146,10 +146,13 @@ void UiModule::registerUiTypes()
     modularity::ioc()->resolve<ui::IUiEngine>(moduleName())->addSourceImportPath(ui_QML_IMPORT);
 }
 
-void UiModule::onInit(const framework::IApplication::RunMode&)
+void UiModule::onInit(const framework::IApplication::RunMode& mode)
 {
     s_configuration->init();
-    s_keyNavigationController->init();
+
+    if (framework::IApplication::RunMode::Editor == mode) {
+        s_keyNavigationController->init();
+    }
 }
 
 void UiModule::onAllInited(const framework::IApplication::RunMode& mode)
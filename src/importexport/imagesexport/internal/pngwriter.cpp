@@ -67,6 +67,7 @@ mu::Ret PngWriter::write(INotationPtr notation, Device& destinationDevice, const
     opt.toPage = opt.fromPage;
     opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
     opt.deviceDpi = CANVAS_DPI;
+    opt.isPrintingStarted = options.value(OptionKey::UNITS_PREPARED, Val(false)).toBool();
 
     notation->painting()->paintPng(&painter, opt);
 
@@ -74,3 +75,13 @@ mu::Ret PngWriter::write(INotationPtr notation, Device& destinationDevice, const
 
     return true;
 }
+
+void PngWriter::prepareUnits(INotationPtr notation, const Options&)
+{
+    notation->painting()->beginPrinting(configuration()->exportPngDpiResolution());
+}
+
+void PngWriter::finishUnits(INotationPtr notation)
+{
+    notation->painting()->endPrinting();
+}
@@ -36,6 +36,9 @@ class PngWriter : public AbstractImageWriter
 public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, io::Device& destinationDevice, const Options& options = Options()) override;
+
+    void prepareUnits(notation::INotationPtr notation, const Options& options) override;
+    void finishUnits(notation::INotationPtr notation) override;
 };
 }
 
@@ -30,6 +30,7 @@
 #include "libmscore/staff.h"
 #include "libmscore/measure.h"
 #include "libmscore/stafflines.h"
+#include "libmscore/note.h"
 #include "engraving/paint/paint.h"
 
 #include "log.h"
@@ -39,6 +40,29 @@ using namespace mu::project;
 using namespace mu::notation;
 using namespace mu::io;
 
+//! NOTE The paint state of the score is global,
+//! when the pages are written from several threads it is set once by prepareUnits()
+static double beginPrinting(Ms::Score* score)
+{
+    double pixelRatioBackup = Ms::MScore::pixelRatio;
+
+    score->setPrinting(true); // don’t print page break symbols etc.
+
+    Ms::MScore::pdfPrinting = true;
+    Ms::MScore::svgPrinting = true;
+    Ms::MScore::pixelRatio = Ms::DPI / SvgGenerator().logicalDpiX();
+
+    return pixelRatioBackup;
+}
+
+static void endPrinting(Ms::Score* score, double pixelRatioBackup)
+{
+    Ms::MScore::pixelRatio = pixelRatioBackup;
+    score->setPrinting(false);
+    Ms::MScore::pdfPrinting = false;
+    Ms::MScore::svgPrinting = false;
+}
+
 std::vector<INotationWriter::UnitType> SvgWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PAGE };
@@ -55,13 +79,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
         return make_ret(Ret::Code::UnknownError);
     }
 
-    score->setPrinting(true); // don’t print page break symbols etc.
-
-    Ms::MScore::pdfPrinting = true;
-    Ms::MScore::svgPrinting = true;
-
     const QList<Ms::Page*>& pages = score->pages();
-    double pixelRationBackup = Ms::MScore::pixelRatio;
 
     const int PAGE_NUMBER = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
     if (PAGE_NUMBER < 0 || PAGE_NUMBER >= pages.size()) {
@@ -75,6 +93,12 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
     printer.setTitle(pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(PAGE_NUMBER + 1) : title);
     printer.setOutputDevice(&destinationDevice);
 
+    const bool isUnitsPrepared = options.value(OptionKey::UNITS_PREPARED, Val(false)).toBool();
+    double pixelRatioBackup = 0.0;
+    if (!isUnitsPrepared) {
+        pixelRatioBackup = beginPrinting(score);
+    }
+
     const int TRIM_MARGIN_SIZE = configuration()->trimMarginPixelSize();
 
     RectF pageRect = page->abbox();
@@ -93,8 +117,6 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
         painter.translate(-pageRect.topLeft());
     }
 
-    Ms::MScore::pixelRatio = Ms::DPI / printer.logicalDpiX();
-
     if (!options[OptionKey::TRANSPARENT_BACKGROUND].toBool()) {
         painter.fillRect(pageRect, mu::draw::Color::white);
     }
@@ -146,19 +168,24 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
                     }
                 }
             } else {   // Draw staff lines once per system
-                Ms::StaffLines* firstSL = system->firstMeasure()->staffLines(staffIndex)->clone();
-                Ms::StaffLines* lastSL =  system->lastMeasure()->staffLines(staffIndex);
+                //! NOTE The pages can be written from several threads,
+                //! so the extended lines are painted without changing the score
+                const Ms::StaffLines* firstSL = system->firstMeasure()->staffLines(staffIndex);
+                const Ms::StaffLines* lastSL =  system->lastMeasure()->staffLines(staffIndex);
 
                 qreal lastX =  lastSL->bbox().right()
                               + lastSL->pagePos().x()
                               - firstSL->pagePos().x();
-                std::vector<mu::LineF>& lines = firstSL->getLines();
+                std::vector<mu::LineF> lines = firstSL->getLines();
                 for (size_t l = 0, c = lines.size(); l < c; l++) {
                     lines[l].setP2(mu::PointF(lastX, lines[l].p2().y()));
                 }
 
                 printer.setElement(firstSL);
-                engraving::Paint::paintElement(painter, firstSL);
+                mu::PointF firstSLPos = firstSL->pagePos();
+                painter.translate(firstSLPos);
+                firstSL->drawLines(&painter, lines);
+                painter.translate(-firstSLPos);
             }
         }
     }
@@ -205,10 +232,14 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
                 color = notesColors[currentNoteIndex];
             }
 
-            Ms::EngravingItem* note = dynamic_cast<const Ms::Note*>(element)->clone();
-            note->setColor(color);
-            engraving::Paint::paintElement(painter, note);
-            delete note;
+            //! NOTE Painted with the color, without changing the note, see the staff lines above
+            const Ms::Note* note = Ms::toNote(element);
+            if (!note->skipDraw()) {
+                mu::PointF notePos = note->pagePos();
+                painter.translate(notePos);
+                note->drawWithColor(&painter, mu::draw::Color::fromQColor(color));
+                painter.translate(-notePos);
+            }
         } else {
             engraving::Paint::paintElement(painter, element);
         }
@@ -216,11 +247,9 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
 
     painter.endDraw(); // Writes MuseScore SVG file to disk, finally
 
-    // Clean up and return
-    Ms::MScore::pixelRatio = pixelRationBackup;
-    score->setPrinting(false);
-    Ms::MScore::pdfPrinting = false;
-    Ms::MScore::svgPrinting = false;
+    if (!isUnitsPrepared) {
+        endPrinting(score, pixelRatioBackup);
+    }
 
     return true;
 }
@@ -236,3 +265,13 @@ SvgWriter::NotesColors SvgWriter::parseNotesColors(const QVariant& obj) const
 
     return result;
 }
+
+void SvgWriter::prepareUnits(INotationPtr notation, const Options&)
+{
+    m_pixelRatioBeforeUnits = beginPrinting(notation->elements()->msScore());
+}
+
+void SvgWriter::finishUnits(INotationPtr notation)
+{
+    endPrinting(notation->elements()->msScore(), m_pixelRatioBeforeUnits);
+}
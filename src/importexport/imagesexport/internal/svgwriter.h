@@ -37,10 +37,15 @@ public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, io::Device& destinationDevice, const Options& options = Options()) override;
 
+    void prepareUnits(notation::INotationPtr notation, const Options& options) override;
+    void finishUnits(notation::INotationPtr notation) override;
+
 private:
     using NotesColors = QHash<int /* noteIndex */, QColor>;
 
     NotesColors parseNotesColors(const QVariant& obj) const;
+
+    double m_pixelRatioBeforeUnits = 0.0;
 };
 }
 
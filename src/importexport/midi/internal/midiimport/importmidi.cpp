@@ -235,23 +235,27 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
 {
     auto& opers = midiImportOperations;
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
-        if (mtrack.chords.empty()) {
-            continue;
-        }
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
-
-        if (opers.data()->processingsOfOpenedFile == 0) {
+    // import operations are shared between the tracks, so they are changed
+    // before the concurrent processing that only reads them
+    if (opers.data()->processingsOfOpenedFile == 0) {
+        for (const auto& track: tracks) {
+            const MTrack& mtrack = track.second;
+            if (mtrack.chords.empty()) {
+                continue;
+            }
             opers.data()->trackOpers.isDrumTrack.setValue(
-                opers.currentTrack(), mtrack.mtrack->drumTrack());
+                mtrack.indexOfOperation, mtrack.mtrack->drumTrack());
             if (mtrack.mtrack->drumTrack()) {
                 opers.data()->trackOpers.maxVoiceCount.setValue(
-                    opers.currentTrack(), MidiOperations::VoiceCount::V_1);
+                    mtrack.indexOfOperation, MidiOperations::VoiceCount::V_1);
             }
         }
+    }
+
+    processTracksConcurrently(tracks, [&](MTrack& mtrack) {
+        if (mtrack.chords.empty()) {
+            return;
+        }
         const auto basicQuant = Quantize::quantValueToFraction(
             opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
 #ifdef QT_DEBUG
@@ -266,7 +270,7 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
             MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
         }
 #ifdef QT_DEBUG
-        Q_ASSERT_X(!doNotesOverlap(track.second),
+        Q_ASSERT_X(!doNotesOverlap(mtrack),
                    "quantizeAllTracks",
                    "There are overlapping notes of the same voice that is incorrect");
 #endif
@@ -280,7 +284,7 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
                    "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
                                         "or non-tuplet chord/note is inside tuplet");
 #endif
-    }
+    });
 }
 
 //---------------------------------------------------------
@@ -22,6 +22,7 @@
 #include "importmidi_inner.h"
 
 #include <QTextCodec>
+#include <QtConcurrent>
 
 #include "importmidi_operations.h"
 #include "importmidi_chord.h"
@@ -278,6 +279,28 @@ std::string fromUchar(const uchar* text)
 }
 } // namespace MidiCharset
 
+void processTracksConcurrently(std::multimap<int, MTrack>& tracks, const std::function<void(MTrack&)>& func)
+{
+    if (QThreadPool::globalInstance()->maxThreadCount() <= 1) {
+        for (auto& track: tracks) {
+            MidiOperations::CurrentTrackSetter setCurrentTrack{ midiImportOperations, track.second.indexOfOperation };
+            func(track.second);
+        }
+        return;
+    }
+
+    std::vector<MTrack*> trackList;
+    trackList.reserve(tracks.size());
+    for (auto& track: tracks) {
+        trackList.push_back(&track.second);
+    }
+
+    QtConcurrent::blockingMap(trackList, [&func](MTrack* mtrack) {
+        MidiOperations::CurrentTrackSetter setCurrentTrack{ midiImportOperations, mtrack->indexOfOperation };
+        func(*mtrack);
+    });
+}
+
 namespace MidiBar {
 ReducedFraction findBarStart(const ReducedFraction& time, const TimeSigMap* sigmap)
 {
@@ -29,6 +29,8 @@
 
 #include <vector>
 #include <cstddef>
+#include <functional>
+#include <map>
 #include <utility>
 
 // ---------------------------------------------------------------------------------------
@@ -120,6 +122,12 @@ private:
     void updateTuplet(std::multimap<ReducedFraction, MidiTuplet::TupletData>::iterator&);
 };
 
+// run func for every track on the global thread pool and wait for the end
+// (one track after another if the pool has only one thread);
+// the current track of the import operations is set to the processed track,
+// func should change only this track and only read the shared data (time signatures, operations)
+void processTracksConcurrently(std::multimap<int, MTrack>& tracks, const std::function<void(MTrack&)>& func);
+
 namespace MidiTuplet {
 struct TupletInfo
 {
@@ -167,6 +167,8 @@ const InstrumentTemplate* findInstrument(const QString& groupId, const QString&
 {
     const InstrumentTemplate* instr = nullptr;
 
+    ensureInstrumentTemplatesLoaded();
+
     for (const InstrumentGroup* group: qAsConst(instrumentGroups)) {
         if (group->id == groupId) {
             for (const InstrumentTemplate* templ: group->instrumentTemplates) {
@@ -188,6 +190,8 @@ const InstrumentTemplate* findClosestInstrument(const MTrack& track)
     int maxLessProgram = -1;
     const InstrumentTemplate* closestTemplate = nullptr;
 
+    ensureInstrumentTemplatesLoaded();
+
     for (const InstrumentGroup* group: qAsConst(instrumentGroups)) {
         for (const InstrumentTemplate* templ: group->instrumentTemplates) {
             if (templ->staffGroup == StaffGroup::TAB) {
@@ -220,6 +224,8 @@ std::vector<const InstrumentTemplate*> findInstrumentsForProgram(const MTrack& t
         trackPitches = findAllPitches(track);
     }
 
+    ensureInstrumentTemplatesLoaded();
+
     for (const InstrumentGroup* group: qAsConst(instrumentGroups)) {
         for (const InstrumentTemplate* templ: group->instrumentTemplates) {
             if (templ->staffGroup == StaffGroup::TAB) {
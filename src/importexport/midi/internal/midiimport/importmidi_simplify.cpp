@@ -283,18 +283,16 @@ void simplifyDurations(
 {
     auto& opers = midiImportOperations;
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
+    processTracksConcurrently(tracks, [&](MTrack& mtrack) {
         if (mtrack.mtrack->drumTrack() != simplifyDrumTracks) {
-            continue;
+            return;
         }
-        auto& chords = track.second.chords;
+        auto& chords = mtrack.chords;
         if (chords.empty()) {
-            continue;
+            return;
         }
 
         if (opers.data()->trackOpers.simplifyDurations.value(mtrack.indexOfOperation)) {
-            MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
 #ifdef QT_DEBUG
             Q_ASSERT_X(MidiTuplet::areTupletRangesOk(chords, mtrack.tuplets),
                        "Simplify::simplifyDurations", "Tuplet chord/note is outside tuplet "
@@ -310,7 +308,7 @@ void simplifyDurations(
                                                       "or non-tuplet chord/note is inside tuplet after simplification");
 #endif
         }
-    }
+    });
 }
 
 void simplifyDurationsForDrums(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
@@ -21,6 +21,8 @@
  */
 #include "importmidi_voice.h"
 
+#include <atomic>
+
 #include <QSet>
 
 #include "importmidi_tuplet.h"
@@ -1063,22 +1065,17 @@ void sortVoices(
 bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
 {
     auto& opers = midiImportOperations;
-    bool changed = false;
+    std::atomic<bool> changed(false);
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
+    processTracksConcurrently(tracks, [&](MTrack& mtrack) {
         if (mtrack.mtrack->drumTrack()) {
-            continue;
+            return;
         }
-        auto& chords = track.second.chords;
-        if (chords.empty()) {
-            continue;
+        if (mtrack.chords.empty()) {
+            return;
         }
         const int userVoiceCount = toIntVoiceCount(
             opers.data()->trackOpers.maxVoiceCount.value(mtrack.indexOfOperation));
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
 
         if (userVoiceCount > 1 && userVoiceCount <= voiceLimit()) {
 #ifdef QT_DEBUG
@@ -1113,7 +1110,7 @@ bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap
                                                     "after voice sort");
 #endif
         }
-    }
+    });
 
     return changed;
 }
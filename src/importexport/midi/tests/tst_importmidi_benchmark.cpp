@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include <QTemporaryDir>
+
+#include "testing/qtestsuite.h"
+
+#include "testbase.h"
+
+#include "engraving/compat/midi/midifile.h"
+#include "engraving/compat/scoreaccess.h"
+#include "libmscore/masterscore.h"
+
+#include "importexport/midi/internal/midiimport/importmidi_operations.h"
+
+namespace Ms {
+extern Score::FileError importMidi(MasterScore*, const QString&);
+}
+
+using namespace mu::engraving;
+using namespace Ms;
+
+//---------------------------------------------------------
+//   TestImportMidiBenchmark
+//    import of large generated multi-track files
+//---------------------------------------------------------
+
+class TestImportMidiBenchmark : public QObject, public MTest
+{
+    Q_OBJECT
+
+    QTemporaryDir m_dir;
+
+    QString generateMidiFile(int trackCount, int barCount);
+
+private slots:
+    void initTestCase();
+    void importLargeFile_data();
+    void importLargeFile();
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//---------------------------------------------------------
+
+void TestImportMidiBenchmark::initTestCase()
+{
+    initMTest(QString(iex_midi_tests_DATA_ROOT));
+    QVERIFY(m_dir.isValid());
+}
+
+//---------------------------------------------------------
+//   generateMidiFile
+//    every track has random notes of various durations in 4/4,
+//    with chords, overlaps and triplets, on its own channel
+//---------------------------------------------------------
+
+QString TestImportMidiBenchmark::generateMidiFile(int trackCount, int barCount)
+{
+    const int division = 480;
+    const int barLen = division * 4;
+    const int durations[] = { division / 4, division / 3, division / 2, division * 2 / 3, division, division * 2 };
+
+    std::mt19937 gen(trackCount * 1000 + barCount);
+    std::uniform_int_distribution<int> durationIndex(0, sizeof(durations) / sizeof(durations[0]) - 1);
+    std::uniform_int_distribution<int> chordSize(1, 3);
+    std::uniform_int_distribution<int> pitchOffset(-12, 12);
+    std::uniform_int_distribution<int> velocity(40, 110);
+
+    MidiFile mf;
+    mf.setFormat(1);
+    mf.setDivision(division);
+
+    for (int i = 0; i < trackCount; ++i) {
+        MidiTrack track;
+        const int channel = i % 16 == 9 ? 0 : i % 16;
+        track.setOutChannel(channel);
+
+        const int basePitch = 48 + (i * 7) % 24;
+        for (int tick = 0; tick < barCount * barLen;) {
+            const int len = durations[durationIndex(gen)];
+            const int notes = chordSize(gen);
+            for (int n = 0; n < notes; ++n) {
+                const int pitch = basePitch + pitchOffset(gen);
+                track.insert(tick, MidiEvent(ME_NOTEON, channel, pitch, velocity(gen)));
+                track.insert(tick + len, MidiEvent(ME_NOTEOFF, channel, pitch, 0));
+            }
+            tick += len;
+        }
+        mf.tracks().push_back(track);
+    }
+
+    const QString path = m_dir.filePath(QString("generated_%1_%2.mid").arg(trackCount).arg(barCount));
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly) || !mf.write(&file)) {
+        return QString();
+    }
+
+    return path;
+}
+
+//---------------------------------------------------------
+//   importLargeFile
+//---------------------------------------------------------
+
+void TestImportMidiBenchmark::importLargeFile_data()
+{
+    QTest::addColumn<int>("trackCount");
+    QTest::addColumn<int>("barCount");
+
+    QTest::newRow("16 tracks") << 16 << 200;
+    QTest::newRow("64 tracks") << 64 << 200;
+}
+
+void TestImportMidiBenchmark::importLargeFile()
+{
+    QFETCH(int, trackCount);
+    QFETCH(int, barCount);
+
+    const QString path = generateMidiFile(trackCount, barCount);
+    QVERIFY(!path.isEmpty());
+
+    QBENCHMARK {
+        // the file data is cached by the import operations after the first import
+        midiImportOperations.excludeMidiFile(path);
+
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        QCOMPARE(importMidi(score, path), Score::FileError::FILE_NO_ERROR);
+        delete score;
+    }
+}
+
+QTEST_MAIN(TestImportMidiBenchmark)
+#include "tst_importmidi_benchmark.moc"
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <QDir>
+#include <QTemporaryDir>
+#include <QThreadPool>
+
+#include "testing/qtestsuite.h"
+
+#include "testbase.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "libmscore/masterscore.h"
+
+#include "importexport/midi/internal/midiimport/importmidi_operations.h"
+
+namespace Ms {
+extern Score::FileError importMidi(MasterScore*, const QString&);
+}
+
+using namespace mu::engraving;
+using namespace Ms;
+
+//---------------------------------------------------------
+//   TestImportMidiThreads
+//    the tracks are processed concurrently,
+//    the imported score should not depend on the thread count
+//---------------------------------------------------------
+
+class TestImportMidiThreads : public QObject, public MTest
+{
+    Q_OBJECT
+
+    QTemporaryDir m_dir;
+    int m_maxThreadCount = 0;
+
+    bool importAndSave(const QString& midiPath, int threadCount, const QString& savePath);
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void importWithThreads_data();
+    void importWithThreads();
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//---------------------------------------------------------
+
+void TestImportMidiThreads::initTestCase()
+{
+    initMTest(QString(iex_midi_tests_DATA_ROOT));
+    QVERIFY(m_dir.isValid());
+    m_maxThreadCount = QThreadPool::globalInstance()->maxThreadCount();
+}
+
+void TestImportMidiThreads::cleanupTestCase()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(m_maxThreadCount);
+}
+
+//---------------------------------------------------------
+//   importAndSave
+//---------------------------------------------------------
+
+bool TestImportMidiThreads::importAndSave(const QString& midiPath, int threadCount, const QString& savePath)
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(threadCount);
+
+    // the file data is cached by the import operations after the first import
+    midiImportOperations.excludeMidiFile(midiPath);
+
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+    score->setName(QFileInfo(midiPath).completeBaseName());
+    const bool ok = importMidi(score, midiPath) == Score::FileError::FILE_NO_ERROR
+                    && saveScore(score, savePath);
+    delete score;
+
+    return ok;
+}
+
+//---------------------------------------------------------
+//   importWithThreads
+//    import every test file with one thread and with several threads
+//---------------------------------------------------------
+
+void TestImportMidiThreads::importWithThreads_data()
+{
+    QTest::addColumn<QString>("midiPath");
+
+    const QDir dataDir(QString(iex_midi_tests_DATA_ROOT) + "/data");
+    const QStringList files = dataDir.entryList({ "*.mid" }, QDir::Files, QDir::Name);
+    QVERIFY(!files.isEmpty());
+
+    for (const QString& file : files) {
+        QTest::newRow(qPrintable(file)) << dataDir.filePath(file);
+    }
+}
+
+void TestImportMidiThreads::importWithThreads()
+{
+    QFETCH(QString, midiPath);
+
+    const QString name = QFileInfo(midiPath).completeBaseName();
+    const QString serialPath = m_dir.filePath(name + "_1.mscx");
+    const QString concurrentPath = m_dir.filePath(name + "_4.mscx");
+
+    QVERIFY(importAndSave(midiPath, 1, serialPath));
+    QVERIFY(importAndSave(midiPath, 4, concurrentPath));
+    QVERIFY(compareFilesFromPaths(concurrentPath, serialPath));
+}
+
+QTEST_MAIN(TestImportMidiThreads)
+#include "tst_importmidi_threads.moc"
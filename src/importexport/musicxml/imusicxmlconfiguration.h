@@ -39,6 +39,9 @@ public:
     virtual bool musicxmlImportLayout() const = 0;
     virtual void setMusicxmlImportLayout(bool value) = 0;
 
+    virtual bool musicxmlImportValidation() const = 0;
+    virtual void setMusicxmlImportValidation(bool value) = 0;
+
     virtual bool musicxmlExportLayout() const = 0;
     virtual void setMusicxmlExportLayout(bool value) = 0;
 
@@ -52,6 +55,9 @@ public:
     virtual bool musicxmlExportInvisibleElements() const = 0;
     virtual void setMusicxmlExportInvisibleElements(bool value) = 0;
 
+    virtual bool musicxmlExportParallelParts() const = 0;
+    virtual void setMusicxmlExportParallelParts(bool value) = 0;
+
     virtual bool needUseDefaultFont() const = 0;
     virtual void setNeedUseDefaultFont(bool value) = 0;
 
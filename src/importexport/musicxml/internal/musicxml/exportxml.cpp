@@ -43,6 +43,7 @@
 #include <QBuffer>
 #include <QDate>
 #include <QRegularExpression>
+#include <QtConcurrent>
 
 #include "thirdparty/qzip/qzipwriter_p.h"
 
@@ -51,7 +52,6 @@
 #include "engraving/types/typesconv.h"
 #include "engraving/types/symnames.h"
 
-#include "libmscore/factory.h"
 #include "libmscore/masterscore.h"
 #include "libmscore/rest.h"
 #include "libmscore/chord.h"
@@ -149,6 +149,8 @@ namespace Ms {
 
 typedef QMap<int, const FiguredBass*> FigBassMap;
 
+static const QString SCORE_PARTWISE("score-partwise version=\"3.1\"");
+
 //---------------------------------------------------------
 //   attributes -- prints <attributes> tag when necessary
 //---------------------------------------------------------
@@ -372,6 +374,7 @@ class ExportMusicXml
     void clef(int staff, const ClefType ct, const QString& extraAttributes = "");
     void timesig(TimeSig* tsig);
     void keysig(const KeySig* ks, ClefType ct, int staff = 0, bool visible = true);
+    void keysig(const KeySigEvent& kse, ClefType ct, int staff = 0, bool visible = true, const QString& color = QString());
     void barlineLeft(const Measure* const m);
     void barlineMiddle(const BarLine* bl);
     void barlineRight(const Measure* const m, const int strack, const int etrack);
@@ -396,7 +399,11 @@ class ExportMusicXml
                       const MeasurePrintContext& mpc, QSet<const Spanner*>& spannersStopped);
     void repeatAtMeasureStart(Attributes& attr, const Measure* const m, int strack, int etrack, int track);
     void repeatAtMeasureStop(const Measure* const m, int strack, int etrack, int track);
+    void resetSpannerLevels();
+    void writePart(const int partIndex, const int firstStaffOfPart);
     void writeParts();
+    void writePartsParallel();
+    QString partText(const int partIndex, const int firstStaffOfPart) const;
 
     static QString fermataPosition(const Fermata* const fermata);
     static QString notePosition(const ExportMusicXml* const expMxml, const Note* const note);
@@ -2121,6 +2128,11 @@ static double accSymId2alter(SymId id)
 //---------------------------------------------------------
 
 void ExportMusicXml::keysig(const KeySig* ks, ClefType ct, int staff, bool visible)
+{
+    keysig(ks->keySigEvent(), ct, staff, visible, color2xml(ks));
+}
+
+void ExportMusicXml::keysig(const KeySigEvent& kse, ClefType ct, int staff, bool visible, const QString& color)
 {
     static char table2[]  = "CDEFGAB";
     int po = ClefInfo::pitchOffset(ct);   // actually 7 * oct + step for topmost staff line
@@ -2134,11 +2146,10 @@ void ExportMusicXml::keysig(const KeySig* ks, ClefType ct, int staff, bool visib
     if (!visible) {
         tagName += " print-object=\"no\"";
     }
-    tagName += color2xml(ks);
+    tagName += color;
     _attr.doAttr(_xml, true);
     _xml.startObject(tagName);
 
-    const KeySigEvent kse = ks->keySigEvent();
     const QList<KeySym> keysyms = kse.keySymbols();
     if (kse.custom() && !kse.isAtonal() && keysyms.size() > 0) {
         // non-traditional key signature
@@ -5895,12 +5906,10 @@ void ExportMusicXml::keysigTimesig(const Measure* m, const Part* p)
     } else {
         // always write a keysig at tick = 0
         if (m->tick().isZero()) {
-            //KeySigEvent kse;
-            //kse.setKey(Key::C);
-            KeySig* ks = Factory::createKeySig(_score->dummy()->segment());
-            ks->setKey(Key::C);
-            keysig(ks, p->staff(0)->clef(m->tick()));
-            delete ks;
+            //! NOTE Not a temporary KeySig, the parts can be written in parallel (see writePartsParallel())
+            KeySigEvent kse;
+            kse.setKey(Key::C);
+            keysig(kse, p->staff(0)->clef(m->tick()));
         }
     }
 
@@ -7136,6 +7145,72 @@ void MeasurePrintContext::measureWritten(const Measure* m)
     prevMeasure = m;
 }
 
+//---------------------------------------------------------
+//  writePart
+//---------------------------------------------------------
+
+/**
+ Write the part \a partIndex.
+ */
+
+void ExportMusicXml::writePart(const int partIndex, const int firstStaffOfPart)
+{
+    const auto part = _score->parts().at(partIndex);
+    _tick = { 0, 1 };
+    _xml.startObject(QString("part id=\"P%1\"").arg(partIndex + 1));
+
+    _trillStart.clear();
+    _trillStop.clear();
+    initInstrMap(instrMap, part->instruments(), _score);
+
+    MeasureNumberStateHandler mnsh;
+    FigBassMap fbMap;                     // pending figured bass extends
+
+    // set of spanners already stopped in this part
+    // required to prevent multiple spanner stops for the same spanner
+    QSet<const Spanner*> spannersStopped;
+
+    const auto& pages = _score->pages();
+    MeasurePrintContext mpc;
+
+    for (int pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
+        const auto page = pages.at(pageIndex);
+        mpc.pageStart = true;
+        const auto& systems = page->systems();
+
+        for (int systemIndex = 0; systemIndex < systems.size(); ++systemIndex) {
+            const auto system = systems.at(systemIndex);
+            mpc.systemStart = true;
+
+            for (const auto mb : system->measures()) {
+                if (!mb->isMeasure()) {
+                    continue;
+                }
+                const auto m = toMeasure(mb);
+
+                if (m->isMMRest()) {
+                    // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
+                    const auto m2 = m->mmRestLast()->nextMeasure();
+                    for (auto m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
+                        if (m1->isMeasure()) {
+                            writeMeasure(m1, partIndex, firstStaffOfPart, mnsh, fbMap, mpc, spannersStopped);
+                            mpc.measureWritten(m1);
+                        }
+                    }
+                } else {
+                    // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
+                    writeMeasure(m, partIndex, firstStaffOfPart, mnsh, fbMap, mpc, spannersStopped);
+                    mpc.measureWritten(m);
+                }
+            }
+            mpc.prevSystem = system;
+        }
+        mpc.lastSystemPrevPage = mpc.prevSystem;
+    }
+
+    _xml.endObject();
+}
+
 //---------------------------------------------------------
 //  writeParts
 //---------------------------------------------------------
@@ -7146,65 +7221,112 @@ void MeasurePrintContext::measureWritten(const Measure* m)
 
 void ExportMusicXml::writeParts()
 {
-    int staffCount = 0;
     const auto& parts = _score->parts();
 
+    if (parts.size() > 1 && configuration()->musicxmlExportParallelParts()) {
+        writePartsParallel();
+        return;
+    }
+
+    int staffCount = 0;
     for (int partIndex = 0; partIndex < parts.size(); ++partIndex) {
-        const auto part = parts.at(partIndex);
-        _tick = { 0, 1 };
-        _xml.startObject(QString("part id=\"P%1\"").arg(partIndex + 1));
+        writePart(partIndex, staffCount);
+        staffCount += parts.at(partIndex)->nstaves();
+    }
+}
 
-        _trillStart.clear();
-        _trillStop.clear();
-        initInstrMap(instrMap, part->instruments(), _score);
+//---------------------------------------------------------
+//  partText
+//---------------------------------------------------------
 
-        MeasureNumberStateHandler mnsh;
-        FigBassMap fbMap;                     // pending figured bass extends
+/**
+ Write the part \a partIndex with a separate exporter, return the text of the part.
+ The result is the same as written by writePart() of this exporter.
+ */
 
-        // set of spanners already stopped in this part
-        // required to prevent multiple spanner stops for the same spanner
-        QSet<const Spanner*> spannersStopped;
+QString ExportMusicXml::partText(const int partIndex, const int firstStaffOfPart) const
+{
+    ExportMusicXml em(_score);
+    em.div = div;
+    em.millimeters = millimeters;
+    em.tenths = tenths;
+    em._jumpElements = _jumpElements;
+    em.resetSpannerLevels();
 
-        const auto& pages = _score->pages();
-        MeasurePrintContext mpc;
+    QString text;
+    em._xml.setString(&text, QIODevice::WriteOnly);
 
-        for (int pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
-            const auto page = pages.at(pageIndex);
-            mpc.pageStart = true;
-            const auto& systems = page->systems();
+    //! NOTE Only for the indentation, the part is written inside score-partwise
+    em._xml.startObject(SCORE_PARTWISE);
+    const int prefixSize = text.size();
 
-            for (int systemIndex = 0; systemIndex < systems.size(); ++systemIndex) {
-                const auto system = systems.at(systemIndex);
-                mpc.systemStart = true;
+    em.writePart(partIndex, firstStaffOfPart);
+    em._xml.flush();
 
-                for (const auto mb : system->measures()) {
-                    if (!mb->isMeasure()) {
-                        continue;
-                    }
-                    const auto m = toMeasure(mb);
-
-                    if (m->isMMRest()) {
-                        // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
-                        const auto m2 = m->mmRestLast()->nextMeasure();
-                        for (auto m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
-                            if (m1->isMeasure()) {
-                                writeMeasure(m1, partIndex, staffCount, mnsh, fbMap, mpc, spannersStopped);
-                                mpc.measureWritten(m1);
-                            }
-                        }
-                    } else {
-                        // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
-                        writeMeasure(m, partIndex, staffCount, mnsh, fbMap, mpc, spannersStopped);
-                        mpc.measureWritten(m);
-                    }
-                }
-                mpc.prevSystem = system;
-            }
-            mpc.lastSystemPrevPage = mpc.prevSystem;
-        }
+    return text.mid(prefixSize);
+}
+
+//---------------------------------------------------------
+//  updateInvalidText
+//---------------------------------------------------------
+
+static void updateInvalidText(void*, EngravingItem* e)
+{
+    if (e->isTextBase()) {
+        toTextBase(e)->updateInvalidText();
+    }
+}
 
+//---------------------------------------------------------
+//  writePartsParallel
+//---------------------------------------------------------
+
+/**
+ Write all parts, each part is written into its own buffer on the global thread pool,
+ the buffers are written in the order of the parts.
+ */
+
+void ExportMusicXml::writePartsParallel()
+{
+    TRACEFUNC;
+
+    //! NOTE The lookup tree of the spanners is built on the first use, build it before the concurrent reading
+    _score->spannerMap().update();
+
+    //! NOTE xmlText() and plainText() of a text with an invalid text or layout write a temporary clone
+    //! of the text to its parent, so generate them before the concurrent reading
+    for (MeasureBase* mb = _score->first(); mb; mb = mb->next()) {
+        mb->scanElements(nullptr, updateInvalidText, true);
+    }
+
+    QList<QFuture<QString> > parts;
+    int staffCount = 0;
+    for (const Part* part : _score->parts()) {
+        const int partIndex = parts.size();
+        const int firstStaffOfPart = staffCount;
+        parts << QtConcurrent::run([this, partIndex, firstStaffOfPart]() {
+            return partText(partIndex, firstStaffOfPart);
+        });
         staffCount += part->nstaves();
-        _xml.endObject();
+    }
+
+    for (QFuture<QString>& part : parts) {
+        _xml << part.result();
+    }
+}
+
+//---------------------------------------------------------
+//  resetSpannerLevels
+//---------------------------------------------------------
+
+void ExportMusicXml::resetSpannerLevels()
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        brackets[i] = nullptr;
+        dashes[i] = nullptr;
+        hairpins[i] = nullptr;
+        ottavas[i] = nullptr;
+        trills[i] = nullptr;
     }
 }
 
@@ -7249,25 +7371,20 @@ void ExportMusicXml::write(QIODevice* dev)
     }
 
     calcDivisions();
-
-    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
-        brackets[i] = nullptr;
-        dashes[i] = nullptr;
-        hairpins[i] = nullptr;
-        ottavas[i] = nullptr;
-        trills[i] = nullptr;
-    }
+    resetSpannerLevels();
 
     _jumpElements = findJumpElements(_score);
 
-    _xml.setDevice(dev);
-    _xml.setCodec("UTF-8");
+    //! NOTE The document is written into memory and then to the device at once,
+    //! XmlWriter flushes after every line, which is expensive for a device
+    QString text;
+    _xml.setString(&text, QIODevice::WriteOnly);
     _xml << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
     _xml
         <<
         "<!DOCTYPE score-partwise PUBLIC \"-//Recordare//DTD MusicXML 3.1 Partwise//EN\" \"http://www.musicxml.org/dtds/partwise.dtd\">\n";
 
-    _xml.startObject("score-partwise version=\"3.1\"");
+    _xml.startObject(SCORE_PARTWISE);
 
     work(_score->measures()->first());
     identification(_xml, _score);
@@ -7281,6 +7398,9 @@ void ExportMusicXml::write(QIODevice* dev)
     writeParts();
 
     _xml.endObject();
+    _xml.flush();
+
+    dev->write(text.toUtf8());
 
     if (concertPitch) {
         // restore concert pitch
@@ -20,6 +20,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <QElapsedTimer>
 #include <QMessageBox>
 
 #include "importmxml.h"
@@ -27,6 +28,8 @@
 #include "importmxmlpass1.h"
 #include "importmxmlpass2.h"
 
+#include "log.h"
+
 namespace Ms {
 //---------------------------------------------------------
 //   musicXMLImportErrorDialog
@@ -62,11 +65,15 @@ Score::FileError importMusicXMLfromBuffer(Score* score, const QString& /*name*/,
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_INFO);
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_TRACE); // also include tracing
 
+    QElapsedTimer t;
+    t.start();
+
     // pass 1
     dev->seek(0);
     MusicXMLParserPass1 pass1(score, &logger);
     Score::FileError res = pass1.parse(dev);
     const auto pass1_errors = pass1.errors();
+    const qint64 pass1Time = t.restart();
 
     // pass 2
     MusicXMLParserPass2 pass2(score, pass1, &logger);
@@ -74,6 +81,9 @@ Score::FileError importMusicXMLfromBuffer(Score* score, const QString& /*name*/,
         dev->seek(0);
         res = pass2.parse(dev);
     }
+    const qint64 pass2Time = t.elapsed();
+
+    LOGI() << "MusicXML import pass 1: " << pass1Time << " ms, pass 2: " << pass2Time << " ms";
 
     // report result
     const auto pass2_errors = pass2.errors();
@@ -28,10 +28,23 @@
 #include <QXmlSchema>
 #include <QXmlSchemaValidator>
 #include <QBuffer>
+#include <QElapsedTimer>
+#include <QtConcurrent>
 
 #include "thirdparty/qzip/qzipreader_p.h"
 #include "importmxml.h"
 
+#include "modularity/ioc.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
+
+#include "log.h"
+
+static bool musicxmlImportValidation()
+{
+    auto conf = mu::modularity::ioc()->resolve<mu::iex::musicxml::IMusicXmlConfiguration>("iex_musicxml");
+    return conf ? conf->musicxmlImportValidation() : false;
+}
+
 namespace Ms {
 //---------------------------------------------------------
 //   tupletAssert -- check assertions for tuplet handling
@@ -67,13 +80,13 @@ static void tupletAssert()
 //    return false on error
 //---------------------------------------------------------
 
-static bool initMusicXmlSchema(QXmlSchema& schema)
+static bool initMusicXmlSchema(QXmlSchema& schema, QString& error)
 {
     // read the MusicXML schema from the application resources
     QFile schemaFile(":/schema/musicxml.xsd");
     if (!schemaFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
         qDebug("initMusicXmlSchema() could not open resource musicxml.xsd");
-        MScore::lastError = QObject::tr("Internal error: Could not open resource musicxml.xsd\n");
+        error = QObject::tr("Internal error: Could not open resource musicxml.xsd\n");
         return false;
     }
 
@@ -95,7 +108,7 @@ static bool initMusicXmlSchema(QXmlSchema& schema)
     schema.load(schemaBa);
     if (!schema.isValid()) {
         qDebug("initMusicXmlSchema() internal error: MusicXML schema is invalid");
-        MScore::lastError = QObject::tr("Internal error: MusicXML schema is invalid\n");
+        error = QObject::tr("Internal error: MusicXML schema is invalid\n");
         return false;
     }
 
@@ -180,38 +193,73 @@ static bool extractRootfile(QFile* qf, QByteArray& data)
     return true;
 }
 
+//---------------------------------------------------------
+//   ValidationResult
+//---------------------------------------------------------
+
+struct ValidationResult {
+    bool schemaLoaded = false;
+    bool valid = false;
+    QString schemaError;
+    QString errors;
+};
+
 //---------------------------------------------------------
 //   doValidate
 //---------------------------------------------------------
 
 /**
- Validate MusicXML data from file \a name contained in QIODevice \a dev.
+ Validate MusicXML \a data from file \a name.
+ Doesn't touch any global state, so may be run on any thread.
  */
 
-static Score::FileError doValidate(const QString& name, QIODevice* dev)
+static ValidationResult doValidate(const QString& name, const QByteArray& data)
 {
-    //QElapsedTimer t;
-    //t.start();
+    QElapsedTimer t;
+    t.start();
+
+    ValidationResult result;
 
     // initialize the schema
     ValidatorMessageHandler messageHandler;
     QXmlSchema schema;
     schema.setMessageHandler(&messageHandler);
-    if (!initMusicXmlSchema(schema)) {
-        return Score::FileError::FILE_BAD_FORMAT;      // appropriate error message has been printed by initMusicXmlSchema
+    if (!initMusicXmlSchema(schema, result.schemaError)) {
+        return result;
     }
+    result.schemaLoaded = true;
+
     // validate the data
     QXmlSchemaValidator validator(schema);
-    bool valid = validator.validate(dev, QUrl::fromLocalFile(name));
-    //qDebug("Validation time elapsed: %d ms", t.elapsed());
+    result.valid = validator.validate(data, QUrl::fromLocalFile(name));
+    result.errors = messageHandler.getErrors();
+
+    LOGI() << "MusicXML validation of " << name << " took " << t.elapsed() << " ms";
+    return result;
+}
+
+//---------------------------------------------------------
+//   checkValidationResult
+//---------------------------------------------------------
+
+/**
+ Report the result of the validation of file \a name, ask the user if the invalid file should be used anyway.
+ */
 
-    if (!valid) {
+static Score::FileError checkValidationResult(const QString& name, const ValidationResult& result)
+{
+    if (!result.schemaLoaded) {
+        MScore::lastError = result.schemaError;
+        return Score::FileError::FILE_BAD_FORMAT;
+    }
+
+    if (!result.valid) {
         qDebug("importMusicXml() file '%s' is not a valid MusicXML file", qPrintable(name));
         MScore::lastError = QObject::tr("File '%1' is not a valid MusicXML file").arg(name);
         if (MScore::noGui) {
             return Score::FileError::FILE_NO_ERROR;         // might as well try anyhow in converter mode
         }
-        if (musicXMLValidationErrorDialog(MScore::lastError, messageHandler.getErrors()) != QMessageBox::Yes) {
+        if (musicXMLValidationErrorDialog(MScore::lastError, result.errors) != QMessageBox::Yes) {
             return Score::FileError::FILE_USER_ABORT;
         }
     }
@@ -226,6 +274,8 @@ static Score::FileError doValidate(const QString& name, QIODevice* dev)
 
 /**
  Validate and import MusicXML data from file \a name contained in QIODevice \a dev into score \a score.
+ The validation is optional (see IMusicXmlConfiguration::musicxmlImportValidation),
+ it runs on another thread while the data is imported.
  */
 
 static Score::FileError doValidateAndImport(Score* score, const QString& name, QIODevice* dev)
@@ -233,15 +283,36 @@ static Score::FileError doValidateAndImport(Score* score, const QString& name, Q
     // verify tuplet DurationType dependencies
     tupletAssert();
 
-    // validate the file
-    Score::FileError res;
-    res = doValidate(name, dev);
-    if (res != Score::FileError::FILE_NO_ERROR) {
-        return res;
+    QElapsedTimer t;
+    t.start();
+
+    //! NOTE Read the data once, the validation and both import passes use the same (shared) buffer
+    dev->seek(0);
+    const QByteArray data = dev->readAll();
+
+    const bool needValidate = musicxmlImportValidation();
+    QFuture<ValidationResult> validation;
+    if (needValidate) {
+        validation = QtConcurrent::run([name, data]() {
+            return doValidate(name, data);
+        });
     }
 
     // actually do the import
-    res = importMusicXMLfromBuffer(score, name, dev);
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    Score::FileError res = importMusicXMLfromBuffer(score, name, &buffer);
+
+    if (needValidate) {
+        const ValidationResult validationResult = validation.result();
+        if (res == Score::FileError::FILE_NO_ERROR) {
+            res = checkValidationResult(name, validationResult);
+        }
+    }
+
+    LOGI() << "MusicXML import of " << name << " (" << data.size() << " bytes) took " << t.elapsed() << " ms";
+
     //qDebug("res %d", static_cast<int>(res));
     return res;
 }
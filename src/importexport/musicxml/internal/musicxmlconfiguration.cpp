@@ -30,9 +30,11 @@ static const std::string module_name("iex_musicxml");
 
 static const Settings::Key MUSICXML_IMPORT_BREAKS_KEY(module_name, "import/musicXML/importBreaks");
 static const Settings::Key MUSICXML_IMPORT_LAYOUT_KEY(module_name, "import/musicXML/importLayout");
+static const Settings::Key MUSICXML_IMPORT_VALIDATION_KEY(module_name, "import/musicXML/validation");
 static const Settings::Key MUSICXML_EXPORT_LAYOUT_KEY(module_name, "export/musicXML/exportLayout");
 static const Settings::Key MUSICXML_EXPORT_BREAKS_TYPE_KEY(module_name, "export/musicXML/exportBreaks");
 static const Settings::Key MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY(module_name, "export/musicXML/exportInvisibleElements");
+static const Settings::Key MUSICXML_EXPORT_PARALLEL_PARTS_KEY(module_name, "export/musicXML/parallelParts");
 static const Settings::Key MIGRATION_APPLY_EDWIN_FOR_XML(module_name, "import/compatibility/apply_edwin_for_xml");
 static const Settings::Key MIGRATION_NOT_ASK_AGAING_KEY(module_name, "import/compatibility/do_not_ask_me_again");
 static const Settings::Key STYLE_FILE_IMPORT_PATH_KEY(module_name, "import/style/styleFile");
@@ -41,9 +43,11 @@ void MusicXmlConfiguration::init()
 {
     settings()->setDefaultValue(MUSICXML_IMPORT_BREAKS_KEY, Val(true));
     settings()->setDefaultValue(MUSICXML_IMPORT_LAYOUT_KEY, Val(true));
+    settings()->setDefaultValue(MUSICXML_IMPORT_VALIDATION_KEY, Val(false));
     settings()->setDefaultValue(MUSICXML_EXPORT_LAYOUT_KEY, Val(true));
     settings()->setDefaultValue(MUSICXML_EXPORT_BREAKS_TYPE_KEY, Val(MusicxmlExportBreaksType::All));
     settings()->setDefaultValue(MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY, Val(false));
+    settings()->setDefaultValue(MUSICXML_EXPORT_PARALLEL_PARTS_KEY, Val(false));
     settings()->setDefaultValue(MIGRATION_NOT_ASK_AGAING_KEY, Val(false));
 }
 
@@ -67,6 +71,16 @@ void MusicXmlConfiguration::setMusicxmlImportLayout(bool value)
     settings()->setSharedValue(MUSICXML_IMPORT_LAYOUT_KEY, Val(value));
 }
 
+bool MusicXmlConfiguration::musicxmlImportValidation() const
+{
+    return settings()->value(MUSICXML_IMPORT_VALIDATION_KEY).toBool();
+}
+
+void MusicXmlConfiguration::setMusicxmlImportValidation(bool value)
+{
+    settings()->setSharedValue(MUSICXML_IMPORT_VALIDATION_KEY, Val(value));
+}
+
 bool MusicXmlConfiguration::musicxmlExportLayout() const
 {
     return settings()->value(MUSICXML_EXPORT_LAYOUT_KEY).toBool();
@@ -97,6 +111,16 @@ void MusicXmlConfiguration::setMusicxmlExportInvisibleElements(bool value)
     settings()->setSharedValue(MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY, Val(value));
 }
 
+bool MusicXmlConfiguration::musicxmlExportParallelParts() const
+{
+    return settings()->value(MUSICXML_EXPORT_PARALLEL_PARTS_KEY).toBool();
+}
+
+void MusicXmlConfiguration::setMusicxmlExportParallelParts(bool value)
+{
+    settings()->setSharedValue(MUSICXML_EXPORT_PARALLEL_PARTS_KEY, Val(value));
+}
+
 bool MusicXmlConfiguration::needUseDefaultFont() const
 {
     return settings()->value(MIGRATION_APPLY_EDWIN_FOR_XML).toBool();
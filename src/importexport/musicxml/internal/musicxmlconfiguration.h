@@ -36,6 +36,9 @@ public:
     bool musicxmlImportLayout() const override;
     void setMusicxmlImportLayout(bool value) override;
 
+    bool musicxmlImportValidation() const override;
+    void setMusicxmlImportValidation(bool value) override;
+
     bool musicxmlExportLayout() const override;
     void setMusicxmlExportLayout(bool value) override;
 
@@ -45,6 +48,9 @@ public:
     bool musicxmlExportInvisibleElements() const override;
     void setMusicxmlExportInvisibleElements(bool value) override;
 
+    bool musicxmlExportParallelParts() const override;
+    void setMusicxmlExportParallelParts(bool value) override;
+
     bool needUseDefaultFont() const override;
     void setNeedUseDefaultFont(bool value) override;
 
@@ -20,6 +20,9 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <QBuffer>
+#include <QDir>
+
 #include "testing/qtestsuite.h"
 
 #include "testbase.h"
@@ -34,6 +37,7 @@
 
 #include "settings.h"
 #include "importexport/musicxml/imusicxmlconfiguration.h"
+#include "importexport/musicxml/internal/musicxml/exportxml.h"
 
 using namespace mu;
 using namespace mu::framework;
@@ -51,6 +55,7 @@ static const std::string PREF_EXPORT_MUSICXML_EXPORTBREAKS("export/musicXML/expo
 static const std::string PREF_IMPORT_MUSICXML_IMPORTBREAKS("import/musicXML/importBreaks");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTLAYOUT("export/musicXML/exportLayout");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTINVISIBLE("export/musicXML/exportInvisibleElements");
+static const std::string PREF_EXPORT_MUSICXML_PARALLELPARTS("export/musicXML/parallelParts");
 
 using namespace Ms;
 
@@ -71,6 +76,7 @@ class TestMxmlIO : public QObject, public MTest
     void mxmlReadTestCompr(const char* file);
     void mxmlReadWriteTestCompr(const char* file);
     void mxmlImportTestRef(const char* file);
+    QByteArray mxmlExport(MasterScore* score, bool parallelParts);
 
     // The list of MusicXML regression tests
     // Currently failing tests are commented out and annotated with the failure reason
@@ -245,6 +251,7 @@ private slots:
     void words1() { mxmlIoTest("testWords1"); }
     void words2() { mxmlIoTest("testWords2"); }
     void excludeInvisibleElements() { mxmlMscxExportTestRefInvisibleElements("testExcludeInvisibleElements"); }
+    void parallelPartsExport();
 };
 
 //---------------------------------------------------------
@@ -512,5 +519,59 @@ void TestMxmlIO::mxmlImportTestRef(const char* file)
     delete score;
 }
 
+//---------------------------------------------------------
+//   mxmlExport
+//   export the score to MusicXML in memory
+//---------------------------------------------------------
+
+QByteArray TestMxmlIO::mxmlExport(MasterScore* score, bool parallelParts)
+{
+    setValue(PREF_EXPORT_MUSICXML_PARALLELPARTS, Val(parallelParts));
+
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    saveXml(score, &buffer);
+
+    setValue(PREF_EXPORT_MUSICXML_PARALLELPARTS, Val(false));
+    return data;
+}
+
+//---------------------------------------------------------
+//   parallelPartsExport
+//   read every MusicXML file of the test data, export it with the parts written sequentially
+//   and in parallel and verify both exports are byte identical
+//---------------------------------------------------------
+
+void TestMxmlIO::parallelPartsExport()
+{
+    MScore::debugMode = true;
+
+    setValue(PREF_EXPORT_MUSICXML_EXPORTBREAKS, Val(IMusicXmlConfiguration::MusicxmlExportBreaksType::Manual));
+    setValue(PREF_IMPORT_MUSICXML_IMPORTBREAKS, Val(true));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTLAYOUT, Val(true));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTINVISIBLE, Val(true));
+
+    const QStringList files = QDir(root + "/" + XML_IO_DATA_DIR).entryList({ "*.xml" }, QDir::Files, QDir::Name);
+    QVERIFY(!files.isEmpty());
+
+    for (const QString& file : files) {
+        MasterScore* score = readScore(XML_IO_DATA_DIR + file);
+        if (!score) {
+            continue;
+        }
+
+        fixupScore(score);
+        score->doLayout();
+
+        const QByteArray sequential = mxmlExport(score, false);
+        const QByteArray parallel = mxmlExport(score, true);
+        QVERIFY2(!sequential.isEmpty(), qPrintable(file));
+        QVERIFY2(sequential == parallel, qPrintable(file));
+
+        delete score;
+    }
+}
+
 QTEST_MAIN(TestMxmlIO)
 #include "tst_mxml_io.moc"
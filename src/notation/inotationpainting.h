@@ -24,6 +24,7 @@
 
 #include <memory>
 #include "notationtypes.h"
+#include "async/notification.h"
 
 #include "infrastructure/draw/painter.h"
 #include "infrastructure/draw/paintdevice.h"
@@ -45,6 +46,8 @@ public:
         int copyCount = 1;
         int trimMarginPixelSize = -1;
         int deviceDpi = -1;
+        //! NOTE The paint state is set by beginPrinting(), the painting doesn't change it
+        bool isPrintingStarted = false;
 
         std::function<void()> onNewPage;
     };
@@ -59,6 +62,19 @@ public:
     virtual void paintPdf(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(draw::Painter* painter, const Options& opt) = 0;
+
+    //! NOTE Sets the global paint state of the score (pixel ratio, printing) for a device with the dpi,
+    //! so the pages painted with Options::isPrintingStarted can be painted from several threads
+    virtual void beginPrinting(int deviceDpi) = 0;
+    virtual void endPrinting() = 0;
+
+    //! NOTE Notifies that the view should be repainted,
+    //! for example, when the cached page tiles are ready
+    virtual async::Notification repaintRequested() const = 0;
+
+    //! NOTE The changed pages are recorded again on the next paint,
+    //! this drops the cached painting of all pages, for example, when all pages have been moved
+    virtual void invalidatePageDisplayLists() = 0;
 };
 
 using INotationPaintingPtr = std::shared_ptr<INotationPainting>;
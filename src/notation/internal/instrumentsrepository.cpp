@@ -21,43 +21,61 @@
  */
 #include "instrumentsrepository.h"
 
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QLocale>
+#include <QSaveFile>
+
 #include "log.h"
 #include "translation.h"
 
 #include "libmscore/instrtemplate.h"
+#include "libmscore/instrtemplatecache.h"
 
 using namespace mu::notation;
 
 void InstrumentsRepository::init()
 {
-    configuration()->instrumentListPathsChanged().onNotify(this, [this]() {
-        load();
-    });
+    auto reload = [this]() {
+        //! NOTE If not loaded yet, the new paths will be used on the first use
+        if (m_lazyLoad.isDone()) {
+            load();
+        }
+    };
 
-    configuration()->scoreOrderListPathsChanged().onNotify(this, [this]() {
-        load();
-    });
+    configuration()->instrumentListPathsChanged().onNotify(this, reload);
+    configuration()->scoreOrderListPathsChanged().onNotify(this, reload);
 
-    load();
+    Ms::setInstrumentTemplatesLoader([this]() {
+        m_lazyLoad.ensure();
+    });
 }
 
 const InstrumentTemplateList& InstrumentsRepository::instrumentTemplates() const
 {
+    m_lazyLoad.ensure();
     return m_instrumentTemplates;
 }
 
 const InstrumentGenreList& InstrumentsRepository::genres() const
 {
+    m_lazyLoad.ensure();
     return m_genres;
 }
 
 const InstrumentGroupList& InstrumentsRepository::groups() const
 {
+    m_lazyLoad.ensure();
     return m_groups;
 }
 
 const ScoreOrderList& InstrumentsRepository::orders() const
 {
+    m_lazyLoad.ensure();
     return Ms::instrumentOrders;
 }
 
@@ -65,15 +83,20 @@ void InstrumentsRepository::load()
 {
     TRACEFUNC;
 
+    QElapsedTimer timer;
+    timer.start();
+
     m_instrumentTemplates.clear();
     m_genres.clear();
     m_groups.clear();
-    Ms::clearInstrumentTemplates();
 
-    for (const io::path& filePath: configuration()->instrumentListPaths()) {
-        if (!Ms::loadInstrumentTemplates(filePath.toQString())) {
-            LOGE() << "Could not load instruments from " << filePath.toQString() << "!";
-        }
+    const io::paths filePaths = configuration()->instrumentListPaths();
+    const QByteArray hash = sourceHash(filePaths);
+
+    bool fromCache = readCache(hash);
+    bool needWriteCache = false;
+    if (!fromCache) {
+        needWriteCache = loadFromXml(filePaths);
     }
 
     for (const InstrumentGenre* genre : Ms::instrumentGenres) {
@@ -92,4 +115,104 @@ void InstrumentsRepository::load()
             m_instrumentTemplates << templ;
         }
     }
+
+    if (needWriteCache) {
+        writeCache(hash);
+    }
+
+    LOGI() << "instrument templates loaded" << (fromCache ? " from cache" : "") << " in " << timer.elapsed() << " ms";
+}
+
+bool InstrumentsRepository::loadFromXml(const io::paths& filePaths)
+{
+    TRACEFUNC;
+
+    Ms::clearInstrumentTemplates();
+
+    bool ok = true;
+    for (const io::path& filePath: filePaths) {
+        if (!Ms::loadInstrumentTemplates(filePath.toQString())) {
+            LOGE() << "Could not load instruments from " << filePath.toQString() << "!";
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+QString InstrumentsRepository::cachePath() const
+{
+    if (!globalConfiguration()) {
+        return QString();
+    }
+
+    return globalConfiguration()->userCachePath().toQString() + "/instruments/templates.cache";
+}
+
+QByteArray InstrumentsRepository::sourceHash(const io::paths& filePaths) const
+{
+    TRACEFUNC;
+
+    //! NOTE The names are translated while reading, so the cache also depends on the language
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QCoreApplication::applicationVersion().toUtf8());
+    hash.addData(QLocale().name().toUtf8());
+
+    for (const io::path& filePath : filePaths) {
+        QFile file(filePath.toQString());
+        if (!file.open(QIODevice::ReadOnly)) {
+            //! NOTE The missing file will be reported by the xml loading
+            return QByteArray();
+        }
+
+        hash.addData(filePath.toQString().toUtf8());
+        hash.addData(&file);
+    }
+
+    return hash.result();
+}
+
+bool InstrumentsRepository::readCache(const QByteArray& hash)
+{
+    TRACEFUNC;
+
+    const QString path = cachePath();
+    if (hash.isEmpty() || path.isEmpty()) {
+        return false;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    if (!Ms::readInstrumentTemplatesCache(&file, hash)) {
+        LOGI() << "instrument templates cache is outdated, will be rebuilt";
+        return false;
+    }
+
+    return true;
+}
+
+void InstrumentsRepository::writeCache(const QByteArray& hash)
+{
+    TRACEFUNC;
+
+    const QString path = cachePath();
+    if (hash.isEmpty() || path.isEmpty()) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    //! NOTE Several instances (for example, converters) may write the cache at the same time
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGW() << "failed open instrument templates cache for writing: " << path;
+        return;
+    }
+
+    if (!Ms::writeInstrumentTemplatesCache(&file, hash) || !file.commit()) {
+        LOGW() << "failed write instrument templates cache: " << path;
+    }
 }
@@ -23,17 +23,20 @@
 #define MU_NOTATION_INSTRUMENTSREPOSITORY_H
 
 #include "modularity/ioc.h"
+#include "lazyinit.h"
 
 #include "async/channel.h"
 #include "async/asyncable.h"
 
 #include "iinstrumentsrepository.h"
 #include "inotationconfiguration.h"
+#include "iglobalconfiguration.h"
 
 namespace mu::notation {
 class InstrumentsRepository : public IInstrumentsRepository, public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, configuration)
+    INJECT(notation, framework::IGlobalConfiguration, globalConfiguration)
 
 public:
     void init();
@@ -47,6 +50,15 @@ private:
     void load();
     void clear();
 
+    bool loadFromXml(const io::paths& filePaths);
+    QString cachePath() const;
+    QByteArray sourceHash(const io::paths& filePaths) const;
+    bool readCache(const QByteArray& hash);
+    void writeCache(const QByteArray& hash);
+
+    //! NOTE The templates are loaded on the first use, the converter often doesn't need them
+    LazyInit m_lazyLoad { "InstrumentsRepository", [this]() { load(); } };
+
     InstrumentTemplateList m_instrumentTemplates;
     InstrumentGroupList m_groups;
     InstrumentGenreList m_genres;
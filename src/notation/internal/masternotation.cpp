@@ -480,6 +480,8 @@ void MasterNotation::addExcerpts(const ExcerptNotationList& excerpts)
     undoStack()->prepareChanges();
 
     ExcerptNotationList result = m_excerpts.val;
+    QList<Ms::Excerpt*> excerptsToCreate;
+
     for (IExcerptNotationPtr excerptNotation : excerpts) {
         auto it = std::find(result.cbegin(), result.cend(), excerptNotation);
         if (it != result.end()) {
@@ -489,13 +491,15 @@ void MasterNotation::addExcerpts(const ExcerptNotationList& excerpts)
         ExcerptNotation* excerptNotationImpl = get_impl(excerptNotation);
 
         if (!excerptNotationImpl->isCreated()) {
-            masterScore()->initAndAddExcerpt(excerptNotationImpl->excerpt(), false);
+            excerptsToCreate << excerptNotationImpl->excerpt();
             excerptNotationImpl->setIsCreated(true);
         }
 
         result.push_back(excerptNotation);
     }
 
+    masterScore()->initAndAddExcerpts(excerptsToCreate, false);
+
     undoStack()->commitChanges();
 
     doSetExcerpts(result);
@@ -641,7 +645,5 @@ void MasterNotation::addExcerptsToMasterScore(const QList<Ms::Excerpt*>& excerpt
 {
     TRACEFUNC;
 
-    for (Ms::Excerpt* excerpt : excerpts) {
-        masterScore()->initAndAddExcerpt(excerpt, false);
-    }
+    masterScore()->initAndAddExcerpts(excerpts, false);
 }
@@ -51,9 +51,9 @@ Notation::Notation(Ms::Score* score)
 {
     m_opened.val = false;
 
-    m_painting = std::make_shared<NotationPainting>(this);
     m_undoStack = std::make_shared<NotationUndoStack>(this, m_notationChanged);
     m_interaction = std::make_shared<NotationInteraction>(this, m_undoStack);
+    m_painting = std::make_shared<NotationPainting>(this);
     m_midiInput = std::make_shared<NotationMidiInput>(this, m_undoStack);
     m_accessibility = std::make_shared<NotationAccessibility>(this);
     m_parts = std::make_shared<NotationParts>(this, m_interaction, m_undoStack);
@@ -98,6 +98,8 @@ Notation::Notation(Ms::Score* score)
         for (Ms::Score* score : m_score->scoreList()) {
             score->doLayout();
         }
+
+        m_painting->invalidatePageDisplayLists();
     });
 
     setScore(score);
@@ -84,6 +84,19 @@ static int findSystemIndex(Ms::EngravingItem* element)
     return element->score()->systems().indexOf(target);
 }
 
+//! NOTE The painted pages are recorded again only if their content has changed,
+//! so the page is marked when the element looks different without a layout (ex. the drop target color)
+static void setPageContentChanged(Ms::EngravingItem* element)
+{
+    if (!element) {
+        return;
+    }
+
+    if (Ms::EngravingItem* page = element->findAncestor(Ms::ElementType::PAGE)) {
+        Ms::toPage(page)->setContentChanged();
+    }
+}
+
 static int findBracketIndex(Ms::EngravingItem* element)
 {
     if (!element->isBracket()) {
@@ -1881,12 +1894,14 @@ void NotationInteraction::setDropTarget(EngravingItem* el)
     if (m_dropData.dropTarget != el) {
         if (m_dropData.dropTarget) {
             m_dropData.dropTarget->setDropTarget(false);
+            setPageContentChanged(m_dropData.dropTarget);
             m_dropData.dropTarget = nullptr;
         }
 
         m_dropData.dropTarget = el;
         if (m_dropData.dropTarget) {
             m_dropData.dropTarget->setDropTarget(true);
+            setPageContentChanged(m_dropData.dropTarget);
         }
     }
 
@@ -2472,6 +2487,9 @@ void NotationInteraction::startEditText(EngravingItem* element, const PointF& cu
         }
 
         m_editData.element->startEdit(m_editData);
+
+        //! NOTE The text being edited is painted live, see PageDisplayList
+        setPageContentChanged(m_editData.element);
     }
 
     notifyAboutTextEditingStarted();
@@ -2841,6 +2859,8 @@ void NotationInteraction::endEditElement()
 void NotationInteraction::doEndEditElement()
 {
     if (m_editData.element) {
+        //! NOTE Before endEdit(), it may remove the element
+        setPageContentChanged(m_editData.element);
         m_editData.element->endEdit(m_editData);
         m_editData.element = nullptr;
     }
@@ -3918,6 +3938,7 @@ void NotationInteraction::setScoreConfig(ScoreConfig config)
     score()->setShowFrames(config.isShowFrames);
     score()->setShowPageborders(config.isShowPageMargins);
     score()->setMarkIrregularMeasures(config.isMarkIrregularMeasures);
+    score()->setUpdateAll();
 
     EngravingItem* selectedElement = selection()->element();
     if (selectedElement && !selectedElement->isInteractionAvailable()) {
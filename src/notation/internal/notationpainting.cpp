@@ -29,6 +29,7 @@
 #include "notation.h"
 #include "notationinteraction.h"
 
+#include "realfn.h"
 #include "log.h"
 
 using namespace mu;
@@ -39,6 +40,21 @@ using namespace mu::draw;
 NotationPainting::NotationPainting(Notation* notation)
     : m_notation(notation)
 {
+    m_notation->interaction()->selectionChanged().onNotify(this, [this]() {
+        onSelectionChanged();
+    });
+
+    engravingConfiguration()->scoreInversionChanged().onNotify(this, [this]() {
+        invalidatePageDisplayLists();
+    });
+
+    engravingConfiguration()->selectionColorChanged().onReceive(this, [this](int, const mu::draw::Color&) {
+        invalidatePageDisplayLists();
+    });
+
+    uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        invalidatePageDisplayLists();
+    });
 }
 
 Ms::Score* NotationPainting::score() const
@@ -106,7 +122,7 @@ bool NotationPainting::isPaintPageBorder() const
     return false;
 }
 
-void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
+void NotationPainting::doPaint(draw::Painter* painter, const Options& opt, bool isUsePageDisplayLists)
 {
     TRACEFUNC;
     if (!score()) {
@@ -138,9 +154,22 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
     }
 
     // Setup score draw system
-    Ms::MScore::pixelRatio = Ms::DPI / DEVICE_DPI;
-    score()->setPrinting(opt.isPrinting);
-    Ms::MScore::pdfPrinting = opt.isPrinting;
+    if (!opt.isPrintingStarted) {
+        Ms::MScore::pixelRatio = Ms::DPI / DEVICE_DPI;
+        score()->setPrinting(opt.isPrinting);
+        Ms::MScore::pdfPrinting = opt.isPrinting;
+    }
+
+    if (isUsePageDisplayLists) {
+        //! NOTE The recorded text depends on the pixel ratio
+        if (!RealIsEqual(m_pageDisplayListsPixelRatio, Ms::MScore::pixelRatio)) {
+            invalidatePageDisplayLists();
+            m_pageDisplayListsPixelRatio = Ms::MScore::pixelRatio;
+        }
+
+        removeStalePageDisplayLists();
+        m_tileCache.beginPaint();
+    }
 
     // Setup page counts
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
@@ -196,8 +225,16 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
             // Draw page elements
             painter->setClipping(true);
             painter->setClipRect(pageRect);
-            QList<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            engraving::Paint::paintElements(*painter, elements);
+            if (isUsePageDisplayLists) {
+                const PageDisplayList& displayList = pageDisplayList(page);
+                RectF pageDrawRect = drawRect.translated(-pagePos);
+                if (!m_tileCache.paint(painter, page, displayList, pageDrawRect)) {
+                    displayList.paint(*painter, pageDrawRect);
+                }
+            } else {
+                QList<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
+                engraving::Paint::paintElements(*painter, elements);
+            }
             painter->setClipping(false);
 
             if (opt.isMultiPage) {
@@ -217,6 +254,10 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
             static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
         }
     }
+
+    if (isUsePageDisplayLists) {
+        m_tileCache.endPaint();
+    }
 }
 
 void NotationPainting::paintPageSheet(Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd) const
@@ -267,6 +308,87 @@ void NotationPainting::paintPageSheet(Painter* painter, const RectF& pageRect, c
     }
 }
 
+const PageDisplayList& NotationPainting::pageDisplayList(Ms::Page* page)
+{
+    PageDisplayList& list = m_pageDisplayLists[page];
+
+    //! NOTE The page was laid out again or its content was updated since the recording
+    if (list.isValid() && list.pageRevision() != page->contentRevision()) {
+        invalidatePageDisplayList(page);
+    }
+
+    if (!list.isValid()) {
+        list.record(page);
+    }
+
+    return list;
+}
+
+void NotationPainting::invalidatePageDisplayList(const Ms::Page* page)
+{
+    auto it = m_pageDisplayLists.find(page);
+    if (it != m_pageDisplayLists.end()) {
+        it->second.invalidate();
+    }
+
+    m_tileCache.invalidatePage(page);
+}
+
+void NotationPainting::invalidatePageDisplayLists()
+{
+    m_pageDisplayLists.clear();
+    m_tileCache.invalidate();
+}
+
+mu::async::Notification NotationPainting::repaintRequested() const
+{
+    return m_tileCache.tilesReady();
+}
+
+void NotationPainting::removeStalePageDisplayLists()
+{
+    if (m_pageDisplayLists.empty()) {
+        return;
+    }
+
+    const QList<Ms::Page*>& pages = score()->pages();
+    for (auto it = m_pageDisplayLists.begin(); it != m_pageDisplayLists.end();) {
+        if (!pages.contains(const_cast<Ms::Page*>(it->first))) {
+            m_tileCache.invalidatePage(it->first);
+            it = m_pageDisplayLists.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void NotationPainting::onSelectionChanged()
+{
+    if (!score()) {
+        return;
+    }
+
+    //! NOTE The selected elements are drawn with a different color,
+    //! so only the pages of the previous and the new selection need to be recorded again
+    std::set<const Ms::Page*> selectedPages;
+    for (const EngravingItem* element : score()->selection().elements()) {
+        const EngravingItem* page = element->findAncestor(Ms::ElementType::PAGE);
+        if (page) {
+            selectedPages.insert(Ms::toPage(page));
+        }
+    }
+
+    for (const Ms::Page* page : m_selectedPages) {
+        invalidatePageDisplayList(page);
+    }
+
+    for (const Ms::Page* page : selectedPages) {
+        invalidatePageDisplayList(page);
+    }
+
+    m_selectedPages = std::move(selectedPages);
+}
+
 void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
 {
     Options opt;
@@ -275,7 +397,14 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->dpi();
     opt.isPrinting = isPrinting;
-    doPaint(painter, opt);
+
+#ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
+    bool isUsePageDisplayLists = false;
+#else
+    bool isUsePageDisplayLists = !isPrinting;
+#endif
+
+    doPaint(painter, opt, isUsePageDisplayLists);
 }
 
 void NotationPainting::paintPdf(draw::Painter* painter, const Options& opt)
@@ -307,3 +436,27 @@ void NotationPainting::paintPng(Painter* painter, const Options& opt)
     myopt.isPrinting = true;
     doPaint(painter, myopt);
 }
+
+void NotationPainting::beginPrinting(int deviceDpi)
+{
+    IF_ASSERT_FAILED(score() && deviceDpi > 0) {
+        return;
+    }
+
+    m_pixelRatioBeforePrinting = Ms::MScore::pixelRatio;
+
+    Ms::MScore::pixelRatio = Ms::DPI / deviceDpi;
+    score()->setPrinting(true);
+    Ms::MScore::pdfPrinting = true;
+}
+
+void NotationPainting::endPrinting()
+{
+    if (!score()) {
+        return;
+    }
+
+    Ms::MScore::pixelRatio = m_pixelRatioBeforePrinting;
+    score()->setPrinting(false);
+    Ms::MScore::pdfPrinting = false;
+}
@@ -22,13 +22,19 @@
 #ifndef MU_NOTATION_NOTATIONPAINTING_H
 #define MU_NOTATION_NOTATIONPAINTING_H
 
+#include <map>
+#include <set>
+
 #include "../inotationpainting.h"
 #include "igetscore.h"
 
+#include "async/asyncable.h"
 #include "modularity/ioc.h"
 #include "../inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
 #include "ui/iuiconfiguration.h"
+#include "engraving/paint/pagedisplaylist.h"
+#include "pagetilecache.h"
 
 namespace Ms {
 class Score;
@@ -37,7 +43,7 @@ class Page;
 
 namespace mu::notation {
 class Notation;
-class NotationPainting : public INotationPainting
+class NotationPainting : public INotationPainting, public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, configuration)
     INJECT(notation, engraving::IEngravingConfiguration, engravingConfiguration)
@@ -57,15 +63,33 @@ public:
     void paintPrint(draw::Painter* painter, const Options& opt) override;
     void paintPng(draw::Painter* painter, const Options& opt) override;
 
+    void beginPrinting(int deviceDpi) override;
+    void endPrinting() override;
+
+    async::Notification repaintRequested() const override;
+
+    void invalidatePageDisplayLists() override;
+
 private:
     Ms::Score* score() const;
 
     bool isPaintPageBorder() const;
-    void doPaint(draw::Painter* painter, const Options& opt);
+    void doPaint(draw::Painter* painter, const Options& opt, bool isUsePageDisplayLists = false);
     void paintPageBorder(draw::Painter* painter, const Ms::Page* page) const;
     void paintPageSheet(mu::draw::Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd) const;
 
+    const engraving::PageDisplayList& pageDisplayList(Ms::Page* page);
+    void invalidatePageDisplayList(const Ms::Page* page);
+    void removeStalePageDisplayLists();
+    void onSelectionChanged();
+
     Notation* m_notation = nullptr;
+
+    std::map<const Ms::Page*, engraving::PageDisplayList> m_pageDisplayLists;
+    std::set<const Ms::Page*> m_selectedPages;
+    qreal m_pageDisplayListsPixelRatio = 0.0;
+    qreal m_pixelRatioBeforePrinting = 0.0;
+    PageTileCache m_tileCache;
 };
 }
 
@@ -0,0 +1,400 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pagetilecache.h"
+
+#include <cmath>
+
+#include <QPainter>
+#include <QPaintDevice>
+#include <QtConcurrent>
+
+#include "engraving/libmscore/page.h"
+#include "infrastructure/internal/qpainterprovider.h"
+
+#include "realfn.h"
+#include "log.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::engraving;
+
+//! NOTE Two buckets per doubling of the scale, the bucket scales are the powers of √2
+static constexpr qreal ZOOM_BUCKETS_PER_OCTAVE = 2.0;
+
+//! NOTE Limits the work queued on the thread pool, when zooming or scrolling fast
+static constexpr size_t MAX_PENDING_TILES = 64;
+
+PageTileCache::PageTileCache()
+{
+    m_tileRendered.onReceive(this, [this](const RenderedTile& tile) {
+        onTileRendered(tile);
+    }, Asyncable::AsyncMode::AsyncSetRepeat);
+}
+
+void PageTileCache::setMemoryLimit(size_t bytes)
+{
+    m_memoryLimit = bytes;
+    evictTiles();
+}
+
+size_t PageTileCache::memoryLimit() const
+{
+    return m_memoryLimit;
+}
+
+size_t PageTileCache::memoryUsage() const
+{
+    return m_memoryUsage;
+}
+
+async::Notification PageTileCache::tilesReady() const
+{
+    return m_tilesReady;
+}
+
+int PageTileCache::zoomBucket(qreal scale)
+{
+    //! NOTE Rounded up, so the tiles are never rendered at a lower resolution than they are painted
+    static constexpr qreal EPSILON = 1e-6;
+    return static_cast<int>(std::ceil(std::log2(scale) * ZOOM_BUCKETS_PER_OCTAVE - EPSILON));
+}
+
+qreal PageTileCache::bucketZoom(int bucket)
+{
+    return std::pow(2.0, bucket / ZOOM_BUCKETS_PER_OCTAVE);
+}
+
+RectF PageTileCache::tileRect(int column, int row, qreal zoom)
+{
+    qreal size = TILE_SIZE / zoom;
+    return RectF(column * size, row * size, size, size);
+}
+
+qreal PageTileCache::devicePixelRatio(const draw::Painter* painter)
+{
+    std::shared_ptr<draw::QPainterProvider> qPaintProvider = std::dynamic_pointer_cast<draw::QPainterProvider>(painter->provider());
+    if (!qPaintProvider || !qPaintProvider->qpainter()->device()) {
+        return 1.0;
+    }
+
+    return qPaintProvider->qpainter()->device()->devicePixelRatioF();
+}
+
+int PageTileCache::pageGeneration(const Ms::Page* page) const
+{
+    auto it = m_pageGenerations.find(page);
+    return it != m_pageGenerations.end() ? it->second : m_baseGeneration;
+}
+
+template<typename Predicate>
+void PageTileCache::cancelPendingTiles(Predicate isCancelled)
+{
+    for (auto it = m_pendingTiles.begin(); it != m_pendingTiles.end();) {
+        if (isCancelled(it->first, it->second)) {
+            *it->second.cancelled = true;
+            it = m_pendingTiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PageTileCache::invalidate()
+{
+    cancelPendingTiles([](const TileKey&, const PendingTile&) {
+        return true;
+    });
+
+    m_baseGeneration = ++m_generation;
+    m_pageGenerations.clear();
+    m_lastPaintedBuckets.clear();
+
+    m_tiles.clear();
+    m_lru.clear();
+    m_memoryUsage = 0;
+}
+
+void PageTileCache::invalidatePage(const Ms::Page* page)
+{
+    cancelPendingTiles([page](const TileKey& key, const PendingTile&) {
+        return key.page == page;
+    });
+
+    m_pageGenerations[page] = ++m_generation;
+    m_lastPaintedBuckets.erase(page);
+
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        if (it->first.page == page) {
+            auto next = std::next(it);
+            removeTile(it);
+            it = next;
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PageTileCache::beginPaint()
+{
+    ++m_frame;
+}
+
+void PageTileCache::endPaint()
+{
+    //! NOTE The zoom or the visible pages have changed, don't render the tiles which are not visible anymore
+    cancelPendingTiles([this](const TileKey&, const PendingTile& tile) {
+        return tile.frame != m_frame;
+    });
+}
+
+bool PageTileCache::paint(draw::Painter* painter, const Ms::Page* page, const PageDisplayList& displayList, const RectF& rect)
+{
+    TRACEFUNC;
+
+    //! NOTE Live elements can only be painted from the main thread
+    if (displayList.hasLiveElements()) {
+        return false;
+    }
+
+    const Transform& worldTransform = painter->worldTransform();
+    if (!RealIsNull(worldTransform.m12()) || !RealIsNull(worldTransform.m21())) {
+        return false;
+    }
+
+    //! NOTE The tiles are rendered in device pixels
+    const qreal scale = worldTransform.m11() * devicePixelRatio(painter);
+    if (scale <= 0.0) {
+        return false;
+    }
+
+    const int bucket = zoomBucket(scale);
+
+    const RectF pageRect = page->bbox();
+    const RectF visibleRect = rect.intersected(pageRect);
+    if (visibleRect.isEmpty()) {
+        return true;
+    }
+
+    const qreal zoom = bucketZoom(bucket);
+    const qreal tileSize = TILE_SIZE / zoom;
+    const int firstColumn = static_cast<int>(std::floor(visibleRect.left() / tileSize));
+    const int lastColumn = static_cast<int>(std::floor(visibleRect.right() / tileSize));
+    const int firstRow = static_cast<int>(std::floor(visibleRect.top() / tileSize));
+    const int lastRow = static_cast<int>(std::floor(visibleRect.bottom() / tileSize));
+
+    const int generation = pageGeneration(page);
+    bool isAllTilesReady = true;
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            TileKey key { page, bucket, column, row, generation };
+
+            if (const Tile* tile = findTile(key)) {
+                paintTile(painter, tile->pixmap, key);
+                continue;
+            }
+
+            isAllTilesReady = false;
+            requestTile(key, displayList);
+
+            RectF clipRect = tileRect(column, row, zoom).intersected(visibleRect);
+            painter->setClipRect(clipRect);
+
+            if (!paintFallback(painter, key, clipRect)) {
+                displayList.paint(*painter, clipRect);
+            }
+
+            painter->setClipRect(pageRect);
+        }
+    }
+
+    if (isAllTilesReady) {
+        m_lastPaintedBuckets[page] = bucket;
+    }
+
+    return true;
+}
+
+const PageTileCache::Tile* PageTileCache::findTile(const TileKey& key)
+{
+    auto it = m_tiles.find(key);
+    if (it == m_tiles.end()) {
+        return nullptr;
+    }
+
+    Tile& tile = it->second;
+    m_lru.splice(m_lru.begin(), m_lru, tile.lruIt);
+
+    return &tile;
+}
+
+bool PageTileCache::paintFallback(draw::Painter* painter, const TileKey& key, const RectF& rect)
+{
+    auto it = m_lastPaintedBuckets.find(key.page);
+    if (it == m_lastPaintedBuckets.end() || it->second == key.zoomBucket) {
+        return false;
+    }
+
+    //! NOTE Scale the tiles of the last completely painted zoom, until the tiles of the current zoom are ready
+    const int bucket = it->second;
+    const qreal tileSize = TILE_SIZE / bucketZoom(bucket);
+    const int firstColumn = static_cast<int>(std::floor(rect.left() / tileSize));
+    const int lastColumn = static_cast<int>(std::floor(rect.right() / tileSize));
+    const int firstRow = static_cast<int>(std::floor(rect.top() / tileSize));
+    const int lastRow = static_cast<int>(std::floor(rect.bottom() / tileSize));
+
+    std::vector<std::pair<TileKey, QPixmap> > tiles;
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            TileKey fallbackKey { key.page, bucket, column, row, key.generation };
+            const Tile* tile = findTile(fallbackKey);
+            if (!tile) {
+                return false;
+            }
+
+            tiles.push_back({ fallbackKey, tile->pixmap });
+        }
+    }
+
+    for (const auto& tile : tiles) {
+        paintTile(painter, tile.second, tile.first);
+    }
+
+    return true;
+}
+
+void PageTileCache::paintTile(draw::Painter* painter, const QPixmap& pixmap, const TileKey& key)
+{
+    const qreal zoom = bucketZoom(key.zoomBucket);
+    const RectF rect = tileRect(key.column, key.row, zoom);
+    const Transform worldTransform = painter->worldTransform();
+
+    painter->translate(rect.topLeft());
+    painter->scale(1.0 / zoom, 1.0 / zoom);
+    painter->drawPixmap(PointF(), pixmap);
+
+    painter->setWorldTransform(worldTransform);
+}
+
+void PageTileCache::requestTile(const TileKey& key, const PageDisplayList& displayList)
+{
+    auto it = m_pendingTiles.find(key);
+    if (it != m_pendingTiles.end()) {
+        it->second.frame = m_frame;
+        return;
+    }
+
+    if (m_pendingTiles.size() >= MAX_PENDING_TILES) {
+        return;
+    }
+
+    PendingTile pendingTile;
+    pendingTile.cancelled = std::make_shared<std::atomic<bool> >(false);
+    pendingTile.frame = m_frame;
+    m_pendingTiles.emplace(key, pendingTile);
+
+    async::Channel<RenderedTile> tileRendered = m_tileRendered;
+    std::shared_ptr<std::atomic<bool> > cancelled = pendingTile.cancelled;
+    const qreal zoom = bucketZoom(key.zoomBucket);
+    const RectF rect = tileRect(key.column, key.row, zoom);
+
+    QtConcurrent::run([key, displayList, zoom, rect, tileRendered, cancelled]() mutable {
+        //! NOTE The tile was cancelled while it was queued
+        if (*cancelled) {
+            return;
+        }
+
+        QImage image(TILE_SIZE, TILE_SIZE, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::transparent);
+
+        {
+            draw::Painter painter(&image, "pagetile");
+            painter.setAntialiasing(true);
+            painter.scale(zoom, zoom);
+            painter.translate(-rect.x(), -rect.y());
+            displayList.paint(painter, rect);
+            painter.endDraw();
+        }
+
+        tileRendered.send(RenderedTile { key, image });
+    });
+}
+
+void PageTileCache::onTileRendered(const RenderedTile& tile)
+{
+    auto it = m_pendingTiles.find(tile.key);
+    if (it == m_pendingTiles.end()) {
+        //! NOTE The tile was cancelled while it was rendering
+        return;
+    }
+
+    m_pendingTiles.erase(it);
+
+    //! NOTE The layout has changed while the tile was rendering
+    if (tile.key.generation != pageGeneration(tile.key.page)) {
+        return;
+    }
+
+    insertTile(tile.key, QPixmap::fromImage(tile.image));
+    evictTiles();
+
+    m_tilesReady.notify();
+}
+
+void PageTileCache::insertTile(const TileKey& key, const QPixmap& pixmap)
+{
+    auto it = m_tiles.find(key);
+    if (it != m_tiles.end()) {
+        removeTile(it);
+    }
+
+    m_lru.push_front(key);
+
+    Tile tile;
+    tile.pixmap = pixmap;
+    tile.lruIt = m_lru.begin();
+    m_tiles.emplace(key, std::move(tile));
+
+    m_memoryUsage += static_cast<size_t>(pixmap.width()) * pixmap.height() * 4;
+}
+
+void PageTileCache::removeTile(std::map<TileKey, Tile>::iterator it)
+{
+    const QPixmap& pixmap = it->second.pixmap;
+    m_memoryUsage -= static_cast<size_t>(pixmap.width()) * pixmap.height() * 4;
+
+    m_lru.erase(it->second.lruIt);
+    m_tiles.erase(it);
+}
+
+void PageTileCache::evictTiles()
+{
+    while (m_memoryUsage > m_memoryLimit && !m_lru.empty()) {
+        auto it = m_tiles.find(m_lru.back());
+        IF_ASSERT_FAILED(it != m_tiles.end()) {
+            m_lru.pop_back();
+            continue;
+        }
+
+        removeTile(it);
+    }
+}
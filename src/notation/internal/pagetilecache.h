@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_PAGETILECACHE_H
+#define MU_NOTATION_PAGETILECACHE_H
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <tuple>
+
+#include <QImage>
+#include <QPixmap>
+
+#include <gtest/gtest_prod.h>
+
+#include "async/asyncable.h"
+#include "async/channel.h"
+#include "async/notification.h"
+
+#include "engraving/paint/pagedisplaylist.h"
+#include "infrastructure/draw/painter.h"
+
+namespace Ms {
+class Page;
+}
+
+namespace mu::notation {
+//! NOTE Cache of rasterized page tiles for the notation view.
+//! Tiles have a fixed size in device pixels and are keyed by page, scale bucket and layout generation.
+//! The scale (zoom by device pixel ratio) is rounded up to a power of √2, so small zoom steps reuse the tiles.
+//! They are rendered from the page display lists on the global thread pool,
+//! until a tile is ready the last complete scale is blitted scaled,
+//! or the display list is painted directly.
+class PageTileCache : public async::Asyncable
+{
+public:
+    PageTileCache();
+
+    static constexpr int TILE_SIZE = 256;
+    static constexpr size_t DEFAULT_MEMORY_LIMIT = 256 * 1024 * 1024;
+
+    void setMemoryLimit(size_t bytes);
+    size_t memoryLimit() const;
+    size_t memoryUsage() const;
+
+    void invalidate();
+    void invalidatePage(const Ms::Page* page);
+
+    //! NOTE All pages of a frame are painted between beginPaint() and endPaint(),
+    //! the tiles queued before, which were not requested by the frame, are cancelled
+    void beginPaint();
+    void endPaint();
+
+    //! NOTE The painter must be translated to the page position, the rect is in page coordinates.
+    //! Returns false if the page can't be painted from tiles (so it should be painted directly)
+    bool paint(draw::Painter* painter, const Ms::Page* page, const engraving::PageDisplayList& displayList, const RectF& rect);
+
+    async::Notification tilesReady() const;
+
+private:
+    friend class PageTileCacheTests;
+    FRIEND_TEST(PageTileCacheTests, ZoomBuckets);
+    FRIEND_TEST(PageTileCacheTests, InvalidatePage);
+    FRIEND_TEST(PageTileCacheTests, Invalidate);
+    FRIEND_TEST(PageTileCacheTests, StaleTileIsDropped);
+    FRIEND_TEST(PageTileCacheTests, CancelPendingTiles);
+    FRIEND_TEST(PageTileCacheTests, EvictLeastRecentlyUsed);
+
+    struct TileKey {
+        const Ms::Page* page = nullptr;
+        int zoomBucket = 0;
+        int column = 0;
+        int row = 0;
+        int generation = 0;
+
+        bool operator<(const TileKey& other) const
+        {
+            return std::tie(page, zoomBucket, generation, row, column)
+                   < std::tie(other.page, other.zoomBucket, other.generation, other.row, other.column);
+        }
+    };
+
+    struct Tile {
+        QPixmap pixmap;
+        std::list<TileKey>::iterator lruIt;
+    };
+
+    struct PendingTile {
+        std::shared_ptr<std::atomic<bool> > cancelled;
+        int frame = 0;
+    };
+
+    struct RenderedTile {
+        TileKey key;
+        QImage image;
+    };
+
+    static int zoomBucket(qreal scale);
+    static qreal bucketZoom(int bucket);
+    static RectF tileRect(int column, int row, qreal zoom);
+    static qreal devicePixelRatio(const draw::Painter* painter);
+
+    int pageGeneration(const Ms::Page* page) const;
+
+    const Tile* findTile(const TileKey& key);
+    bool paintFallback(draw::Painter* painter, const TileKey& key, const RectF& rect);
+    void paintTile(draw::Painter* painter, const QPixmap& pixmap, const TileKey& key);
+    void requestTile(const TileKey& key, const engraving::PageDisplayList& displayList);
+    void onTileRendered(const RenderedTile& tile);
+
+    template<typename Predicate>
+    void cancelPendingTiles(Predicate isCancelled);
+
+    void insertTile(const TileKey& key, const QPixmap& pixmap);
+    void removeTile(std::map<TileKey, Tile>::iterator it);
+    void evictTiles();
+
+    std::map<TileKey, Tile> m_tiles;
+    std::list<TileKey> m_lru; // most recently used first
+    std::map<TileKey, PendingTile> m_pendingTiles;
+    std::map<const Ms::Page*, int> m_pageGenerations;
+    std::map<const Ms::Page*, int> m_lastPaintedBuckets;
+
+    int m_generation = 0;
+    int m_baseGeneration = 0;
+    int m_frame = 0;
+    size_t m_memoryUsage = 0;
+    size_t m_memoryLimit = DEFAULT_MEMORY_LIMIT;
+
+    async::Channel<RenderedTile> m_tileRendered;
+    async::Notification m_tilesReady;
+};
+}
+
+#endif // MU_NOTATION_PAGETILECACHE_H
@@ -209,10 +209,10 @@ void NotationModule::onInit(const framework::IApplication::RunMode& mode)
 {
     s_configuration->init();
     s_instrumentsRepository->init();
-    s_actionController->init();
-    s_notationUiActions->init();
 
     if (mode == framework::IApplication::RunMode::Editor) {
+        s_actionController->init();
+        s_notationUiActions->init();
         s_midiInputController->init();
     }
 
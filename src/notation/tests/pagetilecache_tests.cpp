@@ -0,0 +1,200 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+
+#include <QThreadPool>
+
+#include "notation/internal/pagetilecache.h"
+
+namespace mu::notation {
+class PageTileCacheTests : public ::testing::Test
+{
+public:
+    using TileKey = PageTileCache::TileKey;
+
+    //! NOTE The pages are only the keys of the tiles here, they are never dereferenced
+    static const Ms::Page* page(uintptr_t id)
+    {
+        return reinterpret_cast<const Ms::Page*>(id);
+    }
+
+    static QPixmap tilePixmap()
+    {
+        return QPixmap(PageTileCache::TILE_SIZE, PageTileCache::TILE_SIZE);
+    }
+
+    static size_t tileBytes()
+    {
+        return static_cast<size_t>(PageTileCache::TILE_SIZE) * PageTileCache::TILE_SIZE * 4;
+    }
+
+    static TileKey tileKey(const PageTileCache& cache, const Ms::Page* page, int column = 0, int row = 0, int bucket = 0)
+    {
+        return TileKey { page, bucket, column, row, cache.pageGeneration(page) };
+    }
+};
+
+TEST_F(PageTileCacheTests, ZoomBuckets)
+{
+    //! CHECK Close zooms share a bucket, the bucket scales are the powers of √2
+    EXPECT_EQ(PageTileCache::zoomBucket(1.0), 0);
+    EXPECT_EQ(PageTileCache::zoomBucket(1.1), 1);
+    EXPECT_EQ(PageTileCache::zoomBucket(1.2), 1);
+    EXPECT_EQ(PageTileCache::zoomBucket(std::sqrt(2.0)), 1);
+    EXPECT_EQ(PageTileCache::zoomBucket(0.5), -2);
+
+    //! CHECK The tiles are never rendered at a lower resolution than they are painted
+    for (qreal scale : { 0.1, 0.33, 0.75, 1.0, 1.25, 2.4, 3.0, 8.0 }) {
+        const qreal bucketScale = PageTileCache::bucketZoom(PageTileCache::zoomBucket(scale));
+        EXPECT_GE(bucketScale, scale * (1.0 - 1e-6));
+        EXPECT_LT(bucketScale, scale * std::sqrt(2.0));
+    }
+
+    //! CHECK The device pixel ratio 2 is two buckets up
+    EXPECT_EQ(PageTileCache::zoomBucket(1.2 * 2.0), PageTileCache::zoomBucket(1.2) + 2);
+}
+
+TEST_F(PageTileCacheTests, InvalidatePage)
+{
+    //! GIVEN The tiles of two pages
+    PageTileCache cache;
+    const TileKey keyA = tileKey(cache, page(1));
+    const TileKey keyB = tileKey(cache, page(2));
+    cache.insertTile(keyA, tilePixmap());
+    cache.insertTile(keyB, tilePixmap());
+    ASSERT_EQ(cache.memoryUsage(), 2 * tileBytes());
+
+    //! DO Invalidate the first page
+    cache.invalidatePage(page(1));
+
+    //! CHECK Only the tiles of the first page are removed and the page has a new generation
+    EXPECT_FALSE(cache.findTile(keyA));
+    EXPECT_TRUE(cache.findTile(keyB));
+    EXPECT_EQ(cache.memoryUsage(), tileBytes());
+    EXPECT_NE(cache.pageGeneration(page(1)), keyA.generation);
+    EXPECT_EQ(cache.pageGeneration(page(2)), keyB.generation);
+}
+
+TEST_F(PageTileCacheTests, Invalidate)
+{
+    //! GIVEN The tiles of two pages
+    PageTileCache cache;
+    const TileKey keyA = tileKey(cache, page(1));
+    const TileKey keyB = tileKey(cache, page(2), 1, 1);
+    cache.insertTile(keyA, tilePixmap());
+    cache.insertTile(keyB, tilePixmap());
+
+    //! DO Invalidate the cache
+    cache.invalidate();
+
+    //! CHECK All tiles are removed and all pages have a new generation
+    EXPECT_FALSE(cache.findTile(keyA));
+    EXPECT_FALSE(cache.findTile(keyB));
+    EXPECT_EQ(cache.memoryUsage(), 0u);
+    EXPECT_NE(cache.pageGeneration(page(1)), keyA.generation);
+    EXPECT_NE(cache.pageGeneration(page(2)), keyB.generation);
+}
+
+TEST_F(PageTileCacheTests, StaleTileIsDropped)
+{
+    //! GIVEN A tile that is rendering
+    PageTileCache cache;
+    const TileKey key = tileKey(cache, page(1));
+    cache.m_pendingTiles[key].cancelled = std::make_shared<std::atomic<bool> >(false);
+
+    //! DO The page layout changes, then the tile is rendered
+    cache.invalidatePage(page(1));
+
+    QImage image(PageTileCache::TILE_SIZE, PageTileCache::TILE_SIZE, QImage::Format_ARGB32_Premultiplied);
+    cache.onTileRendered(PageTileCache::RenderedTile { key, image });
+
+    //! CHECK The tile of the old layout is not cached
+    EXPECT_FALSE(cache.findTile(key));
+    EXPECT_EQ(cache.memoryUsage(), 0u);
+    EXPECT_TRUE(cache.m_pendingTiles.empty());
+}
+
+TEST_F(PageTileCacheTests, CancelPendingTiles)
+{
+    //! GIVEN The tiles of two zooms, queued in the previous frames
+    PageTileCache cache;
+    const engraving::PageDisplayList displayList;
+    const TileKey oldZoomKey = tileKey(cache, page(1), 0, 0, 1);
+    const TileKey newZoomKey = tileKey(cache, page(1), 0, 0, 2);
+
+    cache.beginPaint();
+    cache.requestTile(oldZoomKey, displayList);
+    cache.endPaint();
+
+    ASSERT_EQ(cache.m_pendingTiles.size(), 1u);
+    std::shared_ptr<std::atomic<bool> > oldZoomCancelled = cache.m_pendingTiles.at(oldZoomKey).cancelled;
+
+    //! DO Paint a frame which needs only the tile of the new zoom
+    cache.beginPaint();
+    cache.requestTile(newZoomKey, displayList);
+    cache.endPaint();
+
+    //! CHECK The tile of the old zoom is cancelled, the new one stays queued
+    EXPECT_TRUE(*oldZoomCancelled);
+    EXPECT_EQ(cache.m_pendingTiles.count(oldZoomKey), 0u);
+    EXPECT_EQ(cache.m_pendingTiles.count(newZoomKey), 1u);
+
+    //! DO Invalidate the page
+    std::shared_ptr<std::atomic<bool> > newZoomCancelled = cache.m_pendingTiles.at(newZoomKey).cancelled;
+    cache.invalidatePage(page(1));
+
+    //! CHECK Its queued tiles are cancelled
+    EXPECT_TRUE(*newZoomCancelled);
+    EXPECT_TRUE(cache.m_pendingTiles.empty());
+
+    //! NOTE The tiles may still be rendered, wait for them before the cache is destroyed
+    QThreadPool::globalInstance()->waitForDone();
+}
+
+TEST_F(PageTileCacheTests, EvictLeastRecentlyUsed)
+{
+    //! GIVEN The cache for two tiles, with two tiles
+    PageTileCache cache;
+    cache.setMemoryLimit(2 * tileBytes());
+
+    const TileKey key1 = tileKey(cache, page(1), 0, 0);
+    const TileKey key2 = tileKey(cache, page(1), 1, 0);
+    const TileKey key3 = tileKey(cache, page(1), 2, 0);
+    cache.insertTile(key1, tilePixmap());
+    cache.insertTile(key2, tilePixmap());
+
+    //! DO Use the first tile, then add the third one
+    EXPECT_TRUE(cache.findTile(key1));
+    cache.insertTile(key3, tilePixmap());
+    cache.evictTiles();
+
+    //! CHECK The least recently used tile is evicted
+    EXPECT_TRUE(cache.findTile(key1));
+    EXPECT_FALSE(cache.findTile(key2));
+    EXPECT_TRUE(cache.findTile(key3));
+    EXPECT_EQ(cache.memoryUsage(), 2 * tileBytes());
+}
+}
@@ -180,6 +180,7 @@ void NotationPaintView::onCurrentNotationChanged()
     TRACEFUNC;
     if (m_notation) {
         m_notation->notationChanged().resetOnNotify(this);
+        m_notation->painting()->repaintRequested().resetOnNotify(this);
         INotationInteractionPtr interaction = m_notation->interaction();
         interaction->noteInput()->stateChanged().resetOnNotify(this);
         interaction->selectionChanged().resetOnNotify(this);
@@ -204,6 +205,10 @@ void NotationPaintView::onCurrentNotationChanged()
         update();
     });
 
+    m_notation->painting()->repaintRequested().onNotify(this, [this]() {
+        update();
+    });
+
     onNoteInputModeChanged();
     onSelectionChanged();
 
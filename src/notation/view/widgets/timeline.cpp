@@ -22,8 +22,14 @@
 
 #include "timeline.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include <QGraphicsSceneHoverEvent>
 #include <QGraphicsTextItem>
 #include <QMenu>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
 #include <QScrollBar>
 #include <QTextDocument>
 #include <QMouseEvent>
@@ -698,6 +704,71 @@ QString TRowLabels::cursorIsOn()
     }
 }
 
+//---------------------------------------------------------
+//   TGridItem
+//---------------------------------------------------------
+
+TGridItem::TGridItem(Timeline* timeline)
+    : _timeline(timeline)
+{
+    setAcceptHoverEvents(true);
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+    setData(Timeline::keyItemType, QVariant::fromValue(Timeline::ItemType::TYPE_MEASURE));
+}
+
+void TGridItem::setRect(const QRectF& rect)
+{
+    if (_rect == rect) {
+        return;
+    }
+    prepareGeometryChange();
+    _rect = rect;
+}
+
+QRectF TGridItem::boundingRect() const
+{
+    return _rect;
+}
+
+//---------------------------------------------------------
+//   TGridItem::paint
+//---------------------------------------------------------
+
+void TGridItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*)
+{
+    int firstCol = 0;
+    int firstRow = 0;
+    int lastCol = 0;
+    int lastRow = 0;
+    const QRectF exposedRect = option->exposedRect.intersected(_rect);
+    if (exposedRect.isEmpty()
+        || !_timeline->cellAt(exposedRect.topLeft(), firstCol, firstRow)
+        || !_timeline->cellAt(exposedRect.bottomRight() - QPointF(0.5, 0.5), lastCol, lastRow)) {
+        return;
+    }
+
+    const int numMetas = _timeline->nmetas();
+    painter->setPen(QPen(_timeline->activeTheme().backgroundColor));
+
+    for (int col = firstCol; col <= lastCol; ++col) {
+        for (int row = firstRow; row <= lastRow; ++row) {
+            painter->setBrush(_timeline->cellColor(col, row));
+            painter->drawRect(_timeline->getMeasureRect(col, row, numMetas));
+        }
+    }
+}
+
+void TGridItem::hoverMoveEvent(QGraphicsSceneHoverEvent* event)
+{
+    int col = 0;
+    int row = 0;
+    if (_timeline->cellAt(event->pos(), col, row)) {
+        setToolTip(_timeline->cellToolTip(col, row));
+    } else {
+        setToolTip(QString());
+    }
+}
+
 //---------------------------------------------------------
 //   Timeline
 //---------------------------------------------------------
@@ -950,7 +1021,7 @@ bool Timeline::handleEvent(QEvent* e)
 //   Timeline::drawGrid
 //---------------------------------------------------------
 
-void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int endMeasure)
+void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int endMeasure, int startStaff, int endStaff)
 {
     TRACEFUNC;
 
@@ -961,32 +1032,16 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         endMeasure = startMeasure;
     }
 
-    const bool rebuildAll = (
-        gridRows != globalRows || gridCols != globalCols
-        || (startMeasure == 0 && 2 * (endMeasure - startMeasure) > globalCols)  // rebuild all if more than half of score has changed
-        );
-    const bool rebuildPartial = !rebuildAll && (startMeasure >= 0);
-
+    const bool rebuildAll = gridRows != globalRows || gridCols != globalCols;
     const unsigned numMetas = nmetas();
 
     if (rebuildAll) {
         clearScene();
         startMeasure = 0;
         endMeasure = globalCols;
+        startStaff = -1;
+        endStaff = -1;
     } else {
-        if (rebuildPartial) {
-            const QRectF replacedRect
-                = getMeasureRect(startMeasure, 0, numMetas) | getMeasureRect(endMeasure - 1, globalRows - 1, numMetas);
-            const QList<QGraphicsItem*> replacedItems = scene()->items(replacedRect, Qt::ContainsItemShape);
-            for (QGraphicsItem* item : replacedItems) {
-                if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_MEASURE) {
-                    continue;
-                }
-                scene()->removeItem(item);
-                delete item;
-            }
-        }
-
         // Meta rows are still rebuilt from scratch, remove old meta rows manually
         const QList<QGraphicsItem*> items = scene()->items();
         for (QGraphicsItem* item : items) {
@@ -1000,55 +1055,42 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
 
     _metaRows.clear();
 
+    gridRows = globalRows;
+    gridCols = globalCols;
+
     if (globalRows == 0 || globalCols == 0) {
         return;
     }
 
-    int stagger = 0;
-    setMinimumHeight(_gridHeight * (numMetas + 1) + 5 + horizontalScrollBar()->height());
-    setMinimumWidth(_gridWidth * 3);
-    _globalZValue = 1;
+    _gridMeasures.clear();
+    _gridMeasures.reserve(globalCols);
+    for (Measure* m = score()->firstMeasure(); m; m = m->nextMeasure()) {
+        _gridMeasures.push_back(m);
+    }
 
-    // Draw grid
-    Measure* currMeasure = score()->firstMeasure();
-    for (int i = 0; i < startMeasure; ++i) {
-        currMeasure = currMeasure->nextMeasure();
+    if (rebuildAll) {
+        _occupancy.assign(size_t(globalCols) * globalRows, false);
+        _selectedCells.assign(size_t(globalCols) * globalRows, false);
     }
 
-    QList<Part*> partList = getParts();
+    // only the cells of the changed range are updated, the others are kept from the previous commands
+    if (startMeasure >= 0) {
+        updateOccupancy(startMeasure, endMeasure, startStaff, endStaff);
+    }
 
-    for (int col = startMeasure; col < endMeasure; col++) {
-        for (int row = 0; row < globalRows; row++) {
-            QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
-            graphicsRectItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
-
-            setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
-
-            QString translateMeasure = tr("Measure");
-            QChar initialLetter = translateMeasure[0];
-            QTextDocument doc;
-            QString partName = "";
-            if (partList.size() > row) {
-                doc.setHtml(partList.at(row)->longName());
-                partName = doc.toPlainText();
-                if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
-                    doc.setHtml(partList.at(row)->partName());
-                    partName = doc.toPlainText();
-                }
-                if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
-                    partName = partList.at(row)->instrumentName();
-                }
-            }
+    if (!_gridItem) {
+        _gridItem = new TGridItem(this);
+        _gridItem->setZValue(-3);
+        scene()->addItem(_gridItem);
+    }
+    _gridItem->setRect(getMeasureRect(0, 0, numMetas) | getMeasureRect(globalCols - 1, globalRows - 1, numMetas));
+    _gridItem->update();
 
-            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
-            graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
-            graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
-            graphicsRectItem->setZValue(-3);
-            scene()->addItem(graphicsRectItem);
-        }
+    int stagger = 0;
+    setMinimumHeight(_gridHeight * (numMetas + 1) + 5 + horizontalScrollBar()->height());
+    setMinimumWidth(_gridWidth * 3);
+    _globalZValue = 1;
 
-        currMeasure = currMeasure->nextMeasure();
-    }
     setSceneRect(0, 0, getWidth(), getHeight());
 
     // Draw meta rows and separator
@@ -1161,9 +1203,108 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         xPos += _gridWidth;
         std::get<4>(_repeatInfo) = false;
     }
+}
 
-    gridRows = globalRows;
-    gridCols = globalCols;
+//---------------------------------------------------------
+//   Timeline::updateOccupancy
+//---------------------------------------------------------
+
+void Timeline::updateOccupancy(int startMeasure, int endMeasure, int startStaff, int endStaff)
+{
+    TRACEFUNC;
+
+    startMeasure = std::max(startMeasure, 0);
+    endMeasure = std::min(endMeasure, gridCols);
+    if (startStaff < 0 || endStaff < 0) {
+        startStaff = 0;
+        endStaff = gridRows - 1;
+    }
+    startStaff = std::max(startStaff, 0);
+    endStaff = std::min(endStaff, gridRows - 1);
+
+    for (int col = startMeasure; col < endMeasure; ++col) {
+        const Measure* measure = _gridMeasures.at(col);
+        for (int row = startStaff; row <= endStaff; ++row) {
+            _occupancy[cellIndex(col, row)] = isOccupied(measure, row);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   Timeline::isOccupied
+//---------------------------------------------------------
+
+bool Timeline::isOccupied(const Measure* measure, int staff) const
+{
+    for (Segment* seg = measure->first(SegmentType::ChordRest); seg; seg = seg->next(SegmentType::ChordRest)) {
+        for (int track = staff * VOICES; track < staff * VOICES + VOICES; track++) {
+            ChordRest* chordRest = seg->cr(track);
+            if (chordRest) {
+                ElementType crt = chordRest->type();
+                if (crt == ElementType::CHORD || crt == ElementType::MEASURE_REPEAT) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//   Timeline::cellAt
+//---------------------------------------------------------
+
+bool Timeline::cellAt(const QPointF& scenePt, int& col, int& row) const
+{
+    if (gridCols <= 0 || gridRows <= 0 || _gridMeasures.empty()) {
+        return false;
+    }
+
+    const QRectF topLeftRect = getMeasureRect(0, 0, nmetas());
+    col = int(std::floor((scenePt.x() - topLeftRect.left()) / _gridWidth));
+    row = int(std::floor((scenePt.y() - topLeftRect.top()) / _gridHeight));
+
+    return col >= 0 && col < int(_gridMeasures.size()) && row >= 0 && row < gridRows;
+}
+
+//---------------------------------------------------------
+//   Timeline::cellColor
+//---------------------------------------------------------
+
+QColor Timeline::cellColor(int col, int row) const
+{
+    const size_t idx = cellIndex(col, row);
+    QColor color = _occupancy.at(idx) ? activeTheme().colorBoxColor : QColor(224, 224, 224);
+    if (_selectedCells.at(idx)) {
+        color.setBlue(255);
+    }
+    return color;
+}
+
+//---------------------------------------------------------
+//   Timeline::cellToolTip
+//---------------------------------------------------------
+
+QString Timeline::cellToolTip(int col, int row)
+{
+    QString translateMeasure = tr("Measure");
+    QChar initialLetter = translateMeasure[0];
+    QTextDocument doc;
+    QString partName = "";
+    QList<Part*> partList = getParts();
+    if (partList.size() > row) {
+        doc.setHtml(partList.at(row)->longName());
+        partName = doc.toPlainText();
+        if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
+            doc.setHtml(partList.at(row)->partName());
+            partName = doc.toPlainText();
+        }
+        if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
+            partName = partList.at(row)->instrumentName();
+        }
+    }
+
+    return initialLetter + QString(" ") + QString::number(_gridMeasures.at(col)->no() + 1) + QString(", ") + partName;
 }
 
 //---------------------------------------------------------
@@ -1844,6 +1985,12 @@ void Timeline::clearScene()
     nonVisiblePathItem = nullptr;
     visiblePathItem = nullptr;
     selectionItem = nullptr;
+    _gridItem = nullptr;
+
+    // the cells are rebuilt with the next drawGrid()
+    gridRows = 0;
+    gridCols = 0;
+    _gridMeasures.clear();
 }
 
 //---------------------------------------------------------
@@ -2042,8 +2189,35 @@ void Timeline::drawSelection()
         }
     }
 
+    std::map<const Measure*, int> measureColumns;
+    for (int col = 0; col < int(_gridMeasures.size()); ++col) {
+        measureColumns.emplace(_gridMeasures.at(col), col);
+    }
+
+    std::fill(_selectedCells.begin(), _selectedCells.end(), false);
+    const int numMetas = nmetas();
+    for (const auto& selected : metaLabelsSet) {
+        const int stave = std::get<1>(selected);
+        if (stave < 0 || stave >= gridRows || std::get<2>(selected) != ElementType::INVALID) {
+            continue;
+        }
+        auto colIt = measureColumns.find(std::get<0>(selected));
+        if (colIt == measureColumns.end()) {
+            continue;
+        }
+        const int col = colIt->second;
+        _selectedCells[cellIndex(col, stave)] = true;
+        _selectionPath.addRect(getMeasureRect(col, stave, numMetas));
+    }
+    if (_gridItem) {
+        _gridItem->update();
+    }
+
     const QList<QGraphicsItem*> graphicsItemList = scene()->items();
     for (QGraphicsItem* graphicsItem : graphicsItemList) {
+        if (graphicsItem->data(keyItemType).value<ItemType>() != ItemType::TYPE_META) {
+            continue;
+        }
         int stave = graphicsItem->data(0).value<int>();
         ElementType elementType = graphicsItem->data(1).value<ElementType>();
         Measure* measure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
@@ -2085,20 +2259,6 @@ void Timeline::drawSelection()
                 }
             }
         }
-        // Change color from gray to only blue
-        else if (it != metaLabelsSet.end()) {
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            graphicsRectItem->setBrush(QBrush(QColor(graphicsRectItem->brush().color().red(),
-                                                     graphicsRectItem->brush().color().green(),
-                                                     255)));
-            _selectionPath.addRect(graphicsRectItem->rect());
-        } else {
-            // Ensure unselected measures are not marked selected
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            if (graphicsRectItem && graphicsRectItem->data(keyItemType).value<ItemType>() == ItemType::TYPE_MEASURE) {
-                graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
-            }
-        }
     }
 
     if (selectionItem) {
@@ -2158,7 +2318,16 @@ void Timeline::mousePressEvent(QMouseEvent* event)
             maxZValue = graphicsItem->zValue();
         }
     }
-    if (currGraphicsItem) {
+
+    int col = 0;
+    int row = 0;
+    if (!currGraphicsItem && cellAt(scenePt, col, row)) {
+        if (numToStaff(row) && !numToStaff(row)->show()) {
+            return;
+        }
+        // Handle cell clicks
+        selectCell(_gridMeasures.at(col), row, event->modifiers());
+    } else if (currGraphicsItem) {
         int stave = currGraphicsItem->data(0).value<int>();
         Measure* currMeasure = static_cast<Measure*>(currGraphicsItem->data(2).value<void*>());
         if (numToStaff(stave) && !numToStaff(stave)->show()) {
@@ -2166,40 +2335,17 @@ void Timeline::mousePressEvent(QMouseEvent* event)
         }
 
         if (!currMeasure) {
-            int nmeta = nmetas();
-            int bottomOfMeta = nmeta * _gridHeight + verticalScrollBar()->value();
-
-            // Handle measure box clicks
-            if (scenePt.y() > (nmeta - 1) * _gridHeight + verticalScrollBar()->value()
-                && scenePt.y() < bottomOfMeta) {
-                QRectF tmp(scenePt.x(), 0, 3, nmeta * _gridHeight + nstaves() * _gridHeight);
-                QList<QGraphicsItem*> gl = scene()->items(tmp);
-                Measure* measure = nullptr;
-
-                for (QGraphicsItem* graphicsItem : gl) {
-                    measure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-                    //-3 z value is the grid square values
-                    if (graphicsItem->zValue() == -3 && measure) {
-                        break;
-                    }
-                }
-            }
+            int bottomOfMeta = nmetas() * _gridHeight + verticalScrollBar()->value();
             if (scenePt.y() < bottomOfMeta) {
                 return;
             }
 
-            QList<QGraphicsItem*> gl = items(event->pos());
-            for (QGraphicsItem* graphicsItem : gl) {
-                currMeasure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-                stave = graphicsItem->data(0).value<int>();
-                if (currMeasure) {
-                    break;
-                }
-            }
-            if (!currMeasure) {
+            if (!cellAt(scenePt, col, row)) {
                 interaction()->clearSelection();
                 return;
             }
+            currMeasure = _gridMeasures.at(col);
+            stave = row;
         }
 
         bool metaValueClicked = currGraphicsItem->data(3).value<bool>();
@@ -2272,45 +2418,54 @@ void Timeline::mousePressEvent(QMouseEvent* event)
             }
         } else {
             // Handle cell clicks
-            if (event->modifiers() == Qt::ShiftModifier) {
-                if (currMeasure->mmRest()) {
-                    currMeasure = currMeasure->mmRest();
-                } else if (currMeasure->mmRestCount() == -1) {
-                    currMeasure = currMeasure->prevMeasureMM();
-                }
+            selectCell(currMeasure, stave, event->modifiers());
+        }
+    } else {
+        interaction()->clearSelection();
+    }
+}
 
-                if (currMeasure) {
-                    interaction()->select({ currMeasure }, SelectType::RANGE, stave);
-                }
-            } else if (event->modifiers() == Qt::ControlModifier) {
-                if (interaction()->selection()->isNone()) {
-                    if (currMeasure->mmRest()) {
-                        currMeasure = currMeasure->mmRest();
-                    } else if (currMeasure->mmRestCount() == -1) {
-                        currMeasure = currMeasure->prevMeasureMM();
-                    }
+//---------------------------------------------------------
+//   Timeline::selectCell
+//---------------------------------------------------------
 
-                    if (currMeasure) {
-                        interaction()->select({ currMeasure }, SelectType::RANGE, 0);
-                        interaction()->select({ currMeasure }, SelectType::RANGE, score()->nstaves() - 1);
-                    }
-                } else {
-                    interaction()->clearSelection();
-                }
-            } else {
-                if (currMeasure->mmRest()) {
-                    currMeasure = currMeasure->mmRest();
-                } else if (currMeasure->mmRestCount() == -1) {
-                    currMeasure = currMeasure->prevMeasureMM();
-                }
+void Timeline::selectCell(Measure* measure, int staff, Qt::KeyboardModifiers modifiers)
+{
+    if (modifiers == Qt::ShiftModifier) {
+        if (measure->mmRest()) {
+            measure = measure->mmRest();
+        } else if (measure->mmRestCount() == -1) {
+            measure = measure->prevMeasureMM();
+        }
+
+        if (measure) {
+            interaction()->select({ measure }, SelectType::RANGE, staff);
+        }
+    } else if (modifiers == Qt::ControlModifier) {
+        if (interaction()->selection()->isNone()) {
+            if (measure->mmRest()) {
+                measure = measure->mmRest();
+            } else if (measure->mmRestCount() == -1) {
+                measure = measure->prevMeasureMM();
+            }
 
-                if (currMeasure) {
-                    interaction()->select({ currMeasure }, SelectType::SINGLE, stave);
-                }
+            if (measure) {
+                interaction()->select({ measure }, SelectType::RANGE, 0);
+                interaction()->select({ measure }, SelectType::RANGE, score()->nstaves() - 1);
             }
+        } else {
+            interaction()->clearSelection();
         }
     } else {
-        interaction()->clearSelection();
+        if (measure->mmRest()) {
+            measure = measure->mmRest();
+        } else if (measure->mmRestCount() == -1) {
+            measure = measure->prevMeasureMM();
+        }
+
+        if (measure) {
+            interaction()->select({ measure }, SelectType::SINGLE, staff);
+        }
     }
 }
 
@@ -2383,52 +2538,20 @@ void Timeline::mouseReleaseEvent(QMouseEvent*)
         scene()->removeItem(_selectionBox);
         interaction()->clearSelection();
 
-        int width, height;
-        QPoint loc = mapFromScene(_selectionBox->rect().topLeft());
-        width = int(_selectionBox->rect().width());
-        height = int(_selectionBox->rect().height());
-
-        QList<QGraphicsItem*> graphicsItemList = items(QRect(loc.x(), loc.y(), width, height));
-        // Find top left and bottom right to create selection
-        QGraphicsItem* tlGraphicsItem = nullptr;
-        QGraphicsItem* brGraphicsItem = nullptr;
-        for (QGraphicsItem* graphicsItem : graphicsItemList) {
-            Measure* currMeasure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-            if (!currMeasure) {
-                continue;
-            }
-            int stave = graphicsItem->data(0).value<int>();
-            if (stave == -1) {
-                continue;
-            }
-
-            if (!tlGraphicsItem && !brGraphicsItem) {
-                tlGraphicsItem = graphicsItem;
-                brGraphicsItem = graphicsItem;
-                continue;
-            }
-
-            if (graphicsItem->boundingRect().top() < tlGraphicsItem->boundingRect().top()) {
-                tlGraphicsItem = graphicsItem;
-            }
-            if (graphicsItem->boundingRect().left() < tlGraphicsItem->boundingRect().left()) {
-                tlGraphicsItem = graphicsItem;
-            }
-
-            if (graphicsItem->boundingRect().bottom() > brGraphicsItem->boundingRect().bottom()) {
-                brGraphicsItem = graphicsItem;
-            }
-            if (graphicsItem->boundingRect().right() > brGraphicsItem->boundingRect().right()) {
-                brGraphicsItem = graphicsItem;
-            }
-        }
-
-        // Select single tlGraphicsItem and then range brGraphicsItem
-        if (tlGraphicsItem && brGraphicsItem) {
-            Measure* tlMeasure = static_cast<Measure*>(tlGraphicsItem->data(2).value<void*>());
-            int tlStave = tlGraphicsItem->data(0).value<int>();
-            Measure* brMeasure = static_cast<Measure*>(brGraphicsItem->data(2).value<void*>());
-            int brStave = brGraphicsItem->data(0).value<int>();
+        // Find top left and bottom right cells to create selection
+        const QRectF gridRect = _gridItem ? _gridItem->boundingRect() : QRectF();
+        const QRectF lassoRect = _selectionBox->rect().intersected(gridRect);
+        int tlCol = 0;
+        int tlRow = 0;
+        int brCol = 0;
+        int brRow = 0;
+        if (!lassoRect.isEmpty()
+            && cellAt(lassoRect.topLeft(), tlCol, tlRow)
+            && cellAt(lassoRect.bottomRight() - QPointF(0.5, 0.5), brCol, brRow)) {
+            Measure* tlMeasure = _gridMeasures.at(tlCol);
+            int tlStave = tlRow;
+            Measure* brMeasure = _gridMeasures.at(brCol);
+            int brStave = brRow;
             if (tlMeasure && brMeasure) {
                 // Focus selection of mmRests here
                 if (tlMeasure->mmRest()) {
@@ -2544,12 +2667,12 @@ void Timeline::changeEvent(QEvent* event)
 //   Timeline::updateGrid
 //---------------------------------------------------------
 
-void Timeline::updateGrid(int startMeasure, int endMeasure)
+void Timeline::updateGrid(int startMeasure, int endMeasure, int startStaff, int endStaff)
 {
     TRACEFUNC;
 
     if (score() && score()->firstMeasure()) {
-        drawGrid(nstaves(), score()->nmeasures(), startMeasure, endMeasure);
+        drawGrid(nstaves(), score()->nmeasures(), startMeasure, endMeasure, startStaff, endStaff);
         updateView();
         drawSelection();
         mouseOver(mapToScene(mapFromGlobal(QCursor::pos())));
@@ -2586,7 +2709,13 @@ void Timeline::updateGridFromCmdState()
     const Measure* endMeasure = layoutAll ? nullptr : score()->tick2measure(cState.endTick());
     const int endMeasureIndex = endMeasure ? (endMeasure->measureIndex() + 1) : score()->nmeasures();
 
-    updateGrid(startMeasureIndex, endMeasureIndex);
+    // the staves of the command state are the staves of the master score,
+    // -1 if the command hasn't set them, then all staves are updated
+    const bool staffRange = !layoutAll && score()->isMaster();
+    const int startStaff = staffRange ? cState.startStaff() : -1;
+    const int endStaff = staffRange ? cState.endStaff() : -1;
+
+    updateGrid(startMeasureIndex, endMeasureIndex, startStaff, endStaff);
 }
 
 //---------------------------------------------------------
@@ -2752,31 +2881,6 @@ int Timeline::nstaves() const
     return score()->staves().size();
 }
 
-//---------------------------------------------------------
-//   Timeline::colorBox
-//---------------------------------------------------------
-
-QColor Timeline::colorBox(QGraphicsRectItem* item)
-{
-    Measure* measure = static_cast<Measure*>(item->data(2).value<void*>());
-    int stave = item->data(0).value<int>();
-    for (Segment* seg = measure->first(); seg; seg = seg->next()) {
-        if (!seg->isChordRestType()) {
-            continue;
-        }
-        for (int track = stave * VOICES; track < stave * VOICES + VOICES; track++) {
-            ChordRest* chordRest = seg->cr(track);
-            if (chordRest) {
-                ElementType crt = chordRest->type();
-                if (crt == ElementType::CHORD || crt == ElementType::MEASURE_REPEAT) {
-                    return activeTheme().colorBoxColor;
-                }
-            }
-        }
-    }
-    return QColor(224, 224, 224);
-}
-
 //---------------------------------------------------------
 //   Timeline::getLabels
 //---------------------------------------------------------
@@ -3170,12 +3274,11 @@ QString Timeline::cursorIsOn(const QPoint& cursorPos)
     if (it != _metaRows.end()) {
         return "meta";
     }
-    QList<QGraphicsItem*> graphicsItemList = scene()->items(cursorPos);
-    for (QGraphicsItem* currGraphicsItem : graphicsItemList) {
-        Measure* currMeasure = static_cast<Measure*>(currGraphicsItem->data(2).value<void*>());
-        int stave = currGraphicsItem->data(0).value<int>();
-        const Staff* st = numToStaff(stave);
-        if (currMeasure && !(st && st->show())) {
+    int col = 0;
+    int row = 0;
+    if (cellAt(cursorPos, col, row)) {
+        const Staff* st = numToStaff(row);
+        if (!(st && st->show())) {
             return "invalid";
         }
     }
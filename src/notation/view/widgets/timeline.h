@@ -32,6 +32,7 @@
 #include "actions/iactionsdispatcher.h"
 
 #include <vector>
+#include <QGraphicsItem>
 #include <QGraphicsView>
 #include <QSplitter>
 
@@ -102,6 +103,30 @@ public:
     QString cursorIsOn();
 };
 
+//---------------------------------------------------------
+//   TGridItem
+//    the staff x measure cells of the timeline,
+//    only the cells in the exposed rect are painted
+//---------------------------------------------------------
+
+class TGridItem : public QGraphicsItem
+{
+public:
+    TGridItem(Timeline* timeline);
+
+    void setRect(const QRectF& rect);
+
+    QRectF boundingRect() const override;
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+
+protected:
+    void hoverMoveEvent(QGraphicsSceneHoverEvent* event) override;
+
+private:
+    Timeline* _timeline { nullptr };
+    QRectF _rect;
+};
+
 //---------------------------------------------------------
 //   TimelineTheme
 //---------------------------------------------------------
@@ -143,6 +168,7 @@ public:
 
 private:
     friend class TRowLabels;
+    friend class TGridItem;
 
     enum class ViewState {
         NORMAL,
@@ -176,6 +202,12 @@ private:
     int gridRows = 0;
     int gridCols = 0;
 
+    TGridItem* _gridItem { nullptr };
+    std::vector<Measure*> _gridMeasures;
+    // one bit per cell, measure-major: the cell contains chords or measure repeats
+    std::vector<bool> _occupancy;
+    std::vector<bool> _selectedCells;
+
     QGraphicsPathItem* nonVisiblePathItem = nullptr;
     QGraphicsPathItem* visiblePathItem = nullptr;
     QGraphicsPathItem* selectionItem = nullptr;
@@ -224,14 +256,14 @@ private:
 
     QList<Part*> getParts();
 
-    QRectF getMeasureRect(int measureIndex, int row, int numMetas)
+    QRectF getMeasureRect(int measureIndex, int row, int numMetas) const
     {
         return QRectF(measureIndex * _gridWidth, _gridHeight * (row + numMetas) + 3, _gridWidth, _gridHeight);
     }
 
     void clearScene();
 
-    void updateGrid(int startMeasure = -1, int endMeasure = -1);
+    void updateGrid(int startMeasure = -1, int endMeasure = -1, int startStaff = -1, int endStaff = -1);
 
     mu::notation::INotationInteractionPtr interaction() const;
     Ms::Score* score() const;
@@ -256,7 +288,9 @@ private:
 
     void updateView();
     void drawSelection();
-    void drawGrid(int globalRows, int globalCols, int startMeasure = 0, int endMeasure = -1);
+    void drawGrid(int globalRows, int globalCols, int startMeasure = 0, int endMeasure = -1, int startStaff = -1, int endStaff = -1);
+    void updateOccupancy(int startMeasure, int endMeasure, int startStaff, int endStaff);
+    bool isOccupied(const Measure* measure, int staff) const;
 
     int nstaves() const;
 
@@ -266,7 +300,11 @@ private:
 
     void updateGridFull() { updateGrid(0, -1); }
 
-    QColor colorBox(QGraphicsRectItem* item);
+    size_t cellIndex(int col, int row) const { return size_t(col) * gridRows + row; }
+    bool cellAt(const QPointF& scenePt, int& col, int& row) const;
+    QColor cellColor(int col, int row) const;
+    QString cellToolTip(int col, int row);
+    void selectCell(Measure* measure, int staff, Qt::KeyboardModifiers modifiers);
 
     std::vector<std::pair<QString, bool> > getLabels();
 
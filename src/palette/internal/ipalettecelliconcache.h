@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_PALETTE_IPALETTECELLICONCACHE_H
+#define MU_PALETTE_IPALETTECELLICONCACHE_H
+
+#include <functional>
+
+#include <QByteArray>
+#include <QImage>
+
+#include "modularity/imoduleexport.h"
+
+#include "async/notification.h"
+
+namespace mu::palette {
+class IPaletteCellIconCache : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IPaletteCellIconCache)
+
+public:
+    virtual ~IPaletteCellIconCache() = default;
+
+    //! NOTE Is called on the main thread
+    using Renderer = std::function<QImage()>;
+
+    //! NOTE Can be called from the render thread.
+    //! Returns a null image if the icon isn't ready yet, then the icon is read from the disk cache
+    //! or rendered later and iconsReady is notified
+    virtual QImage icon(const QByteArray& key, const Renderer& renderer) = 0;
+
+    virtual void clear() = 0;
+
+    virtual async::Notification iconsReady() const = 0;
+};
+}
+
+#endif // MU_PALETTE_IPALETTECELLICONCACHE_H
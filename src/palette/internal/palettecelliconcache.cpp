@@ -0,0 +1,279 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "palettecelliconcache.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QSaveFile>
+#include <QTimer>
+#include <QtConcurrent>
+
+#include "async/async.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::palette;
+
+//! NOTE The rendering is done on the main thread, so it is split into slices
+static constexpr int RENDER_SLICE_MS = 8;
+
+//! NOTE Limits the model updates while the icons are being filled
+static constexpr int ICONS_READY_INTERVAL_MS = 100;
+
+void PaletteCellIconCache::init()
+{
+    m_iconRequested.onReceive(this, [this](const QByteArray& key) {
+        onIconRequested(key);
+    }, Asyncable::AsyncMode::AsyncSetRepeat);
+
+    m_iconLoaded.onReceive(this, [this](const LoadedIcon& icon) {
+        onIconLoaded(icon);
+    }, Asyncable::AsyncMode::AsyncSetRepeat);
+
+    if (!globalConfiguration()) {
+        return;
+    }
+
+    //! NOTE The icons depend on the engraving of the application version,
+    //! the icons of other versions are removed
+    const QString iconsDir = globalConfiguration()->userCachePath().toQString() + "/palette/icons";
+    const QString version = QCoreApplication::applicationVersion();
+    m_cacheDir = iconsDir + "/" + (version.isEmpty() ? QString("dev") : version);
+
+    QDir().mkpath(m_cacheDir);
+
+    const QString currentVersionDir = QFileInfo(m_cacheDir).fileName();
+    QtConcurrent::run([iconsDir, currentVersionDir]() {
+        const QStringList versionDirs = QDir(iconsDir).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+        for (const QString& versionDir : versionDirs) {
+            if (versionDir != currentVersionDir) {
+                QDir(iconsDir + "/" + versionDir).removeRecursively();
+            }
+        }
+    });
+}
+
+async::Notification PaletteCellIconCache::iconsReady() const
+{
+    return m_iconsReady;
+}
+
+QString PaletteCellIconCache::iconPath(const QByteArray& key) const
+{
+    if (m_cacheDir.isEmpty()) {
+        return QString();
+    }
+
+    return m_cacheDir + "/" + QString::fromLatin1(key.toHex()) + ".png";
+}
+
+QImage PaletteCellIconCache::icon(const QByteArray& key, const Renderer& renderer)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_icons.find(key);
+        if (it != m_icons.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+            return it->second.image;
+        }
+
+        if (m_pendingIcons.find(key) != m_pendingIcons.end()) {
+            return QImage();
+        }
+
+        m_pendingIcons.emplace(key, renderer);
+    }
+
+    m_iconRequested.send(key);
+
+    return QImage();
+}
+
+void PaletteCellIconCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_icons.clear();
+    m_lru.clear();
+    m_memoryUsage = 0;
+}
+
+void PaletteCellIconCache::onIconRequested(const QByteArray& key)
+{
+    const QString path = iconPath(key);
+    if (path.isEmpty()) {
+        onIconLoaded(LoadedIcon { key, QImage() });
+        return;
+    }
+
+    async::Channel<LoadedIcon> iconLoaded = m_iconLoaded;
+    QtConcurrent::run([key, path, iconLoaded]() mutable {
+        QImage image;
+        if (QFileInfo::exists(path)) {
+            image.load(path, "PNG");
+        }
+
+        iconLoaded.send(LoadedIcon { key, image });
+    });
+}
+
+void PaletteCellIconCache::onIconLoaded(const LoadedIcon& icon)
+{
+    if (icon.image.isNull()) {
+        m_renderQueue.push_back(icon.key);
+
+        if (!m_isRenderScheduled) {
+            m_isRenderScheduled = true;
+            async::Async::call(this, [this]() {
+                renderQueuedIcons();
+            });
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingIcons.erase(icon.key);
+        insertIcon(icon.key, icon.image);
+    }
+
+    scheduleIconsReady();
+}
+
+void PaletteCellIconCache::renderQueuedIcons()
+{
+    TRACEFUNC;
+
+    m_isRenderScheduled = false;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    while (!m_renderQueue.empty() && timer.elapsed() < RENDER_SLICE_MS) {
+        const QByteArray key = m_renderQueue.front();
+        m_renderQueue.pop_front();
+
+        Renderer renderer;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_pendingIcons.find(key);
+            if (it == m_pendingIcons.end()) {
+                continue;
+            }
+            renderer = it->second;
+        }
+
+        QImage image = renderer ? renderer() : QImage();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pendingIcons.erase(key);
+            if (!image.isNull()) {
+                insertIcon(key, image);
+            }
+        }
+
+        if (!image.isNull()) {
+            saveIcon(key, image);
+        }
+    }
+
+    scheduleIconsReady();
+
+    if (!m_renderQueue.empty()) {
+        m_isRenderScheduled = true;
+        async::Async::call(this, [this]() {
+            renderQueuedIcons();
+        });
+    }
+}
+
+void PaletteCellIconCache::saveIcon(const QByteArray& key, const QImage& image)
+{
+    const QString path = iconPath(key);
+    if (path.isEmpty()) {
+        return;
+    }
+
+    QtConcurrent::run([path, image]() {
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly)) {
+            return;
+        }
+
+        if (!image.save(&file, "PNG") || !file.commit()) {
+            LOGW() << "failed write palette icon: " << path;
+        }
+    });
+}
+
+void PaletteCellIconCache::scheduleIconsReady()
+{
+    if (m_isIconsReadyScheduled) {
+        return;
+    }
+
+    m_isIconsReadyScheduled = true;
+    QTimer::singleShot(ICONS_READY_INTERVAL_MS, [this]() {
+        m_isIconsReadyScheduled = false;
+        m_iconsReady.notify();
+    });
+}
+
+void PaletteCellIconCache::insertIcon(const QByteArray& key, const QImage& image)
+{
+    auto it = m_icons.find(key);
+    if (it != m_icons.end()) {
+        m_memoryUsage -= static_cast<size_t>(it->second.image.sizeInBytes());
+        m_lru.erase(it->second.lruIt);
+        m_icons.erase(it);
+    }
+
+    m_lru.push_front(key);
+
+    Icon icon;
+    icon.image = image;
+    icon.lruIt = m_lru.begin();
+    m_icons.emplace(key, std::move(icon));
+
+    m_memoryUsage += static_cast<size_t>(image.sizeInBytes());
+
+    evictIcons();
+}
+
+void PaletteCellIconCache::evictIcons()
+{
+    while (m_memoryUsage > m_memoryLimit && m_lru.size() > 1) {
+        auto it = m_icons.find(m_lru.back());
+        IF_ASSERT_FAILED(it != m_icons.end()) {
+            m_lru.pop_back();
+            continue;
+        }
+
+        m_memoryUsage -= static_cast<size_t>(it->second.image.sizeInBytes());
+        m_lru.pop_back();
+        m_icons.erase(it);
+    }
+}
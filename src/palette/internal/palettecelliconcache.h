@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PALETTE_PALETTECELLICONCACHE_H
+#define MU_PALETTE_PALETTECELLICONCACHE_H
+
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+
+#include "ipalettecelliconcache.h"
+
+#include "async/asyncable.h"
+#include "async/channel.h"
+
+#include "modularity/ioc.h"
+#include "iglobalconfiguration.h"
+
+namespace mu::palette {
+//! NOTE Cache of the rendered palette cell icons.
+//! The icons are kept in memory (LRU, limited by size) and on the disk in the user cache dir.
+//! Missing icons are read from the disk on the global thread pool,
+//! or rendered on the main thread in small batches, so the palettes stay responsive while they are filled
+class PaletteCellIconCache : public IPaletteCellIconCache, public async::Asyncable
+{
+    INJECT(palette, framework::IGlobalConfiguration, globalConfiguration)
+
+public:
+    PaletteCellIconCache() = default;
+
+    static constexpr size_t DEFAULT_MEMORY_LIMIT = 32 * 1024 * 1024;
+
+    void init();
+
+    QImage icon(const QByteArray& key, const Renderer& renderer) override;
+    void clear() override;
+
+    async::Notification iconsReady() const override;
+
+private:
+    struct Icon {
+        QImage image;
+        std::list<QByteArray>::iterator lruIt;
+    };
+
+    struct LoadedIcon {
+        QByteArray key;
+        QImage image;
+    };
+
+    QString iconPath(const QByteArray& key) const;
+
+    void onIconRequested(const QByteArray& key);
+    void onIconLoaded(const LoadedIcon& icon);
+    void renderQueuedIcons();
+    void saveIcon(const QByteArray& key, const QImage& image);
+    void scheduleIconsReady();
+
+    void insertIcon(const QByteArray& key, const QImage& image);
+    void evictIcons();
+
+    mutable std::mutex m_mutex;
+    std::map<QByteArray, Icon> m_icons;
+    std::list<QByteArray> m_lru; // most recently used first
+    std::map<QByteArray, Renderer> m_pendingIcons;
+    size_t m_memoryUsage = 0;
+    size_t m_memoryLimit = DEFAULT_MEMORY_LIMIT;
+
+    std::deque<QByteArray> m_renderQueue;
+    bool m_isRenderScheduled = false;
+    bool m_isIconsReadyScheduled = false;
+
+    QString m_cacheDir;
+
+    async::Channel<QByteArray> m_iconRequested;
+    async::Channel<LoadedIcon> m_iconLoaded;
+    async::Notification m_iconsReady;
+};
+}
+
+#endif // MU_PALETTE_PALETTECELLICONCACHE_H
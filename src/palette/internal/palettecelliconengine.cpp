@@ -21,6 +21,8 @@
  */
 #include "palettecelliconengine.h"
 
+#include <QCryptographicHash>
+
 #include "engraving/infrastructure/draw/geometry.h"
 #include "engraving/infrastructure/draw/painter.h"
 #include "engraving/infrastructure/draw/pen.h"
@@ -50,17 +52,75 @@ void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode m
     Painter p(qp, "palettecell");
     p.save();
     p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
+
+    double guiScaling = uiConfiguration()->guiScaling();
+    p.scale(guiScaling, guiScaling);
+    paintBackground(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
     p.restore();
+
+    if (!m_cell || !m_cell->element) {
+        return;
+    }
+
+    //! NOTE The cell is rendered on the main thread by the cache, until then a placeholder is shown
+    const qreal dpr = qp->device() ? qp->device()->devicePixelRatioF() : 1.0;
+    std::shared_ptr<const PaletteCellIconEngine> engine(new PaletteCellIconEngine(m_cell, m_extraMag));
+    QImage image = iconCache()->icon(cacheKey(rect.size(), dpr), [engine, rect, dpr]() {
+        return engine->renderCell(rect, dpr);
+    });
+
+    if (image.isNull()) {
+        p.save();
+        p.setAntialiasing(true);
+        paintPlaceholder(p, RectF::fromQRectF(rect));
+        p.restore();
+        return;
+    }
+
+    qp->drawImage(rect.topLeft(), image);
 }
 
-void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current) const
+QByteArray PaletteCellIconEngine::cacheKey(const QSize& size, qreal devicePixelRatio) const
+{
+    if (m_cellHash.isEmpty()) {
+        m_cellHash = QCryptographicHash::hash(m_cell->toMimeData(), QCryptographicHash::Sha1);
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(m_cellHash);
+    hash.addData(QString("%1x%2@%3/%4/%5/%6/%7")
+                 .arg(size.width()).arg(size.height())
+                 .arg(devicePixelRatio)
+                 .arg(m_extraMag * configuration()->paletteSpatium())
+                 .arg(uiConfiguration()->guiScaling())
+                 .arg(QString::fromStdString(uiConfiguration()->currentTheme().codeKey))
+                 .arg(configuration()->elementsColor().name(QColor::HexArgb)).toUtf8());
+
+    return hash.result();
+}
+
+QImage PaletteCellIconEngine::renderCell(const QRect& rect, qreal devicePixelRatio) const
+{
+    TRACEFUNC;
+
+    QImage image(rect.size() * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+
+    Painter painter(&image, "palettecell");
+    painter.setAntialiasing(true);
+    painter.translate(-rect.x(), -rect.y());
+    paintCell(painter, RectF::fromQRectF(rect));
+    painter.endDraw();
+
+    return image;
+}
+
+void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect) const
 {
     double guiScaling = uiConfiguration()->guiScaling();
     painter.scale(guiScaling, guiScaling);
 
-    paintBackground(painter, rect, selected, current);
-
     if (!m_cell) {
         return;
     }
@@ -101,6 +161,19 @@ void PaletteCellIconEngine::paintBackground(Painter& painter, const RectF& rect,
     }
 }
 
+void PaletteCellIconEngine::paintPlaceholder(Painter& painter, const RectF& rect) const
+{
+    QColor c(configuration()->elementsColor());
+    c.setAlpha(30);
+
+    const qreal extent = qMin(rect.width(), rect.height()) / 3.0;
+    const RectF placeholderRect(rect.center().x() - extent / 2.0, rect.center().y() - extent / 2.0, extent, extent);
+
+    painter.setPen(Pen(PenStyle::NoPen));
+    painter.setBrush(Brush(Color::fromQColor(c)));
+    painter.drawRoundedRect(placeholderRect, 2, 2);
+}
+
 /// Paint an icon element so that it fills a QRect, preserving aspect ratio, and
 /// leaving a small margin around the edges.
 void PaletteCellIconEngine::paintActionIcon(Painter& painter, const RectF& rect, EngravingItem* element) const
@@ -28,6 +28,7 @@
 
 #include "modularity/ioc.h"
 #include "ipaletteconfiguration.h"
+#include "ipalettecelliconcache.h"
 #include "ui/iuiconfiguration.h"
 
 namespace mu::palette {
@@ -35,6 +36,7 @@ class PaletteCellIconEngine : public QIconEngine
 {
     INJECT_STATIC(palette, IPaletteConfiguration, configuration)
     INJECT_STATIC(palette, ui::IUiConfiguration, uiConfiguration)
+    INJECT_STATIC(palette, IPaletteCellIconCache, iconCache)
 
 public:
     explicit PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag = 1.0);
@@ -46,14 +48,19 @@ public:
     static void paintPaletteElement(void* data, Ms::EngravingItem* element);
 
 private:
-    void paintCell(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
+    QByteArray cacheKey(const QSize& size, qreal devicePixelRatio) const;
+    QImage renderCell(const QRect& rect, qreal devicePixelRatio) const;
+
+    void paintCell(draw::Painter& painter, const RectF& rect) const;
     void paintBackground(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
+    void paintPlaceholder(draw::Painter& painter, const RectF& rect) const;
     void paintActionIcon(draw::Painter& painter, const RectF& rect, Ms::EngravingItem* element) const;
     qreal paintStaff(draw::Painter& painter, const RectF& rect, qreal spatium) const;
     void paintScoreElement(draw::Painter& painter, Ms::EngravingItem* element, qreal spatium, bool alignToStaff) const;
 
     PaletteCellConstPtr m_cell;
     qreal m_extraMag = 1.0;
+    mutable QByteArray m_cellHash;
 };
 }
 
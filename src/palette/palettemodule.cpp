@@ -38,6 +38,7 @@
 #include "internal/paletteworkspacesetup.h"
 #include "internal/paletteprovider.h"
 #include "internal/palettecell.h"
+#include "internal/palettecelliconcache.h"
 
 #include "view/paletterootmodel.h"
 #include "view/palettepropertiesmodel.h"
@@ -61,6 +62,7 @@ static std::shared_ptr<PaletteActionsController> s_actionsController = std::make
 static std::shared_ptr<PaletteUiActions> s_paletteUiActions = std::make_shared<PaletteUiActions>(s_actionsController);
 static std::shared_ptr<PaletteConfiguration> s_configuration = std::make_shared<PaletteConfiguration>();
 static std::shared_ptr<PaletteWorkspaceSetup> s_paletteWorkspaceSetup = std::make_shared<PaletteWorkspaceSetup>();
+static std::shared_ptr<PaletteCellIconCache> s_iconCache = std::make_shared<PaletteCellIconCache>();
 
 static void palette_init_qrc()
 {
@@ -76,6 +78,7 @@ void PaletteModule::registerExports()
 {
     ioc()->registerExport<IPaletteProvider>(moduleName(), s_paletteProvider);
     ioc()->registerExport<IPaletteConfiguration>(moduleName(), s_configuration);
+    ioc()->registerExport<IPaletteCellIconCache>(moduleName(), s_iconCache);
 }
 
 void PaletteModule::resolveImports()
@@ -156,6 +159,7 @@ void PaletteModule::onInit(const framework::IApplication::RunMode& mode)
     s_actionsController->init();
     s_paletteUiActions->init();
     s_paletteProvider->init();
+    s_iconCache->init();
 }
 
 void PaletteModule::onAllInited(const framework::IApplication::RunMode& mode)
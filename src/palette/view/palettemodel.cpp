@@ -57,6 +57,11 @@ PaletteTreeModel::PaletteTreeModel(PaletteTreePtr tree, QObject* parent)
     configuration()->colorsChanged().onNotify(this, [this]() {
         notifyAboutCellsChanged(Qt::DecorationRole);
     });
+
+    //! NOTE Repaint the placeholders of the cells whose icons have been rendered or loaded
+    iconCache()->iconsReady().onNotify(this, [this]() {
+        notifyAboutCellsChanged(Qt::DecorationRole);
+    });
 }
 
 //---------------------------------------------------------
@@ -68,7 +73,7 @@ void PaletteTreeModel::onDataChanged(const QModelIndex& topLeft, const QModelInd
 {
     Q_UNUSED(topLeft);
     Q_UNUSED(bottomRight);
-    static const std::set<int> nonPersistentRoles({ CellActiveRole, PaletteExpandedRole });
+    static const std::set<int> nonPersistentRoles({ Qt::DecorationRole, CellActiveRole, PaletteExpandedRole });
 
     bool treeChanged = false;
     for (int role : roles) {
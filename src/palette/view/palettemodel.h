@@ -30,6 +30,7 @@
 
 #include "modularity/ioc.h"
 #include "ipaletteconfiguration.h"
+#include "internal/ipalettecelliconcache.h"
 #include "async/asyncable.h"
 
 namespace Ms {
@@ -101,6 +102,7 @@ class PaletteTreeModel : public QAbstractItemModel, public mu::async::Asyncable
     Q_OBJECT
 
     INJECT(palette, mu::palette::IPaletteConfiguration, configuration)
+    INJECT(palette, mu::palette::IPaletteCellIconCache, iconCache)
 
 public:
     enum PaletteTreeModelRoles {
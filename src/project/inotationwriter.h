@@ -48,7 +48,8 @@ public:
         UNIT_TYPE,
         PAGE_NUMBER,
         TRANSPARENT_BACKGROUND,
-        NOTES_COLORS
+        NOTES_COLORS,
+        UNITS_PREPARED
     };
 
     using Options = QMap<OptionKey, Val>;
@@ -59,6 +60,12 @@ public:
     virtual Ret write(notation::INotationPtr notation, io::Device& device, const Options& options = Options()) = 0;
     virtual Ret writeList(const notation::INotationPtrList& notations, io::Device& device, const Options& options = Options()) = 0;
     virtual void abort() = 0;
+
+    //! NOTE Sets the state shared by the units of the notation (ex. the paint state of the score) on the calling thread.
+    //! The units written with OptionKey::UNITS_PREPARED don't change it, so they can be written from several threads,
+    //! the state is restored by finishUnits()
+    virtual void prepareUnits(notation::INotationPtr /*notation*/, const Options& /*options*/) {}
+    virtual void finishUnits(notation::INotationPtr /*notation*/) {}
     virtual framework::ProgressChannel progress() const = 0;
 };
 